@@ -4,6 +4,7 @@
  */
 
 #include "Application.hpp"
+#include "CounterRNG.hpp"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -46,6 +47,7 @@ namespace Theme {
 Application::Application()
     : fontLoaded(false), running(true), obstacleMode(false), drawMode(true),
       selectedPattern(""), drawingObstacleAlive(true), currentRuleIndex(0),
+      soupDensity(0.3), soupSeed(CounterRNG::randomSeed()),
       statusMessage(""), statusMessageTimer(0.0f),
       activePanel(PanelType::NONE), loadFilename("exemple.txt"), saveFilename("sauvegarde.txt"),
       loadFieldActive(true), selectedFileIndex(-1),
@@ -55,9 +57,7 @@ Application::Application()
       activeModesField(0) {
     
     ruleNames = {"Classic Conway", "HighLife", "Day & Night", "Seeds", "Maze"};
-    patternNames = {"glider", "blinker", "beacon", "toad", "lwss", "pulsar",
-                    "pentadecathlon", "glider_gun", "block", "beehive", "loaf",
-                    "boat", "r_pentomino", "diehard", "acorn"};
+    patternNames = Grid::getAvailablePatterns();
     
     // Scanner les fichiers disponibles
     scanAvailableFiles();
@@ -69,7 +69,10 @@ Application::Application()
 
 bool Application::initGraphicsMode() {
     game = std::make_unique<GameOfLife>(DEFAULT_GRID_WIDTH, DEFAULT_GRID_HEIGHT, DEFAULT_UPDATE_INTERVAL);
+    game->setSoupParameters(soupDensity, soupSeed);
     game->randomize();
+    std::cout << "Soupe initiale : --seed " << game->getLastSoupSeed()
+              << " --density " << game->getSoupDensity() << std::endl;
     
     renderer = std::make_shared<SFMLRenderer>(
         DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT, 
@@ -160,6 +163,7 @@ void Application::runGraphicsLoop() {
         
         // Rendu
         window->clear(Theme::Background);
+        renderer->setHeatMap(game->getHeatMap());
         renderer->render(game->getGrid());
         
         drawSidebar();
@@ -192,6 +196,11 @@ void Application::runDefault() {
     if (initGraphicsMode()) runGraphicsLoop();
 }
 
+void Application::setSoupParameters(double density, std::uint64_t seed) {
+    soupDensity = density;
+    soupSeed = seed;
+}
+
 // ============================================================
 // Gestion des événements
 // ============================================================
@@ -212,7 +221,8 @@ void Application::handleKeyPress(sf::Keyboard::Key key) {
             break;
         case sf::Keyboard::R:
             game->randomize();
-            showStatus("🎲 Grille randomisée (I=sauver état, L=restaurer)");
+            showStatus("🎲 Grille randomisée, graine " + std::to_string(game->getLastSoupSeed()) +
+                       " (I=sauver état, L=restaurer)");
             break;
         case sf::Keyboard::I:
             saveInitialState();
@@ -244,6 +254,14 @@ void Application::handleKeyPress(sf::Keyboard::Key key) {
             game->getGrid().setParallelMode(!game->getGrid().isParallelMode());
             showStatus(game->getGrid().isParallelMode() ? "⚡ Parallèle ON" : "Parallèle OFF");
             break;
+        case sf::Keyboard::E:
+            game->setEscapeRemoval(!game->isEscapeRemovalEnabled());
+            showStatus(game->isEscapeRemovalEnabled() ? "Retrait des vaisseaux ON" : "Retrait des vaisseaux OFF");
+            break;
+        case sf::Keyboard::A:
+            game->setHeatMapEnabled(game->getHeatMap() == nullptr);
+            showStatus(game->getHeatMap() ? "Carte d'activité ON" : "Carte d'activité OFF");
+            break;
         case sf::Keyboard::O:
             obstacleMode = !obstacleMode;
             selectedPattern = "";
@@ -652,13 +670,13 @@ void Application::drawTopBar() {
     
     // Cycle/Stabilité détecté
     if (game->getDetectedCycleLength() > 0 && !game->getIsPaused()) {
-        float timeLeft = 10.0f - game->getTimeSinceLastChange();
+        std::int64_t generationsLeft = game->getGenerationsUntilStop();
         std::ostringstream cycleMsg;
         if (game->getDetectedCycleLength() == 1) {
-            cycleMsg << "STABLE - Arrêt: " << std::fixed << std::setprecision(0) << timeLeft << "s";
+            cycleMsg << "STABLE - Arrêt: " << generationsLeft << " gen";
         } else {
             cycleMsg << "CYCLE P" << game->getDetectedCycleLength() << " - Arrêt: " 
-                     << std::fixed << std::setprecision(0) << timeLeft << "s";
+                     << generationsLeft << " gen";
         }
         drawText(cycleMsg.str(), DEFAULT_WINDOW_WIDTH - 280, 18, 12, Theme::Warning);
     }
@@ -759,6 +777,8 @@ void Application::drawHelpPanel() {
         {"Tab", "Changer de règle"},
         {"T", "Mode torique ON/OFF"},
         {"P", "Mode parallèle ON/OFF"},
+        {"E", "Retrait vaisseaux partis"},
+        {"A", "Carte d'activité ON/OFF"},
         {"O", "Mode obstacle ON/OFF"},
         {"V", "Obstacle Vivant/Mort"},
         {"D", "Dessiner / Effacer"},
@@ -772,7 +792,7 @@ void Application::drawHelpPanel() {
         drawRect(px + 15, y, 55, 22, Theme::ButtonNormal);
         drawText(ctrl.first, px + 20, y + 3, 11, Theme::Accent);
         drawText(ctrl.second, px + 80, y + 4, 12, Theme::TextSecondary);
-        y += 26;
+        y += 25;
     }
 }
 
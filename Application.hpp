@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <cstdint>
 
 #include "GameOfLife.hpp"
 #include "Grid.hpp"
@@ -59,6 +60,10 @@ private:
     bool drawingObstacleAlive;
     int currentRuleIndex;
     
+    // Paramètres des soupes aléatoires (--density / --seed)
+    double soupDensity;
+    std::uint64_t soupSeed;
+    
     // Messages d'état
     std::string statusMessage;
     float statusMessageTimer;
@@ -100,6 +105,9 @@ public:
     bool loadAndRun(const std::string& filename);
     void runDefault();
 
+    // Soupes aléatoires reproductibles
+    void setSoupParameters(double density, std::uint64_t seed);
+
     // Gestion des événements
     void handleKeyPress(sf::Keyboard::Key key);
     void handleTextEntered(sf::Uint32 unicode);
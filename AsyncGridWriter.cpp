@@ -0,0 +1,132 @@
+#include "AsyncGridWriter.hpp"
+#include "TextGridWriter.hpp"
+#include <algorithm>
+#include <iostream>
+
+AsyncGridWriter::AsyncGridWriter()
+    : capacity(DEFAULT_CAPACITY), closing(false), failed(false), written(0) {
+}
+
+AsyncGridWriter::~AsyncGridWriter() {
+    close();
+}
+
+void AsyncGridWriter::start(std::size_t maxPending, unsigned writerCount) {
+    close();
+    capacity = std::max<std::size_t>(1, maxPending);
+    closing = false;
+    failed = false;
+    written = 0;
+    for (unsigned i = 0; i < std::max(1u, writerCount); ++i) {
+        writers.emplace_back(&AsyncGridWriter::writeLoop, this);
+    }
+}
+
+bool AsyncGridWriter::isRunning() const {
+    return !writers.empty();
+}
+
+std::unique_ptr<GridSnapshot> AsyncGridWriter::acquire() {
+    // Contre-pression : on ne capture pas tant que la file est pleine
+    std::unique_lock<std::mutex> lock(mutex);
+    space.wait(lock, [this] { return queue.size() < capacity; });
+    if (spare.empty()) {
+        return std::unique_ptr<GridSnapshot>(new GridSnapshot());
+    }
+    std::unique_ptr<GridSnapshot> snapshot = std::move(spare.back());
+    spare.pop_back();
+    return snapshot;
+}
+
+void AsyncGridWriter::enqueue(const std::string& filename, std::unique_ptr<GridSnapshot> snapshot) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back({filename, std::move(snapshot)});
+    }
+    ready.notify_one();
+}
+
+bool AsyncGridWriter::writeNow(const std::string& filename, const GridSnapshot& snapshot) {
+    TextGridWriter writer;
+    const bool ok = writer.write(filename, snapshot);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (ok) {
+        ++written;
+    } else {
+        failed = true;
+    }
+    return ok;
+}
+
+void AsyncGridWriter::submit(const std::string& filename, const Grid& grid) {
+    if (!isRunning()) {
+        GridSnapshot snapshot;
+        snapshot.capture(grid);
+        writeNow(filename, snapshot);
+        return;
+    }
+    std::unique_ptr<GridSnapshot> snapshot = acquire();
+    snapshot->capture(grid);
+    enqueue(filename, std::move(snapshot));
+}
+
+void AsyncGridWriter::submit(const std::string& filename, const BitGrid& grid) {
+    if (!isRunning()) {
+        GridSnapshot snapshot;
+        snapshot.capture(grid);
+        writeNow(filename, snapshot);
+        return;
+    }
+    std::unique_ptr<GridSnapshot> snapshot = acquire();
+    snapshot->capture(grid);
+    enqueue(filename, std::move(snapshot));
+}
+
+bool AsyncGridWriter::close() {
+    if (writers.empty()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return !failed;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closing = true;
+    }
+    ready.notify_all();
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    writers.clear();
+    std::lock_guard<std::mutex> lock(mutex);
+    return !failed;
+}
+
+std::int64_t AsyncGridWriter::getWrittenCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return written;
+}
+
+void AsyncGridWriter::writeLoop() {
+    TextGridWriter writer;  // Tampon propre à chaque thread
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        ready.wait(lock, [this] { return closing || !queue.empty(); });
+        if (queue.empty()) {
+            break;  // closing et plus rien à écrire
+        }
+        Job job = std::move(queue.front());
+        queue.pop_front();
+        space.notify_one();
+
+        // Formatage et écriture sans verrou : la simulation continue
+        lock.unlock();
+        const bool ok = writer.write(job.filename, *job.snapshot);
+        lock.lock();
+
+        if (ok) {
+            ++written;
+        } else {
+            failed = true;
+        }
+        spare.push_back(std::move(job.snapshot));
+    }
+}
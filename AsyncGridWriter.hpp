@@ -0,0 +1,126 @@
+#ifndef ASYNCGRIDWRITER_HPP
+#define ASYNCGRIDWRITER_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "GridSnapshot.hpp"
+
+/**
+ * @class AsyncGridWriter
+ * @brief Écriture des générations en arrière-plan, file bornée
+ *
+ * Le thread de simulation capture la génération (GridSnapshot, un bit par
+ * cellule) et continue ; un ou plusieurs threads d'écriture la formatent
+ * (TextGridWriter) et l'écrivent. Quand la file contient déjà `capacity`
+ * générations, submit attend qu'une place se libère : la mémoire reste
+ * bornée et la simulation ne ralentit que si le disque ne suit pas. Les
+ * captures sont recyclées d'une génération à l'autre.
+ */
+class AsyncGridWriter {
+public:
+    /**
+     * @brief Générations en attente par défaut
+     */
+    static const std::size_t DEFAULT_CAPACITY = 4;
+
+    /**
+     * @brief Constructeur (aucun thread démarré : submit écrit directement)
+     */
+    AsyncGridWriter();
+
+    /**
+     * @brief Destructeur : écrit les générations restantes
+     */
+    ~AsyncGridWriter();
+
+    AsyncGridWriter(const AsyncGridWriter&) = delete;
+    AsyncGridWriter& operator=(const AsyncGridWriter&) = delete;
+
+    /**
+     * @brief Démarre les threads d'écriture
+     * @param capacity Générations en attente au maximum (au moins 1)
+     * @param writers Nombre de threads d'écriture (au moins 1)
+     */
+    void start(std::size_t capacity = DEFAULT_CAPACITY, unsigned writers = 1);
+
+    /**
+     * @brief Vérifie si les threads d'écriture tournent
+     * @return true entre start et close
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Confie une génération à l'écriture (attend si la file est pleine)
+     * @param filename Fichier de sortie
+     * @param grid Grille à écrire (capturée avant le retour)
+     */
+    void submit(const std::string& filename, const Grid& grid);
+
+    /**
+     * @brief Confie une génération de grille compacte à l'écriture
+     * @param filename Fichier de sortie
+     * @param grid Grille à écrire (capturée avant le retour)
+     */
+    void submit(const std::string& filename, const BitGrid& grid);
+
+    /**
+     * @brief Écrit les générations en attente puis arrête les threads
+     * @return false si une écriture a échoué depuis start
+     */
+    bool close();
+
+    /**
+     * @brief Obtient le nombre de générations écrites depuis start
+     * @return Fichiers écrits avec succès
+     */
+    std::int64_t getWrittenCount() const;
+
+private:
+    /**
+     * @brief Génération en attente d'écriture
+     */
+    struct Job {
+        std::string filename;
+        std::unique_ptr<GridSnapshot> snapshot;
+    };
+
+    std::size_t capacity;
+    std::deque<Job> queue;                              // Générations à écrire
+    std::vector<std::unique_ptr<GridSnapshot>> spare;   // Captures recyclées
+    mutable std::mutex mutex;
+    std::condition_variable ready;                      // File non vide ou fermeture
+    std::condition_variable space;                      // Place libre dans la file
+    bool closing;
+    bool failed;
+    std::int64_t written;
+    std::vector<std::thread> writers;
+
+    /**
+     * @brief Prend une capture recyclée (ou en crée une), en attendant une place
+     * @return Capture à remplir
+     */
+    std::unique_ptr<GridSnapshot> acquire();
+
+    /**
+     * @brief Ajoute une génération capturée à la file
+     */
+    void enqueue(const std::string& filename, std::unique_ptr<GridSnapshot> snapshot);
+
+    /**
+     * @brief Écrit une capture sans thread (writer non démarré)
+     */
+    bool writeNow(const std::string& filename, const GridSnapshot& snapshot);
+
+    /**
+     * @brief Boucle d'un thread d'écriture
+     */
+    void writeLoop();
+};
+
+#endif // ASYNCGRIDWRITER_HPP
@@ -0,0 +1,995 @@
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include "Rule.hpp"
+#include "Cell.hpp"
+#include "CounterRNG.hpp"
+#include "MappedFile.hpp"
+#include "HugePageBuffer.hpp"
+#include "NumaTopology.hpp"
+#include "PatternRegistry.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+const char MAPPED_MAGIC[8] = {'G', 'O', 'L', 'M', 'A', 'P', '1', '\0'};
+
+// Taille visée d'une bande de lignes pour une grille projetée
+const std::uint64_t BAND_BYTES = 16ULL * 1024 * 1024;
+
+// Nombre minimal de lignes par thread (en dessous, le coût des threads domine)
+const std::int64_t MIN_ROWS_PER_THREAD = 64;
+
+// Règle de Conway (B3/S23)
+const std::uint16_t CLASSIC_BIRTH_MASK = 1u << 3;
+const std::uint16_t CLASSIC_SURVIVAL_MASK = (1u << 2) | (1u << 3);
+
+std::uint64_t roundUpToPage(std::uint64_t bytes) {
+    std::uint64_t page = MappedFile::pageSize();
+    return (bytes + page - 1) / page * page;
+}
+
+/**
+ * @class HeapPlaneStorage
+ * @brief Plans de bits en mémoire anonyme (pages énormes si disponibles)
+ *
+ * Les plans sont réservés à zéro sans être touchés : BitGrid les initialise
+ * ensuite depuis ses threads de calcul (premier accès NUMA).
+ */
+class HeapPlaneStorage : public PlaneStorage {
+public:
+    explicit HeapPlaneStorage(std::uint64_t planeWords)
+        : planeBytes(planeWords * sizeof(std::uint64_t)) {
+        if (!planes[0].allocate(planeBytes) || !planes[1].allocate(planeBytes)) {
+            throw std::bad_alloc();
+        }
+    }
+
+    std::uint64_t* plane(int index) override {
+        return static_cast<std::uint64_t*>(planes[index].data());
+    }
+
+    bool hasObstaclePlane() const override {
+        return planes[2].data() != nullptr;
+    }
+
+    bool addObstaclePlane() override {
+        if (!hasObstaclePlane() && !planes[2].allocate(planeBytes)) {
+            return false;
+        }
+        return true;
+    }
+
+    bool usesHugePages() const override {
+        return planes[0].usesHugePages();
+    }
+
+private:
+    std::uint64_t planeBytes;
+    HugePageBuffer planes[3];
+};
+
+/**
+ * @class MappedPlaneStorage
+ * @brief Plans de bits dans un fichier projeté (en-tête puis plans alignés sur les pages)
+ */
+class MappedPlaneStorage : public PlaneStorage {
+public:
+    MappedPlaneStorage(std::int64_t height, std::int64_t wordsPerRow, bool withObstacles)
+        : rowBytes(static_cast<std::uint64_t>(wordsPerRow) * sizeof(std::uint64_t)),
+          height(height),
+          planeBytes(roundUpToPage(rowBytes * static_cast<std::uint64_t>(height))),
+          obstacles(withObstacles) {
+    }
+
+    /**
+     * @brief Taille totale du fichier
+     */
+    std::uint64_t fileSize() const {
+        return headerBytes() + planeBytes * (obstacles ? 3 : 2);
+    }
+
+    bool create(const std::string& path) {
+        if (!file.create(path, fileSize())) return false;
+        adviseSequential();
+        return true;
+    }
+
+    bool open(const std::string& path) {
+        if (!file.open(path, MappedFile::Mode::READ_WRITE)) return false;
+        if (file.size() < fileSize()) {
+            std::cerr << "Erreur : Fichier projeté tronqué " << path << std::endl;
+            file.close();
+            return false;
+        }
+        adviseSequential();
+        return true;
+    }
+
+    static std::uint64_t headerBytes() {
+        return roundUpToPage(sizeof(MappedGridHeader));
+    }
+
+    std::uint64_t* plane(int index) override {
+        if (index == 2 && !obstacles) return nullptr;
+        return reinterpret_cast<std::uint64_t*>(file.data() + planeOffset(index));
+    }
+
+    bool hasObstaclePlane() const override {
+        return obstacles;
+    }
+
+    bool addObstaclePlane() override {
+        // La taille du fichier est fixée à la création
+        return obstacles;
+    }
+
+    void prepareBand(int currentPlane, std::int64_t firstRow, std::int64_t endRow) override {
+        // Précharge la bande suivante pendant le calcul de celle-ci
+        std::int64_t nextEnd = std::min(height, endRow + (endRow - firstRow));
+        if (nextEnd > endRow) {
+            file.advise(rowOffset(currentPlane, endRow),
+                        rowBytes * static_cast<std::uint64_t>(nextEnd - endRow),
+                        MappedFile::Advice::WILL_NEED);
+        }
+    }
+
+    void finishBand(int currentPlane, std::int64_t firstRow, std::int64_t endRow) override {
+        // Lance l'écriture de la bande produite sans l'attendre
+        std::uint64_t bandBytes = rowBytes * static_cast<std::uint64_t>(endRow - firstRow);
+        file.sync(rowOffset(1 - currentPlane, firstRow), bandBytes, false);
+
+        // La bande lue n'est plus utile, sauf sa dernière ligne (voisine de la bande suivante)
+        if (endRow - 1 > firstRow && endRow < height) {
+            file.advise(rowOffset(currentPlane, firstRow),
+                        rowBytes * static_cast<std::uint64_t>(endRow - 1 - firstRow),
+                        MappedFile::Advice::DONT_NEED);
+        }
+    }
+
+    void commit(const MappedGridHeader& header) override {
+        std::memcpy(file.data(), &header, sizeof(header));
+    }
+
+    bool sync() override {
+        return file.sync(0, file.size(), true);
+    }
+
+    bool isMapped() const override {
+        return true;
+    }
+
+private:
+    MappedFile file;
+    std::uint64_t rowBytes;
+    std::int64_t height;
+    std::uint64_t planeBytes;
+    bool obstacles;
+
+    std::uint64_t planeOffset(int index) const {
+        return headerBytes() + planeBytes * static_cast<std::uint64_t>(index);
+    }
+
+    std::uint64_t rowOffset(int index, std::int64_t y) const {
+        return planeOffset(index) + rowBytes * static_cast<std::uint64_t>(y);
+    }
+
+    void adviseSequential() {
+        file.advise(headerBytes(), planeBytes * (obstacles ? 3 : 2), MappedFile::Advice::SEQUENTIAL);
+    }
+};
+
+/**
+ * @brief Calcule le nombre de mots par ligne, en vérifiant les dimensions
+ */
+std::int64_t computeWordsPerRow(std::int64_t width, std::int64_t height) {
+    if (width <= 0 || height <= 0) {
+        throw std::length_error("Dimensions de grille invalides");
+    }
+    return (width + BitGrid::WORD_BITS - 1) / BitGrid::WORD_BITS;
+}
+
+} // namespace
+
+// ============================================================
+// Implémentation de PlaneStorage (comportement par défaut : mémoire)
+// ============================================================
+
+void PlaneStorage::prepareBand(int, std::int64_t, std::int64_t) {
+}
+
+void PlaneStorage::finishBand(int, std::int64_t, std::int64_t) {
+}
+
+void PlaneStorage::commit(const MappedGridHeader&) {
+}
+
+bool PlaneStorage::sync() {
+    return true;
+}
+
+bool PlaneStorage::isMapped() const {
+    return false;
+}
+
+bool PlaneStorage::usesHugePages() const {
+    return false;
+}
+
+// ============================================================
+// Implémentation de BitGrid
+// ============================================================
+
+BitGrid::BitGrid(std::int64_t width, std::int64_t height)
+    : BitGrid(width, height, nullptr) {
+}
+
+BitGrid::BitGrid(std::int64_t width, std::int64_t height, std::unique_ptr<PlaneStorage> existing)
+    : width(width), height(height), wordsPerRow(computeWordsPerRow(width, height)),
+      storage(std::move(existing)), currentPlane(0), generation(0),
+      birthMask(CLASSIC_BIRTH_MASK), survivalMask(CLASSIC_SURVIVAL_MASK),
+      toricMode(false), parallelMode(true) {
+    if (!storage) {
+        std::uint64_t words = static_cast<std::uint64_t>(wordsPerRow) * static_cast<std::uint64_t>(height);
+        storage.reset(new HeapPlaneStorage(words));
+        firstTouch(0);
+        firstTouch(1);
+    }
+}
+
+BitGrid::BitGrid(const BitGrid& other)
+    : BitGrid(other.width, other.height) {
+    *this = other;
+}
+
+BitGrid& BitGrid::operator=(const BitGrid& other) {
+    if (this == &other) return *this;
+
+    // Stockage réutilisé seulement s'il a la même forme ; un plan d'obstacles
+    // que la source n'a pas est abandonné avec lui
+    if (width != other.width || height != other.height || storage->isMapped() ||
+        (storage->hasObstaclePlane() && !other.hasObstacles())) {
+        width = other.width;
+        height = other.height;
+        wordsPerRow = other.wordsPerRow;
+        storage.reset(new HeapPlaneStorage(
+            static_cast<std::uint64_t>(wordsPerRow) * static_cast<std::uint64_t>(height)));
+        firstTouch(0);
+        firstTouch(1);
+        if (heatMap) {
+            heatMap.reset(new HeatMap(width, height, heatMap->getResolution()));
+        }
+    } else if (heatMap) {
+        heatMap->clear();
+    }
+    currentPlane = 0;
+
+    std::uint64_t bytes = static_cast<std::uint64_t>(wordsPerRow) * height * sizeof(Word);
+    std::memcpy(storage->plane(0), other.row(0), bytes);
+    if (other.hasObstacles()) {
+        if (!storage->hasObstaclePlane()) {
+            storage->addObstaclePlane();
+            firstTouch(2);
+        }
+        std::memcpy(storage->plane(2), other.obstacleRow(0), bytes);
+    }
+
+    generation = other.generation;
+    birthMask = other.birthMask;
+    survivalMask = other.survivalMask;
+    toricMode = other.toricMode;
+    parallelMode = other.parallelMode;
+    return *this;
+}
+
+BitGrid::~BitGrid() {
+    if (storage && storage->isMapped()) {
+        storage->sync();
+    }
+}
+
+std::unique_ptr<BitGrid> BitGrid::createMapped(const std::string& path,
+                                               std::int64_t width, std::int64_t height,
+                                               bool withObstacles) {
+    if (width <= 0 || height <= 0) {
+        std::cerr << "Erreur : Dimensions de grille invalides (" << width << "x" << height << ")" << std::endl;
+        return nullptr;
+    }
+
+    std::int64_t words = (width + WORD_BITS - 1) / WORD_BITS;
+    std::unique_ptr<MappedPlaneStorage> mapped(new MappedPlaneStorage(height, words, withObstacles));
+    if (!mapped->create(path)) {
+        return nullptr;
+    }
+
+    // Le fichier créé est creux et donc déjà rempli de zéros
+    std::unique_ptr<BitGrid> grid(new BitGrid(width, height, std::move(mapped)));
+    grid->storage->commit(grid->makeHeader());
+    return grid;
+}
+
+std::unique_ptr<BitGrid> BitGrid::openMapped(const std::string& path) {
+    MappedFile probe;
+    if (!probe.open(path, MappedFile::Mode::READ_ONLY)) {
+        return nullptr;
+    }
+
+    MappedGridHeader header;
+    if (probe.size() < sizeof(header)) {
+        std::cerr << "Erreur : " << path << " n'est pas une grille projetée" << std::endl;
+        return nullptr;
+    }
+    std::memcpy(&header, probe.data(), sizeof(header));
+    probe.close();
+
+    if (std::memcmp(header.magic, MAPPED_MAGIC, sizeof(MAPPED_MAGIC)) != 0) {
+        std::cerr << "Erreur : " << path << " n'est pas une grille projetée" << std::endl;
+        return nullptr;
+    }
+    if (header.width <= 0 || header.height <= 0 || header.currentPlane > 1 ||
+        header.wordsPerRow != (header.width + WORD_BITS - 1) / WORD_BITS) {
+        std::cerr << "Erreur : En-tête de grille projetée invalide dans " << path << std::endl;
+        return nullptr;
+    }
+
+    bool withObstacles = (header.flags & FLAG_OBSTACLES) != 0;
+    std::unique_ptr<MappedPlaneStorage> mapped(
+        new MappedPlaneStorage(header.height, header.wordsPerRow, withObstacles));
+    if (!mapped->open(path)) {
+        return nullptr;
+    }
+
+    std::unique_ptr<BitGrid> grid(new BitGrid(header.width, header.height, std::move(mapped)));
+    grid->currentPlane = static_cast<int>(header.currentPlane);
+    grid->generation = header.generation;
+    grid->birthMask = header.birthMask;
+    grid->survivalMask = header.survivalMask;
+    grid->toricMode = (header.flags & FLAG_TORIC) != 0;
+    return grid;
+}
+
+std::unique_ptr<BitGrid> BitGrid::createWithStorage(std::int64_t width, std::int64_t height,
+                                                   std::unique_ptr<PlaneStorage> storage) {
+    if (width <= 0 || height <= 0 || !storage) {
+        std::cerr << "Erreur : Dimensions de grille invalides (" << width << "x" << height << ")" << std::endl;
+        return nullptr;
+    }
+    return std::unique_ptr<BitGrid>(new BitGrid(width, height, std::move(storage)));
+}
+
+MappedGridHeader BitGrid::makeHeader() const {
+    MappedGridHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAPPED_MAGIC, sizeof(MAPPED_MAGIC));
+    header.width = width;
+    header.height = height;
+    header.wordsPerRow = wordsPerRow;
+    header.generation = generation;
+    header.currentPlane = static_cast<std::uint32_t>(currentPlane);
+    header.birthMask = birthMask;
+    header.survivalMask = survivalMask;
+    header.flags = (toricMode ? FLAG_TORIC : 0u) | (hasObstacles() ? FLAG_OBSTACLES : 0u);
+    return header;
+}
+
+// ============================================================
+// Dimensions et accès aux cellules
+// ============================================================
+
+std::int64_t BitGrid::getWidth() const {
+    return width;
+}
+
+std::int64_t BitGrid::getHeight() const {
+    return height;
+}
+
+std::int64_t BitGrid::getWordsPerRow() const {
+    return wordsPerRow;
+}
+
+BitGrid::Word BitGrid::getTailMask() const {
+    int used = static_cast<int>(width % WORD_BITS);
+    return used == 0 ? ~Word(0) : ((Word(1) << used) - 1);
+}
+
+BitGrid::Word* BitGrid::row(std::int64_t y) {
+    return storage->plane(currentPlane) + y * wordsPerRow;
+}
+
+const BitGrid::Word* BitGrid::row(std::int64_t y) const {
+    return storage->plane(currentPlane) + y * wordsPerRow;
+}
+
+const BitGrid::Word* BitGrid::obstacleRow(std::int64_t y) const {
+    Word* obstacles = storage->plane(2);
+    return obstacles ? obstacles + y * wordsPerRow : nullptr;
+}
+
+bool BitGrid::isAlive(std::int64_t x, std::int64_t y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) return false;
+    return ((row(y)[x / WORD_BITS] >> (x % WORD_BITS)) & 1ULL) != 0;
+}
+
+void BitGrid::setAlive(std::int64_t x, std::int64_t y, bool alive) {
+    if (x < 0 || x >= width || y < 0 || y >= height) return;
+    Word bit = Word(1) << (x % WORD_BITS);
+    Word& word = row(y)[x / WORD_BITS];
+    word = alive ? (word | bit) : (word & ~bit);
+}
+
+bool BitGrid::isObstacle(std::int64_t x, std::int64_t y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) return false;
+    const Word* obstacles = obstacleRow(y);
+    return obstacles && ((obstacles[x / WORD_BITS] >> (x % WORD_BITS)) & 1ULL) != 0;
+}
+
+void BitGrid::setObstacle(std::int64_t x, std::int64_t y, bool obstacle) {
+    if (x < 0 || x >= width || y < 0 || y >= height) return;
+    if (!storage->hasObstaclePlane()) {
+        if (!obstacle) return;
+        if (!storage->addObstaclePlane()) {
+            std::cerr << "Erreur : Impossible d'ajouter le plan d'obstacles" << std::endl;
+            return;
+        }
+        firstTouch(2);
+    }
+    Word bit = Word(1) << (x % WORD_BITS);
+    Word& word = storage->plane(2)[y * wordsPerRow + x / WORD_BITS];
+    word = obstacle ? (word | bit) : (word & ~bit);
+}
+
+bool BitGrid::hasObstacles() const {
+    return storage->hasObstaclePlane();
+}
+
+// ============================================================
+// Paramètres de simulation
+// ============================================================
+
+void BitGrid::setRule(const Rule& rule) {
+    setRuleMasks(rule.getBirthMask(), rule.getSurvivalMask());
+}
+
+void BitGrid::setRuleMasks(std::uint16_t birth, std::uint16_t survival) {
+    birthMask = birth;
+    survivalMask = survival;
+    storage->commit(makeHeader());
+}
+
+std::uint16_t BitGrid::getBirthMask() const {
+    return birthMask;
+}
+
+std::uint16_t BitGrid::getSurvivalMask() const {
+    return survivalMask;
+}
+
+void BitGrid::setToricMode(bool enabled) {
+    toricMode = enabled;
+    storage->commit(makeHeader());
+}
+
+bool BitGrid::isToricMode() const {
+    return toricMode;
+}
+
+void BitGrid::setParallelMode(bool enabled) {
+    parallelMode = enabled;
+}
+
+bool BitGrid::isParallelMode() const {
+    return parallelMode;
+}
+
+std::int64_t BitGrid::getGeneration() const {
+    return generation;
+}
+
+void BitGrid::setGeneration(std::int64_t value) {
+    generation = value;
+    storage->commit(makeHeader());
+}
+
+bool BitGrid::isMapped() const {
+    return storage->isMapped();
+}
+
+bool BitGrid::usesHugePages() const {
+    return storage->usesHugePages();
+}
+
+const std::vector<WorkerTiming>& BitGrid::getLastStepTimings() const {
+    return lastStepTimings;
+}
+
+void BitGrid::setHeatMapEnabled(bool enabled, HeatMap::Resolution resolution) {
+    if (enabled) {
+        heatMap.reset(new HeatMap(width, height, resolution));
+    } else {
+        heatMap.reset();
+    }
+}
+
+const HeatMap* BitGrid::getHeatMap() const {
+    return heatMap.get();
+}
+
+// ============================================================
+// Calcul des générations
+// ============================================================
+
+void BitGrid::stepRow(const Word* above, const Word* current, const Word* below,
+                      const Word* obstacles, Word* out,
+                      std::int64_t wordsPerRow, std::int64_t width, bool toric,
+                      std::uint16_t birthMask, std::uint16_t survivalMask) {
+    const std::int64_t last = wordsPerRow - 1;
+    const int lastBit = static_cast<int>((width - 1) % WORD_BITS);
+    const Word tailMask = (lastBit == WORD_BITS - 1) ? ~Word(0) : ((Word(1) << (lastBit + 1)) - 1);
+
+    // Décalages : west[x] = cellule x-1, east[x] = cellule x+1 (0 hors grille)
+    auto west = [&](const Word* r, std::int64_t i) -> Word {
+        Word carry;
+        if (i > 0) {
+            carry = r[i - 1] >> (WORD_BITS - 1);
+        } else {
+            carry = toric ? (r[last] >> lastBit) & 1ULL : 0;
+        }
+        return (r[i] << 1) | carry;
+    };
+    auto east = [&](const Word* r, std::int64_t i) -> Word {
+        Word shifted = r[i] >> 1;
+        if (i < last) {
+            shifted |= r[i + 1] << (WORD_BITS - 1);
+        } else if (toric) {
+            shifted |= (r[0] & 1ULL) << lastBit;
+        }
+        return shifted;
+    };
+
+    for (std::int64_t i = 0; i < wordsPerRow; ++i) {
+        Word n[8];
+        int count = 0;
+        if (above) {
+            n[count++] = west(above, i);
+            n[count++] = above[i];
+            n[count++] = east(above, i);
+        }
+        n[count++] = west(current, i);
+        n[count++] = east(current, i);
+        if (below) {
+            n[count++] = west(below, i);
+            n[count++] = below[i];
+            n[count++] = east(below, i);
+        }
+        while (count < 8) {
+            n[count++] = 0;
+        }
+
+        // Additionneur bit à bit : (b3 b2 b1 b0) = nombre de voisins de chaque cellule
+        Word s0 = n[0] ^ n[1] ^ n[2];
+        Word c0 = (n[0] & n[1]) | (n[2] & (n[0] ^ n[1]));
+        Word s1 = n[3] ^ n[4] ^ n[5];
+        Word c1 = (n[3] & n[4]) | (n[5] & (n[3] ^ n[4]));
+        Word s2 = n[6] ^ n[7];
+        Word c2 = n[6] & n[7];
+
+        Word b0 = s0 ^ s1 ^ s2;
+        Word c3 = (s0 & s1) | (s2 & (s0 ^ s1));
+
+        Word t0 = c0 ^ c1 ^ c2;
+        Word t1 = (c0 & c1) | (c2 & (c0 ^ c1));
+        Word b1 = t0 ^ c3;
+        Word t2 = t0 & c3;
+
+        Word b2 = t1 ^ t2;
+        Word b3 = t1 & t2;
+
+        // Application de la règle : OU des cellules dont le compte est dans le masque
+        Word born = 0;
+        Word survive = 0;
+        for (int k = 0; k <= 8; ++k) {
+            bool inBirth = ((birthMask >> k) & 1u) != 0;
+            bool inSurvival = ((survivalMask >> k) & 1u) != 0;
+            if (!inBirth && !inSurvival) continue;
+
+            Word match = ((k & 1) ? b0 : ~b0) & ((k & 2) ? b1 : ~b1) &
+                         ((k & 4) ? b2 : ~b2) & ((k & 8) ? b3 : ~b3);
+            if (inBirth) born |= match;
+            if (inSurvival) survive |= match;
+        }
+
+        Word cell = current[i];
+        Word next = (~cell & born) | (cell & survive);
+
+        // Les obstacles gardent leur état
+        if (obstacles) {
+            next = (next & ~obstacles[i]) | (cell & obstacles[i]);
+        }
+        if (i == last) {
+            next &= tailMask;
+        }
+        out[i] = next;
+    }
+}
+
+template <typename Work>
+void BitGrid::forEachRowRange(std::int64_t firstRow, std::int64_t endRow, Work work,
+                              std::vector<WorkerTiming>* timings) const {
+    std::int64_t rows = endRow - firstRow;
+    unsigned int numThreads = 1;
+    if (parallelMode) {
+        numThreads = std::thread::hardware_concurrency();
+        if (numThreads == 0) numThreads = 4;  // Valeur par défaut
+        numThreads = static_cast<unsigned int>(std::min<std::int64_t>(
+            numThreads, std::max<std::int64_t>(rows / MIN_ROWS_PER_THREAD, 1)));
+    }
+
+    std::mutex timingsMutex;
+    auto runRange = [&](unsigned int worker, std::int64_t start, std::int64_t end) {
+        int node = (numThreads > 1) ? NumaTopology::get().pinWorker(worker, numThreads) : 0;
+        auto begin = std::chrono::steady_clock::now();
+        work(start, end);
+        if (timings) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            std::lock_guard<std::mutex> lock(timingsMutex);
+            timings->push_back(WorkerTiming{node, end - start, seconds});
+        }
+    };
+
+    if (numThreads <= 1) {
+        runRange(0, firstRow, endRow);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    std::int64_t rowsPerThread = rows / numThreads;
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        std::int64_t start = firstRow + i * rowsPerThread;
+        std::int64_t end = (i == numThreads - 1) ? endRow : start + rowsPerThread;
+        threads.emplace_back(runRange, i, start, end);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void BitGrid::firstTouch(int index) {
+    Word* words = storage->plane(index);
+    forEachRowRange(0, height, [this, words](std::int64_t start, std::int64_t end) {
+        std::fill(words + start * wordsPerRow, words + end * wordsPerRow, Word(0));
+    });
+}
+
+void BitGrid::computeRows(std::int64_t firstRow, std::int64_t endRow) {
+    const Word* cur = storage->plane(currentPlane);
+    Word* next = storage->plane(1 - currentPlane);
+    const Word* obstacles = storage->plane(2);
+
+    HeatMap* heat = heatMap.get();
+
+    auto computeRange = [this, cur, next, obstacles, heat](std::int64_t start, std::int64_t end) {
+        for (std::int64_t y = start; y < end; ++y) {
+            const Word* above = nullptr;
+            const Word* below = nullptr;
+            if (y > 0) {
+                above = cur + (y - 1) * wordsPerRow;
+            } else if (toricMode) {
+                above = cur + (height - 1) * wordsPerRow;
+            }
+            if (y < height - 1) {
+                below = cur + (y + 1) * wordsPerRow;
+            } else if (toricMode) {
+                below = cur;
+            }
+            stepRow(above, cur + y * wordsPerRow, below,
+                    obstacles ? obstacles + y * wordsPerRow : nullptr,
+                    next + y * wordsPerRow, wordsPerRow, width, toricMode,
+                    birthMask, survivalMask);
+            if (heat) {
+                heat->accumulateRow(y, cur + y * wordsPerRow, next + y * wordsPerRow, wordsPerRow);
+            }
+        }
+    };
+    if (!heat || heat->getTileSize() == 1) {
+        forEachRowRange(firstRow, endRow, computeRange, &lastStepTimings);
+        return;
+    }
+
+    // Tranches alignées sur les tuiles : une ligne de tuiles n'a qu'un thread
+    const std::int64_t tile = heat->getTileSize();
+    forEachRowRange(firstRow / tile, (endRow + tile - 1) / tile,
+                    [computeRange, firstRow, endRow, tile](std::int64_t start, std::int64_t end) {
+                        computeRange(std::max(firstRow, start * tile), std::min(endRow, end * tile));
+                    },
+                    &lastStepTimings);
+}
+
+void BitGrid::step() {
+    // En mémoire, une seule bande ; projeté, des bandes d'environ BAND_BYTES
+    std::int64_t bandRows = height;
+    if (storage->isMapped()) {
+        std::uint64_t rowBytes = static_cast<std::uint64_t>(wordsPerRow) * sizeof(Word);
+        bandRows = static_cast<std::int64_t>(std::max<std::uint64_t>(BAND_BYTES / rowBytes, 1));
+    }
+
+    lastStepTimings.clear();
+    for (std::int64_t first = 0; first < height; first += bandRows) {
+        std::int64_t end = std::min(height, first + bandRows);
+        storage->prepareBand(currentPlane, first, end);
+        computeRows(first, end);
+        storage->finishBand(currentPlane, first, end);
+    }
+
+    currentPlane = 1 - currentPlane;
+    generation++;
+    storage->commit(makeHeader());
+}
+
+void BitGrid::step(std::int64_t generations) {
+    for (std::int64_t i = 0; i < generations; ++i) {
+        step();
+    }
+}
+
+void BitGrid::clear() {
+    const Word* obstacles = storage->plane(2);
+    forEachRowRange(0, height, [this, obstacles](std::int64_t start, std::int64_t end) {
+        for (std::int64_t y = start; y < end; ++y) {
+            Word* r = row(y);
+            for (std::int64_t i = 0; i < wordsPerRow; ++i) {
+                r[i] = obstacles ? (r[i] & obstacles[y * wordsPerRow + i]) : 0;
+            }
+        }
+    });
+}
+
+void BitGrid::randomize(double probability, std::uint64_t seed) {
+    const std::uint32_t threshold = CounterRNG::quantizeProbability(probability);
+    const Word tailMask = getTailMask();
+    const Word* obstacles = storage->plane(2);
+
+    // Mêmes indices de mots que Grid::randomize()
+    forEachRowRange(0, height, [this, threshold, tailMask, obstacles, seed](std::int64_t start, std::int64_t end) {
+        for (std::int64_t y = start; y < end; ++y) {
+            Word* r = row(y);
+            for (std::int64_t wx = 0; wx < wordsPerRow; ++wx) {
+                std::uint64_t index = static_cast<std::uint64_t>(y) * wordsPerRow + wx;
+                Word word = CounterRNG::bernoulliWord(seed, index, threshold);
+                if (wx == wordsPerRow - 1) word &= tailMask;
+                if (obstacles) {
+                    Word obs = obstacles[y * wordsPerRow + wx];
+                    word = (word & ~obs) | (r[wx] & obs);
+                }
+                r[wx] = word;
+            }
+        }
+    });
+}
+
+void BitGrid::stamp(const PatternBitmap& pattern, std::int64_t x, std::int64_t y) {
+    stampRows(pattern, x, y, 0, height);
+}
+
+void BitGrid::stampRows(const PatternBitmap& pattern, std::int64_t x, std::int64_t y,
+                        std::int64_t firstRow, std::int64_t endRow) {
+    bool inside = x >= 0 && y >= 0 && x + pattern.width <= width && y + pattern.height <= height;
+
+    if (!inside) {
+        for (std::int64_t py = 0; py < pattern.height; ++py) {
+            std::int64_t cy = y + py;
+            if (toricMode) {
+                cy = ((cy % height) + height) % height;
+            }
+            if (cy < firstRow || cy >= endRow) continue;
+
+            const Word* source = pattern.row(py);
+            for (std::int64_t wx = 0; wx < pattern.wordsPerRow; ++wx) {
+                Word word = source[wx];
+                while (word != 0) {
+                    std::int64_t px = x + wx * WORD_BITS + __builtin_ctzll(word);
+                    word &= word - 1;
+                    if (toricMode) {
+                        px = ((px % width) + width) % width;
+                    }
+                    setAlive(px, cy, true);
+                }
+            }
+        }
+        return;
+    }
+
+    // Le motif est entièrement dans la grille : décalage puis OU, mot par mot
+    const std::int64_t base = x / WORD_BITS;
+    const int shift = static_cast<int>(x % WORD_BITS);
+    const std::int64_t firstLine = std::max<std::int64_t>(0, firstRow - y);
+    const std::int64_t endLine = std::min<std::int64_t>(pattern.height, endRow - y);
+    for (std::int64_t py = firstLine; py < endLine; ++py) {
+        const Word* source = pattern.row(py);
+        Word* target = row(y + py) + base;
+        for (std::int64_t wx = 0; wx < pattern.wordsPerRow; ++wx) {
+            Word word = source[wx];
+            target[wx] |= word << shift;
+            if (shift != 0) {
+                Word carry = word >> (WORD_BITS - shift);
+                if (carry != 0) {
+                    target[wx + 1] |= carry;
+                }
+            }
+        }
+    }
+}
+
+std::int64_t BitGrid::stampAll(const std::vector<PatternPlacement>& placements, bool parallel) {
+    // Une seule recherche par motif et orientation, hors des threads
+    std::vector<const PatternBitmap*> bitmaps = PatternRegistry::get().resolve(placements);
+    std::int64_t unknown = std::count(bitmaps.begin(), bitmaps.end(), nullptr);
+
+    auto stampBand = [this, &placements, &bitmaps](std::int64_t firstRow, std::int64_t endRow) {
+        for (size_t i = 0; i < placements.size(); ++i) {
+            if (bitmaps[i]) {
+                stampRows(*bitmaps[i], placements[i].x, placements[i].y, firstRow, endRow);
+            }
+        }
+    };
+
+    if (parallel && parallelMode) {
+        forEachRowRange(0, height, stampBand);
+    } else {
+        stampBand(0, height);
+    }
+    return unknown;
+}
+
+std::int64_t BitGrid::countLivingCells() const {
+    std::int64_t count = 0;
+    const Word* words = row(0);
+    std::uint64_t total = static_cast<std::uint64_t>(wordsPerRow) * static_cast<std::uint64_t>(height);
+    for (std::uint64_t i = 0; i < total; ++i) {
+        count += __builtin_popcountll(words[i]);
+    }
+    return count;
+}
+
+void BitGrid::countChanges(std::int64_t& births, std::int64_t& deaths) const {
+    const Word* current = storage->plane(currentPlane);
+    const Word* previous = storage->plane(1 - currentPlane);
+    std::atomic<std::int64_t> bornTotal(0);
+    std::atomic<std::int64_t> diedTotal(0);
+    forEachRowRange(0, height, [&](std::int64_t start, std::int64_t end) {
+        std::int64_t born = 0;
+        std::int64_t died = 0;
+        for (std::int64_t i = start * wordsPerRow; i < end * wordsPerRow; ++i) {
+            born += __builtin_popcountll(current[i] & ~previous[i]);
+            died += __builtin_popcountll(previous[i] & ~current[i]);
+        }
+        bornTotal += born;
+        diedTotal += died;
+    });
+    births = bornTotal;
+    deaths = diedTotal;
+}
+
+bool BitGrid::isEqual(const BitGrid& other) const {
+    if (width != other.width || height != other.height) {
+        return false;
+    }
+    std::uint64_t bytes = static_cast<std::uint64_t>(wordsPerRow) * height * sizeof(Word);
+    return std::memcmp(row(0), other.row(0), bytes) == 0;
+}
+
+std::uint64_t BitGrid::hash() const {
+    std::uint64_t h = CounterRNG::mix(static_cast<std::uint64_t>(width) * 0x9e3779b97f4a7c15ULL
+                                      ^ static_cast<std::uint64_t>(height));
+    const std::int64_t usedWords = (width + 63) / 64;
+    for (std::int64_t y = 0; y < height; ++y) {
+        const Word* words = row(y);
+        for (std::int64_t wx = 0; wx < usedWords; ++wx) {
+            h = CounterRNG::mix(h ^ words[wx]) + static_cast<std::uint64_t>(y);
+        }
+    }
+    return h;
+}
+
+bool BitGrid::fromGrid(const Grid& grid) {
+    if (grid.getWidth() != width || grid.getHeight() != height) {
+        if (storage->isMapped()) {
+            std::cerr << "Erreur : Dimensions incompatibles avec la grille projetée ("
+                      << grid.getWidth() << "x" << grid.getHeight() << " au lieu de "
+                      << width << "x" << height << ")" << std::endl;
+            return false;
+        }
+        *this = BitGrid(grid.getWidth(), grid.getHeight());
+    }
+
+    for (std::int64_t y = 0; y < height; ++y) {
+        Word* r = row(y);
+        std::fill(r, r + wordsPerRow, Word(0));
+        for (std::int64_t x = 0; x < width; ++x) {
+            const Cell& cell = grid.getCell(x, y);
+            if (cell.isAlive()) {
+                r[x / WORD_BITS] |= Word(1) << (x % WORD_BITS);
+            }
+            if (cell.isObstacle() || isObstacle(x, y)) {
+                setObstacle(x, y, cell.isObstacle());
+            }
+        }
+    }
+
+    toricMode = grid.isToricMode();
+    setRule(grid.getRule());
+    return true;
+}
+
+bool BitGrid::copyCells(const BitGrid& other) {
+    if (other.width != width || other.height != height) {
+        std::cerr << "Erreur : Dimensions incompatibles (" << other.width << "x" << other.height
+                  << " au lieu de " << width << "x" << height << ")" << std::endl;
+        return false;
+    }
+    if (other.hasObstacles() && !storage->hasObstaclePlane()) {
+        if (!storage->addObstaclePlane()) {
+            std::cerr << "Erreur : Impossible d'ajouter le plan d'obstacles" << std::endl;
+            return false;
+        }
+        firstTouch(2);
+    }
+
+    // Ligne par ligne : une grille projetée est écrite dans l'ordre du fichier
+    const std::size_t rowBytes = static_cast<std::size_t>(wordsPerRow) * sizeof(Word);
+    Word* obstacles = storage->plane(2);
+    for (std::int64_t y = 0; y < height; ++y) {
+        std::memcpy(row(y), other.row(y), rowBytes);
+        if (obstacles) {
+            const Word* source = other.obstacleRow(y);
+            if (source) {
+                std::memcpy(obstacles + y * wordsPerRow, source, rowBytes);
+            } else {
+                std::memset(obstacles + y * wordsPerRow, 0, rowBytes);
+            }
+        }
+    }
+
+    generation = other.generation;
+    birthMask = other.birthMask;
+    survivalMask = other.survivalMask;
+    toricMode = other.toricMode;
+    if (heatMap) {
+        heatMap->clear();
+    }
+    return true;
+}
+
+bool BitGrid::toGrid(Grid& grid) const {
+    if (grid.getWidth() != width || grid.getHeight() != height) {
+        if (!grid.resize(width, height)) {
+            return false;
+        }
+    }
+
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
+            Cell& cell = grid.getCell(x, y);
+            cell.setObstacle(isObstacle(x, y));
+            cell.setAlive(isAlive(x, y));
+        }
+    }
+    grid.setToricMode(toricMode);
+    return true;
+}
+
+bool BitGrid::sync() {
+    storage->commit(makeHeader());
+    if (!storage->sync()) {
+        std::cerr << "Erreur : Échec de l'écriture de la grille projetée" << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,518 @@
+#ifndef BITGRID_HPP
+#define BITGRID_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "HeatMap.hpp"
+
+// Déclarations anticipées
+class Grid;
+class Rule;
+struct PatternBitmap;
+struct PatternPlacement;
+
+/**
+ * @brief En-tête persistant d'une grille projetée (fichier .golmap)
+ *
+ * Le fichier contient l'en-tête (une page), puis les deux plans de bits
+ * (génération courante et suivante) et, si présent, le plan des obstacles.
+ * Après un sync(), le fichier sert de point de reprise.
+ */
+struct MappedGridHeader {
+    char magic[8];              // "GOLMAP1"
+    std::int64_t width;         // Largeur en cellules
+    std::int64_t height;        // Hauteur en cellules
+    std::int64_t wordsPerRow;   // Mots de 64 bits par ligne
+    std::int64_t generation;    // Génération du plan courant
+    std::uint32_t currentPlane; // Plan courant (0 ou 1)
+    std::uint16_t birthMask;    // Masque de naissance de la règle
+    std::uint16_t survivalMask; // Masque de survie de la règle
+    std::uint32_t flags;        // FLAG_TORIC | FLAG_OBSTACLES
+    std::uint32_t reserved;
+};
+
+/**
+ * @class PlaneStorage
+ * @brief Stockage des plans de bits d'une BitGrid (Pattern Strategy)
+ *
+ * Les plans 0 et 1 alternent entre génération courante et suivante,
+ * le plan 2 (optionnel) contient les obstacles. Les méthodes de bande
+ * permettent à un stockage sur disque de guider la pagination.
+ */
+class PlaneStorage {
+public:
+    virtual ~PlaneStorage() = default;
+
+    /**
+     * @brief Obtient un plan de bits
+     * @param index 0 ou 1 (générations), 2 (obstacles)
+     * @return Pointeur vers le premier mot du plan
+     */
+    virtual std::uint64_t* plane(int index) = 0;
+
+    /**
+     * @brief Vérifie si le plan des obstacles existe
+     * @return true si le plan 2 est alloué
+     */
+    virtual bool hasObstaclePlane() const = 0;
+
+    /**
+     * @brief Alloue le plan des obstacles (à zéro)
+     * @return true si le plan est disponible
+     */
+    virtual bool addObstaclePlane() = 0;
+
+    /**
+     * @brief Indique qu'une bande de lignes va être calculée
+     * @param currentPlane Plan lu pendant le calcul
+     * @param firstRow Première ligne de la bande
+     * @param endRow Ligne suivant la dernière ligne de la bande
+     */
+    virtual void prepareBand(int currentPlane, std::int64_t firstRow, std::int64_t endRow);
+
+    /**
+     * @brief Indique qu'une bande de lignes a été calculée
+     * @param currentPlane Plan lu pendant le calcul
+     * @param firstRow Première ligne de la bande
+     * @param endRow Ligne suivant la dernière ligne de la bande
+     */
+    virtual void finishBand(int currentPlane, std::int64_t firstRow, std::int64_t endRow);
+
+    /**
+     * @brief Enregistre l'état de la grille après une génération
+     * @param header État courant
+     */
+    virtual void commit(const MappedGridHeader& header);
+
+    /**
+     * @brief Force l'écriture des données sur disque
+     * @return true si la synchronisation a réussi
+     */
+    virtual bool sync();
+
+    /**
+     * @brief Vérifie si le stockage est un fichier projeté
+     * @return true pour un stockage hors mémoire
+     */
+    virtual bool isMapped() const;
+
+    /**
+     * @brief Vérifie si les plans sont en pages énormes
+     * @return true si le noyau a accepté les pages énormes
+     */
+    virtual bool usesHugePages() const;
+};
+
+/**
+ * @brief Mesure du travail d'un thread de calcul pendant une génération
+ */
+struct WorkerTiming {
+    int node;               // Nœud NUMA du thread
+    std::int64_t rows;      // Lignes calculées
+    double seconds;         // Durée du calcul
+};
+
+/**
+ * @class BitGrid
+ * @brief Grille compacte : une cellule par bit, lignes alignées sur 64 bits
+ *
+ * Moteur de calcul rapide complémentaire de Grid : le voisinage est compté
+ * 64 cellules à la fois par un additionneur bit à bit, et la règle est
+ * appliquée via ses masques naissance/survie. Les obstacles (plan optionnel)
+ * gardent leur état et comptent comme voisins lorsqu'ils sont vivants,
+ * exactement comme dans Grid.
+ *
+ * Les bits de remplissage au-delà de la largeur sont toujours à zéro.
+ */
+class BitGrid {
+public:
+    using Word = std::uint64_t;
+    static const int WORD_BITS = 64;
+
+    static const std::uint32_t FLAG_TORIC = 1u;      // Mode torique
+    static const std::uint32_t FLAG_OBSTACLES = 2u;  // Plan d'obstacles présent
+
+    /**
+     * @brief Constructeur (grille en mémoire, toutes les cellules mortes)
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     */
+    BitGrid(std::int64_t width, std::int64_t height);
+
+    /**
+     * @brief Constructeur par copie (la copie est toujours en mémoire)
+     * @param other Grille à copier
+     */
+    BitGrid(const BitGrid& other);
+
+    /**
+     * @brief Opérateur d'affectation (la copie est toujours en mémoire)
+     * @param other Grille à copier
+     * @return Référence vers cette grille
+     */
+    BitGrid& operator=(const BitGrid& other);
+
+    /**
+     * @brief Destructeur (synchronise un stockage projeté)
+     */
+    ~BitGrid();
+
+    /**
+     * @brief Crée une grille stockée dans un fichier projeté (hors mémoire)
+     * @param path Chemin du fichier (.golmap)
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @param withObstacles true pour réserver le plan des obstacles
+     * @return Grille créée, ou nullptr en cas d'erreur
+     */
+    static std::unique_ptr<BitGrid> createMapped(const std::string& path,
+                                                 std::int64_t width, std::int64_t height,
+                                                 bool withObstacles = false);
+
+    /**
+     * @brief Rouvre une grille projetée (reprise depuis le dernier point de reprise)
+     * @param path Chemin du fichier (.golmap)
+     * @return Grille ouverte, ou nullptr en cas d'erreur
+     */
+    static std::unique_ptr<BitGrid> openMapped(const std::string& path);
+
+    /**
+     * @brief Crée une grille sur un stockage fourni (ex: fichier binaire projeté)
+     *
+     * Le plan 0 est la génération courante ; le stockage doit garder les
+     * bits de remplissage à zéro.
+     *
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @param storage Plans de bits
+     * @return Grille créée, ou nullptr si les dimensions sont invalides
+     */
+    static std::unique_ptr<BitGrid> createWithStorage(std::int64_t width, std::int64_t height,
+                                                      std::unique_ptr<PlaneStorage> storage);
+
+    // ============================================================
+    // Dimensions et accès aux cellules
+    // ============================================================
+
+    std::int64_t getWidth() const;
+    std::int64_t getHeight() const;
+
+    /**
+     * @brief Obtient le nombre de mots de 64 bits par ligne
+     * @return Mots par ligne
+     */
+    std::int64_t getWordsPerRow() const;
+
+    /**
+     * @brief Obtient le masque des bits valides du dernier mot d'une ligne
+     * @return Masque (bits de remplissage à zéro)
+     */
+    Word getTailMask() const;
+
+    bool isAlive(std::int64_t x, std::int64_t y) const;
+    void setAlive(std::int64_t x, std::int64_t y, bool alive);
+    bool isObstacle(std::int64_t x, std::int64_t y) const;
+    void setObstacle(std::int64_t x, std::int64_t y, bool obstacle);
+
+    /**
+     * @brief Vérifie si la grille possède un plan d'obstacles
+     * @return true si des obstacles peuvent être présents
+     */
+    bool hasObstacles() const;
+
+    /**
+     * @brief Accède à une ligne de la génération courante
+     * @param y Numéro de ligne
+     * @return Pointeur vers les mots de la ligne
+     */
+    Word* row(std::int64_t y);
+    const Word* row(std::int64_t y) const;
+
+    /**
+     * @brief Accède à une ligne du plan des obstacles
+     * @param y Numéro de ligne
+     * @return Pointeur vers les mots de la ligne, ou nullptr sans obstacles
+     */
+    const Word* obstacleRow(std::int64_t y) const;
+
+    // ============================================================
+    // Paramètres de simulation
+    // ============================================================
+
+    /**
+     * @brief Utilise les masques d'une règle (Strategy pattern)
+     * @param rule Règle à appliquer
+     */
+    void setRule(const Rule& rule);
+
+    /**
+     * @brief Définit directement les masques naissance/survie
+     * @param birth Bit n : naissance avec n voisins
+     * @param survival Bit n : survie avec n voisins
+     */
+    void setRuleMasks(std::uint16_t birth, std::uint16_t survival);
+
+    std::uint16_t getBirthMask() const;
+    std::uint16_t getSurvivalMask() const;
+
+    void setToricMode(bool enabled);
+    bool isToricMode() const;
+
+    /**
+     * @brief Active ou désactive le calcul multi-thread
+     * @param enabled true pour activer
+     */
+    void setParallelMode(bool enabled);
+    bool isParallelMode() const;
+
+    /**
+     * @brief Obtient le numéro de la génération courante
+     * @return Génération
+     */
+    std::int64_t getGeneration() const;
+
+    /**
+     * @brief Définit le numéro de génération
+     * @param generation Génération
+     */
+    void setGeneration(std::int64_t generation);
+
+    /**
+     * @brief Vérifie si la grille est stockée dans un fichier projeté
+     * @return true pour une grille hors mémoire
+     */
+    bool isMapped() const;
+
+    /**
+     * @brief Vérifie si les plans en mémoire utilisent des pages énormes
+     * @return true si le noyau a accepté les pages énormes
+     */
+    bool usesHugePages() const;
+
+    /**
+     * @brief Obtient la mesure de chaque thread pour la dernière génération
+     * @return Mesures (une par tranche de lignes, toutes bandes confondues)
+     */
+    const std::vector<WorkerTiming>& getLastStepTimings() const;
+
+    /**
+     * @brief Active ou désactive la carte d'activité
+     *
+     * Active, chaque génération incrémente le compteur des cellules (ou des
+     * tuiles) qui ont changé d'état, ligne par ligne dans le noyau. Réactiver
+     * repart de zéro.
+     *
+     * @param enabled true pour activer
+     * @param resolution Un compteur par cellule ou par tuile
+     */
+    void setHeatMapEnabled(bool enabled, HeatMap::Resolution resolution = HeatMap::Resolution::CELL);
+
+    /**
+     * @brief Obtient la carte d'activité
+     * @return Carte, ou nullptr si désactivée
+     */
+    const HeatMap* getHeatMap() const;
+
+    // ============================================================
+    // Opérations
+    // ============================================================
+
+    /**
+     * @brief Calcule la génération suivante (par bandes de lignes)
+     */
+    void step();
+
+    /**
+     * @brief Calcule plusieurs générations
+     * @param generations Nombre de générations
+     */
+    void step(std::int64_t generations);
+
+    /**
+     * @brief Tue toutes les cellules (hors obstacles)
+     */
+    void clear();
+
+    /**
+     * @brief Remplit la grille avec une soupe reproductible
+     *
+     * Même tirage que Grid::randomize() : pour une graine donnée,
+     * les deux grilles sont identiques.
+     *
+     * @param probability Probabilité qu'une cellule soit vivante
+     * @param seed Graine du générateur
+     */
+    void randomize(double probability, std::uint64_t seed);
+
+    /**
+     * @brief Pose un motif par OU de mots entiers
+     *
+     * Un motif qui dépasse un bord est replié (mode torique) ou tronqué,
+     * cellule par cellule.
+     *
+     * @param pattern Motif compact
+     * @param x Colonne du coin supérieur gauche
+     * @param y Ligne du coin supérieur gauche
+     */
+    void stamp(const PatternBitmap& pattern, std::int64_t x, std::int64_t y);
+
+    /**
+     * @brief Pose une liste de motifs en une passe (orientations en cache)
+     *
+     * En mode parallèle, la grille est découpée en bandes de lignes : chaque
+     * thread pose la partie de chaque motif qui tombe dans sa bande.
+     *
+     * @param placements Poses (motif, orientation, position)
+     * @param parallel true pour répartir les bandes entre les threads
+     * @return Nombre de poses dont le motif est inconnu
+     */
+    std::int64_t stampAll(const std::vector<PatternPlacement>& placements, bool parallel = false);
+
+    /**
+     * @brief Compte les cellules vivantes (popcount)
+     * @return Nombre de cellules vivantes
+     */
+    std::int64_t countLivingCells() const;
+
+    /**
+     * @brief Compte les naissances et les morts de la dernière génération
+     *
+     * Compare le plan courant au plan précédent : valable juste après step(),
+     * avant toute modification directe des cellules.
+     *
+     * @param births Sortie : cellules nées
+     * @param deaths Sortie : cellules mortes
+     */
+    void countChanges(std::int64_t& births, std::int64_t& deaths) const;
+
+    /**
+     * @brief Compare les cellules vivantes de deux grilles
+     * @param other Grille à comparer
+     * @return true si dimensions et cellules sont identiques
+     */
+    bool isEqual(const BitGrid& other) const;
+
+    /**
+     * @brief Calcule l'empreinte des cellules vivantes
+     *
+     * Même algorithme que GridView::hash : une BitGrid et la Grid
+     * correspondante ont la même empreinte.
+     *
+     * @return Empreinte sur 64 bits
+     */
+    std::uint64_t hash() const;
+
+    /**
+     * @brief Copie l'état d'une Grid (cellules, obstacles, règle, mode torique)
+     * @param grid Grille source
+     * @return false si les dimensions ne correspondent pas (grille projetée)
+     */
+    bool fromGrid(const Grid& grid);
+
+    /**
+     * @brief Copie l'état d'une autre BitGrid dans le stockage actuel, mot par mot
+     *
+     * Contrairement à l'affectation, le stockage est conservé : une grille
+     * projetée reçoit les cellules dans son fichier.
+     *
+     * @param other Grille source (mêmes dimensions)
+     * @return false si les dimensions diffèrent ou si les obstacles ne peuvent pas être copiés
+     */
+    bool copyCells(const BitGrid& other);
+
+    /**
+     * @brief Copie l'état vers une Grid (redimensionnée si nécessaire)
+     * @param grid Grille destination
+     * @return false si la grille destination ne peut pas être allouée
+     */
+    bool toGrid(Grid& grid) const;
+
+    /**
+     * @brief Écrit l'état sur disque (grille projetée) : point de reprise
+     * @return true si la synchronisation a réussi
+     */
+    bool sync();
+
+    /**
+     * @brief Calcule une ligne de la génération suivante (noyau bit à bit)
+     *
+     * @param above Ligne du dessus (nullptr = ligne morte)
+     * @param current Ligne courante
+     * @param below Ligne du dessous (nullptr = ligne morte)
+     * @param obstacles Ligne d'obstacles (nullptr = aucun)
+     * @param out Ligne résultat
+     * @param wordsPerRow Mots par ligne
+     * @param width Largeur en cellules
+     * @param toric true si les bords gauche/droite sont reliés
+     * @param birthMask Masque de naissance
+     * @param survivalMask Masque de survie
+     */
+    static void stepRow(const Word* above, const Word* current, const Word* below,
+                        const Word* obstacles, Word* out,
+                        std::int64_t wordsPerRow, std::int64_t width, bool toric,
+                        std::uint16_t birthMask, std::uint16_t survivalMask);
+
+private:
+    std::int64_t width;
+    std::int64_t height;
+    std::int64_t wordsPerRow;
+    std::unique_ptr<PlaneStorage> storage;  // Plans de bits (mémoire ou fichier)
+    int currentPlane;                       // Plan de la génération courante (0 ou 1)
+    std::int64_t generation;
+    std::uint16_t birthMask;
+    std::uint16_t survivalMask;
+    bool toricMode;
+    bool parallelMode;
+    std::vector<WorkerTiming> lastStepTimings;  // Mesures de la dernière génération
+    std::unique_ptr<HeatMap> heatMap;           // Carte d'activité (optionnelle)
+
+    /**
+     * @brief Constructeur interne avec un stockage existant
+     */
+    BitGrid(std::int64_t width, std::int64_t height, std::unique_ptr<PlaneStorage> storage);
+
+    /**
+     * @brief Construit l'en-tête persistant de l'état courant
+     * @return En-tête
+     */
+    MappedGridHeader makeHeader() const;
+
+    /**
+     * @brief Calcule les lignes [firstRow, endRow) de la génération suivante
+     */
+    void computeRows(std::int64_t firstRow, std::int64_t endRow);
+
+    /**
+     * @brief Pose la partie d'un motif comprise dans les lignes [firstRow, endRow)
+     */
+    void stampRows(const PatternBitmap& pattern, std::int64_t x, std::int64_t y,
+                   std::int64_t firstRow, std::int64_t endRow);
+
+    /**
+     * @brief Écrit un plan en mémoire depuis les threads qui le calculeront
+     *
+     * Premier accès : chaque page est placée sur le nœud NUMA de son thread.
+     *
+     * @param index Plan à initialiser
+     */
+    void firstTouch(int index);
+
+    /**
+     * @brief Exécute une fonction sur des tranches de lignes en parallèle
+     *
+     * Le découpage ne dépend que du nombre de lignes : une même tranche est
+     * toujours traitée par le même thread, fixé sur le même nœud NUMA.
+     *
+     * @param firstRow Première ligne
+     * @param endRow Ligne suivant la dernière
+     * @param work Fonction appelée avec (début, fin) pour chaque tranche
+     * @param timings Si non nul, reçoit la mesure de chaque tranche
+     */
+    template <typename Work>
+    void forEachRowRange(std::int64_t firstRow, std::int64_t endRow, Work work,
+                         std::vector<WorkerTiming>* timings = nullptr) const;
+};
+
+#endif // BITGRID_HPP
@@ -0,0 +1,48 @@
+#include "CounterRNG.hpp"
+#include <random>
+
+std::uint64_t CounterRNG::mix(std::uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+std::uint64_t CounterRNG::at(std::uint64_t seed, std::uint64_t counter) {
+    // Flux SplitMix64 indexé : l'état après "counter" pas vaut seed + (counter+1) * gamma
+    return mix(seed + (counter + 1) * 0x9e3779b97f4a7c15ULL);
+}
+
+std::uint32_t CounterRNG::quantizeProbability(double probability) {
+    if (!(probability > 0.0)) return 0;
+    if (probability >= 1.0) return 1u << DENSITY_BITS;
+    return static_cast<std::uint32_t>(probability * (1u << DENSITY_BITS) + 0.5);
+}
+
+std::uint64_t CounterRNG::bernoulliWord(std::uint64_t seed, std::uint64_t wordIndex,
+                                        std::uint32_t threshold) {
+    if (threshold == 0) return 0;
+    if (threshold >= (1u << DENSITY_BITS)) return ~0ULL;
+
+    // Chaque mot consomme DENSITY_BITS positions du flux
+    std::uint64_t counter = wordIndex * DENSITY_BITS;
+    std::uint64_t word = 0;
+
+    // Les bits nuls de poids faible laissent le mot à 0 : on les saute
+    int bit = 0;
+    while (((threshold >> bit) & 1u) == 0) {
+        ++bit;
+    }
+
+    // Du poids faible au poids fort : P' = (1 + P) / 2 pour un 1, P / 2 pour un 0
+    for (; bit < DENSITY_BITS; ++bit) {
+        std::uint64_t r = at(seed, counter + bit);
+        word = ((threshold >> bit) & 1u) ? (word | r) : (word & r);
+    }
+
+    return word;
+}
+
+std::uint64_t CounterRNG::randomSeed() {
+    std::random_device rd;
+    return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+}
@@ -0,0 +1,66 @@
+#ifndef COUNTERRNG_HPP
+#define COUNTERRNG_HPP
+
+#include <cstdint>
+
+/**
+ * @class CounterRNG
+ * @brief Générateur pseudo-aléatoire à compteur (style SplitMix64)
+ *
+ * Chaque mot aléatoire est une fonction pure de (graine, compteur) : il n'y a
+ * aucun état partagé entre threads. Le mot de 64 cellules d'indice i est donc
+ * toujours le même pour une graine donnée, quel que soit le nombre de threads
+ * qui remplissent la grille.
+ */
+class CounterRNG {
+public:
+    /**
+     * @brief Précision (en bits) de la densité utilisée par bernoulliWord()
+     */
+    static const int DENSITY_BITS = 16;
+
+    /**
+     * @brief Fonction de mélange de SplitMix64 (bijection sur 64 bits)
+     * @param value Valeur à mélanger
+     * @return Valeur mélangée
+     */
+    static std::uint64_t mix(std::uint64_t value);
+
+    /**
+     * @brief Obtient le mot aléatoire associé à un compteur
+     * @param seed Graine du flux
+     * @param counter Position dans le flux
+     * @return Mot de 64 bits uniformément distribué
+     */
+    static std::uint64_t at(std::uint64_t seed, std::uint64_t counter);
+
+    /**
+     * @brief Convertit une probabilité en seuil à virgule fixe
+     * @param probability Probabilité (0.0 à 1.0, bornée)
+     * @return Seuil sur DENSITY_BITS bits (0 à 2^DENSITY_BITS)
+     */
+    static std::uint32_t quantizeProbability(double probability);
+
+    /**
+     * @brief Génère 64 bits indépendants valant 1 avec la probabilité donnée
+     *
+     * La densité est obtenue sans comparaison flottante : les bits du seuil
+     * sont parcourus du poids faible au poids fort en combinant des mots
+     * aléatoires par OU (bit à 1) ou par ET (bit à 0).
+     *
+     * @param seed Graine du flux
+     * @param wordIndex Indice du mot de 64 cellules
+     * @param threshold Seuil retourné par quantizeProbability()
+     * @return Mot de 64 cellules
+     */
+    static std::uint64_t bernoulliWord(std::uint64_t seed, std::uint64_t wordIndex,
+                                       std::uint32_t threshold);
+
+    /**
+     * @brief Tire une graine depuis la source d'entropie du système
+     * @return Nouvelle graine
+     */
+    static std::uint64_t randomSeed();
+};
+
+#endif // COUNTERRNG_HPP
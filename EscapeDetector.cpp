@@ -0,0 +1,255 @@
+#include "EscapeDetector.hpp"
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Écart suffisant entre deux objets qui se déplacent ensemble (convoi)
+ */
+const std::int64_t CONVOY_GAP = 2;
+
+/**
+ * @brief Boîte englobante et vitesse (déplacement par période) d'un objet
+ */
+struct Track {
+    std::int64_t minX;
+    std::int64_t minY;
+    std::int64_t maxX;
+    std::int64_t maxY;
+    std::int64_t dx;
+    std::int64_t dy;
+    std::int64_t period;
+};
+
+/**
+ * @brief Vérifie que deux objets ont la même vitesse (dx/p, dy/p)
+ */
+bool sameVelocity(const Track& a, const Track& b) {
+    return a.dx * b.period == b.dx * a.period && a.dy * b.period == b.dy * a.period;
+}
+
+/**
+ * @brief Vérifie que deux boîtes sont séparées de plus de gap cellules sur un axe
+ */
+bool separated(const Track& a, const Track& b, std::int64_t gap) {
+    return a.minX > b.maxX + gap || a.maxX < b.minX - gap ||
+           a.minY > b.maxY + gap || a.maxY < b.minY - gap;
+}
+
+/**
+ * @brief Vérifie que deux objets ne peuvent plus se rencontrer
+ *
+ * Vrai si ship est au-delà de other (marge comprise) sur un axe et que leur
+ * vitesse relative sur cet axe les éloigne, ou s'ils ne se touchent pas et se
+ * déplacent ensemble (planeurs successifs d'un canon).
+ */
+bool driftsApart(const Track& ship, const Track& other, std::int64_t margin) {
+    // Signe de la vitesse relative : dx/p - dx'/p' a le signe de dx*p' - dx'*p
+    const std::int64_t relativeX = ship.dx * other.period - other.dx * ship.period;
+    const std::int64_t relativeY = ship.dy * other.period - other.dy * ship.period;
+
+    const bool right = ship.minX > other.maxX + margin;
+    const bool left = ship.maxX < other.minX - margin;
+    const bool below = ship.minY > other.maxY + margin;
+    const bool above = ship.maxY < other.minY - margin;
+
+    if ((right && relativeX > 0) || (left && relativeX < 0) ||
+        (below && relativeY > 0) || (above && relativeY < 0)) {
+        return true;
+    }
+    if (relativeX != 0 || relativeY != 0) {
+        return false;
+    }
+
+    // Même vitesse : l'écart ne change plus, il suffit qu'ils ne se touchent pas
+    return separated(ship, other, CONVOY_GAP);
+}
+
+/**
+ * @brief Construit la trajectoire d'un objet classé
+ */
+Track makeTrack(const DetectedObject& object, const ObjectClass& type) {
+    Track track;
+    track.minX = object.x;
+    track.minY = object.y;
+    track.maxX = object.x + object.shape.width - 1;
+    track.maxY = object.y + object.shape.height - 1;
+    track.dx = type.kind == ObjectKind::SPACESHIP ? type.dx : 0;
+    track.dy = type.kind == ObjectKind::SPACESHIP ? type.dy : 0;
+    track.period = std::max(1, type.period);
+    return track;
+}
+
+/**
+ * @brief Appelle visit(x, y) pour chaque cellule vivante d'un objet
+ */
+template <typename Visit>
+void forEachCell(const DetectedObject& object, Visit visit) {
+    for (std::int64_t y = 0; y < object.shape.height; ++y) {
+        const std::uint64_t* row = object.shape.row(y);
+        for (std::int64_t wx = 0; wx < object.shape.wordsPerRow; ++wx) {
+            std::uint64_t word = row[wx];
+            while (word != 0) {
+                visit(object.x + wx * 64 + __builtin_ctzll(word), object.y + y);
+                word &= word - 1;
+            }
+        }
+    }
+}
+
+} // namespace
+
+EscapeDetector::EscapeDetector(std::int64_t margin)
+    : margin(std::max<std::int64_t>(0, margin)), shipsLeave(false), remainingPeriod(1) {
+}
+
+std::vector<DetectedObject> EscapeDetector::collect(const BitGrid& grid, std::int64_t generation, bool parallel) {
+    std::vector<const ObjectClass*> classes;
+    std::vector<DetectedObject> objects = census.identify(grid, classes, parallel);
+
+    // Les objets immobiles sont résumés par une seule boîte
+    std::vector<size_t> ships;
+    bool hasStill = false;
+    Track still = {0, 0, 0, 0, 0, 0, 1};
+    for (size_t i = 0; i < objects.size(); ++i) {
+        if (classes[i]->kind == ObjectKind::SPACESHIP) {
+            ships.push_back(i);
+            continue;
+        }
+        Track track = makeTrack(objects[i], *classes[i]);
+        if (!hasStill) {
+            still = track;
+            hasStill = true;
+        } else {
+            still.minX = std::min(still.minX, track.minX);
+            still.minY = std::min(still.minY, track.minY);
+            still.maxX = std::max(still.maxX, track.maxX);
+            still.maxY = std::max(still.maxY, track.maxY);
+        }
+    }
+
+    // Les vaisseaux de même vitesse trop proches pour être séparés (planeurs en
+    // file) forment un groupe, jugé sur sa boîte commune
+    std::vector<Track> groups;
+    std::vector<std::vector<size_t>> members;
+    for (size_t s : ships) {
+        groups.push_back(makeTrack(objects[s], *classes[s]));
+        members.push_back({s});
+    }
+    for (bool merged = true; merged;) {
+        merged = false;
+        for (size_t a = 0; a < groups.size() && !merged; ++a) {
+            for (size_t b = a + 1; b < groups.size() && !merged; ++b) {
+                if (!sameVelocity(groups[a], groups[b]) || separated(groups[a], groups[b], CONVOY_GAP)) {
+                    continue;
+                }
+                groups[a].minX = std::min(groups[a].minX, groups[b].minX);
+                groups[a].minY = std::min(groups[a].minY, groups[b].minY);
+                groups[a].maxX = std::max(groups[a].maxX, groups[b].maxX);
+                groups[a].maxY = std::max(groups[a].maxY, groups[b].maxY);
+                members[a].insert(members[a].end(), members[b].begin(), members[b].end());
+                groups.erase(groups.begin() + b);
+                members.erase(members.begin() + b);
+                merged = true;
+            }
+        }
+    }
+
+    // Un groupe conservé qui s'éloigne déjà de tout, sans la marge, ne rencontrera plus rien
+    std::vector<size_t> escaping;
+    bool allLeave = true;
+    for (size_t g = 0; g < groups.size(); ++g) {
+        bool escapes = !hasStill || driftsApart(groups[g], still, margin);
+        bool leaves = !hasStill || driftsApart(groups[g], still, 0);
+        for (size_t k = 0; k < groups.size(); ++k) {
+            if (k != g) {
+                escapes = escapes && driftsApart(groups[g], groups[k], margin);
+                leaves = leaves && driftsApart(groups[g], groups[k], 0);
+            }
+        }
+        if (escapes) {
+            escaping.insert(escaping.end(), members[g].begin(), members[g].end());
+        } else {
+            allLeave = allLeave && leaves;
+        }
+    }
+
+    // État final : des vaisseaux conservés qui s'éloignent, le reste immobile ou oscillant
+    shipsLeave = allLeave && escaping.size() < ships.size();
+    remainingPeriod = 1;
+    for (size_t i = 0; i < objects.size() && shipsLeave; ++i) {
+        if (classes[i]->kind == ObjectKind::OTHER) {
+            shipsLeave = false;
+        } else if (std::find(escaping.begin(), escaping.end(), i) == escaping.end()) {
+            const std::int64_t period = std::max(1, classes[i]->period);
+            std::int64_t a = remainingPeriod, b = period;
+            while (b != 0) {
+                std::int64_t r = a % b;
+                a = b;
+                b = r;
+            }
+            remainingPeriod = remainingPeriod / a * period;
+        }
+    }
+
+    // Retraits enregistrés dans l'ordre de découverte des objets
+    std::sort(escaping.begin(), escaping.end());
+    std::vector<DetectedObject> leaving;
+    for (size_t s : escaping) {
+        escaped.push_back({*classes[s], generation, objects[s].x, objects[s].y});
+        leaving.push_back(objects[s]);
+    }
+    return leaving;
+}
+
+std::int64_t EscapeDetector::removeEscaping(BitGrid& grid, std::int64_t generation, bool parallel) {
+    std::vector<DetectedObject> leaving = collect(grid, generation, parallel);
+    for (const DetectedObject& ship : leaving) {
+        forEachCell(ship, [&grid](std::int64_t x, std::int64_t y) {
+            grid.setAlive(x, y, false);
+        });
+    }
+    return static_cast<std::int64_t>(leaving.size());
+}
+
+std::int64_t EscapeDetector::removeEscaping(Grid& grid, std::int64_t generation, bool parallel) {
+    BitGrid packed(grid.getWidth(), grid.getHeight());
+    packed.fromGrid(grid);
+    std::vector<DetectedObject> leaving = collect(packed, generation, parallel);
+    for (const DetectedObject& ship : leaving) {
+        forEachCell(ship, [&grid](std::int64_t x, std::int64_t y) {
+            Cell& cell = grid.getCell(x, y);
+            if (!cell.isObstacle()) {
+                cell.setAlive(false);
+            }
+        });
+    }
+    return static_cast<std::int64_t>(leaving.size());
+}
+
+const std::vector<EscapedShip>& EscapeDetector::getEscaped() const {
+    return escaped;
+}
+
+std::vector<CensusEntry> EscapeDetector::getCensus() const {
+    std::vector<const ObjectClass*> classes;
+    classes.reserve(escaped.size());
+    for (const EscapedShip& ship : escaped) {
+        classes.push_back(&ship.type);
+    }
+    return ObjectCensus::tally(classes);
+}
+
+void EscapeDetector::clear() {
+    escaped.clear();
+}
+
+bool EscapeDetector::remainingShipsLeave() const {
+    return shipsLeave;
+}
+
+std::int64_t EscapeDetector::getRemainingPeriod() const {
+    return remainingPeriod;
+}
@@ -0,0 +1,120 @@
+#ifndef ESCAPEDETECTOR_HPP
+#define ESCAPEDETECTOR_HPP
+
+#include <cstdint>
+#include <vector>
+#include "ObjectCensus.hpp"
+
+// Déclarations anticipées
+class BitGrid;
+class Grid;
+
+/**
+ * @brief Vaisseau retiré de la grille
+ */
+struct EscapedShip {
+    ObjectClass type;          // Classification (code, nom, période, déplacement)
+    std::int64_t generation;   // Génération du retrait
+    std::int64_t x;            // Coin supérieur gauche au moment du retrait
+    std::int64_t y;
+};
+
+/**
+ * @class EscapeDetector
+ * @brief Repère les vaisseaux qui s'éloignent définitivement et les retire
+ *
+ * Un vaisseau s'échappe lorsque, face à chaque autre objet, il est déjà au-delà
+ * de lui (avec une marge) sur un axe et s'en éloigne sur cet axe : les
+ * trajectoires étant rectilignes, ils ne se rencontreront plus. Les objets
+ * immobiles sont résumés par leur boîte englobante commune ; les vaisseaux
+ * de même vitesse presque au contact (planeurs qui se suivent) forment un
+ * groupe qui part ou reste d'un bloc.
+ *
+ * Les vaisseaux retirés sont enregistrés : la grille se stabilise plus tôt
+ * sans perdre l'information de ce qui en est sorti. Sur une grille torique,
+ * le critère est appliqué sans tenir compte du repliement des bords.
+ */
+class EscapeDetector {
+public:
+    /**
+     * @brief Écart minimal (en cellules) entre un vaisseau et les autres objets
+     */
+    static const std::int64_t DEFAULT_MARGIN = 8;
+
+    /**
+     * @brief Constructeur
+     * @param margin Écart minimal avant de considérer un vaisseau comme parti
+     */
+    explicit EscapeDetector(std::int64_t margin = DEFAULT_MARGIN);
+
+    /**
+     * @brief Retire les vaisseaux qui s'échappent d'une grille compacte
+     * @param grid Grille compacte
+     * @param generation Génération courante (enregistrée avec chaque vaisseau)
+     * @param parallel true pour découper et classer en parallèle
+     * @return Nombre de vaisseaux retirés
+     */
+    std::int64_t removeEscaping(BitGrid& grid, std::int64_t generation, bool parallel = true);
+
+    /**
+     * @brief Retire les vaisseaux qui s'échappent d'une grille
+     * @param grid Grille
+     * @param generation Génération courante
+     * @param parallel true pour découper et classer en parallèle
+     * @return Nombre de vaisseaux retirés
+     */
+    std::int64_t removeEscaping(Grid& grid, std::int64_t generation, bool parallel = true);
+
+    /**
+     * @brief Obtient les vaisseaux retirés depuis le dernier clear()
+     * @return Vaisseaux, dans l'ordre des retraits
+     */
+    const std::vector<EscapedShip>& getEscaped() const;
+
+    /**
+     * @brief Regroupe les vaisseaux retirés par type
+     * @return Types de vaisseaux, du plus fréquent au plus rare
+     */
+    std::vector<CensusEntry> getCensus() const;
+
+    /**
+     * @brief Oublie les vaisseaux enregistrés
+     */
+    void clear();
+
+    /**
+     * @brief Indique si la dernière recherche a trouvé un état final en vol
+     *
+     * Vrai si des vaisseaux restent sur la grille (trop près pour la marge)
+     * mais s'éloignent déjà de tous les autres objets, et si le reste est
+     * immobile ou oscillant : la grille ne se répétera plus, mais plus rien ne
+     * se rencontrera.
+     *
+     * @return true dans cet état
+     */
+    bool remainingShipsLeave() const;
+
+    /**
+     * @brief Période commune des objets restants (valable si remainingShipsLeave())
+     * @return Plus petit multiple commun de leurs périodes
+     */
+    std::int64_t getRemainingPeriod() const;
+
+private:
+    std::int64_t margin;
+    ObjectCensus census;               // Classification (avec son cache)
+    std::vector<EscapedShip> escaped;  // Vaisseaux retirés
+    bool shipsLeave;                   // Dernière recherche : état final en vol
+    std::int64_t remainingPeriod;      // Période commune des objets restants
+
+    /**
+     * @brief Repère les vaisseaux qui s'échappent et les enregistre
+     * @param grid Grille compacte
+     * @param generation Génération courante
+     * @param parallel true pour travailler en parallèle
+     * @return Objets à effacer
+     */
+    std::vector<DetectedObject> collect(const BitGrid& grid, std::int64_t generation, bool parallel);
+};
+
+#endif // ESCAPEDETECTOR_HPP
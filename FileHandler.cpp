@@ -1,10 +1,24 @@
 #include "FileHandler.hpp"
 #include "Grid.hpp"
+#include "GridView.hpp"
+#include "BitGrid.hpp"
+#include "TextGridParser.hpp"
+#include "TextGridWriter.hpp"
+#include "RLEGridParser.hpp"
+#include "RLEGridWriter.hpp"
+#include "MacrocellTree.hpp"
+#include "GridSnapshot.hpp"
+#include "HugePageBuffer.hpp"
+#include "MappedFile.hpp"
+#include "Rule.hpp"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
 #include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 
 #ifdef _WIN32
 #include <direct.h>
@@ -19,77 +33,91 @@
 #endif
 
 // ============================================================
-// Implémentation de StandardFileHandler
+// Implémentation de IFileHandler
 // ============================================================
 
-bool StandardFileHandler::load(const std::string& filename, Grid& grid) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Erreur : Impossible d'ouvrir le fichier " << filename << std::endl;
+bool IFileHandler::saveView(const std::string& filename, const GridView& view) {
+    Grid copy(1, 1);
+    if (!view.toGrid(copy)) {
         return false;
     }
+    return save(filename, copy);
+}
 
-    // Format de l'énoncé : "lignes colonnes" (hauteur largeur)
-    int height, width;
-    if (!(file >> height >> width)) {
-        std::cerr << "Erreur : Format de fichier invalide (dimensions)" << std::endl;
+bool IFileHandler::saveBitGrid(const std::string& filename, const BitGrid& grid) {
+    Grid copy(1, 1);
+    if (!grid.toGrid(copy)) {
         return false;
     }
+    return save(filename, copy);
+}
 
-    if (width <= 0 || height <= 0) {
-        std::cerr << "Erreur : Dimensions invalides (" << width << "x" << height << ")" << std::endl;
-        return false;
+std::unique_ptr<BitGrid> IFileHandler::loadBitGrid(const std::string& filename) {
+    Grid grid(1, 1);
+    if (!load(filename, grid)) {
+        return nullptr;
+    }
+    std::unique_ptr<BitGrid> bits(new BitGrid(1, 1));
+    if (!bits->fromGrid(grid)) {
+        return nullptr;
     }
+    return bits;
+}
 
-    grid.resize(width, height);
+// ============================================================
+// Implémentation de StandardFileHandler
+// ============================================================
 
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            int value;
-            if (!(file >> value)) {
-                std::cerr << "Erreur : Données insuffisantes à la ligne " << y << std::endl;
-                return false;
-            }
-            // Support étendu : 0=mort, 1=vivant, 2=obstacle mort, 3=obstacle vivant
-            bool alive = (value == 1 || value == 3);
-            bool obstacle = (value == 2 || value == 3);
-            grid.getCell(x, y).setAlive(alive);
-            grid.getCell(x, y).setObstacle(obstacle);
-        }
+bool StandardFileHandler::load(const std::string& filename, Grid& grid) {
+    if (SparseFileHandler::isSparseFile(filename)) {
+        return SparseFileHandler().load(filename, grid);
     }
+    // Format de l'énoncé : "lignes colonnes" (hauteur largeur), lu par TextGridParser
+    TextGridParser parser;
+    return parser.parse(filename) && parser.toGrid(grid);
+}
 
-    file.close();
-    return true;
+std::unique_ptr<BitGrid> StandardFileHandler::loadBitGrid(const std::string& filename) {
+    if (SparseFileHandler::isSparseFile(filename)) {
+        return SparseFileHandler().loadBitGrid(filename);
+    }
+    TextGridParser parser;
+    return parser.parse(filename) ? parser.toBitGrid() : nullptr;
 }
 
-bool StandardFileHandler::save(const std::string& filename, const Grid& grid) {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Erreur : Impossible de créer le fichier " << filename << std::endl;
+bool StandardFileHandler::saveBitGrid(const std::string& filename, const BitGrid& grid) {
+    if (!grid.hasObstacles() &&
+        SparseFileHandler::prefersSparse(grid.countLivingCells(), grid.getWidth(), grid.getHeight())) {
+        return SparseFileHandler::writeFile(filename, grid.getWidth(), grid.getHeight(), grid.row(0));
+    }
+    TextGridWriter writer;
+    if (!writer.write(filename, grid)) {
         return false;
     }
+    std::cout << "Fichier sauvegardé : " << filename << std::endl;
+    return true;
+}
 
-    // Format de l'énoncé : "lignes colonnes" (hauteur largeur)
-    file << grid.getHeight() << " " << grid.getWidth() << std::endl;
+bool StandardFileHandler::save(const std::string& filename, const Grid& grid) {
+    return saveView(filename, GridView(grid));
+}
 
-    for (int y = 0; y < grid.getHeight(); ++y) {
-        for (int x = 0; x < grid.getWidth(); ++x) {
-            const Cell& cell = grid.getCell(x, y);
-            int value;
-            if (cell.isObstacle()) {
-                value = cell.isAlive() ? 3 : 2;  // Obstacle vivant ou mort
-            } else {
-                value = cell.isAlive() ? 1 : 0;  // Cellule normale
-            }
-            file << value;
-            if (x < grid.getWidth() - 1) {
-                file << " ";
-            }
+bool StandardFileHandler::saveView(const std::string& filename, const GridView& view) {
+    // Grande grille presque vide : liste des cellules (le plan d'obstacles tranche à la capture)
+    if (SparseFileHandler::prefersSparse(view.countLivingCells(), view.getWidth(), view.getHeight())) {
+        GridSnapshot snapshot;
+        snapshot.capture(view);
+        if (!snapshot.hasObstacles()) {
+            return SparseFileHandler::writeFile(filename, snapshot.getWidth(), snapshot.getHeight(),
+                                                snapshot.aliveRow(0));
         }
-        file << std::endl;
     }
 
-    file.close();
+    // Format de l'énoncé : "lignes colonnes" (hauteur largeur), écrit en un bloc
+    TextGridWriter writer;
+    if (!writer.write(filename, view)) {
+        return false;
+    }
     std::cout << "Fichier sauvegardé : " << filename << std::endl;
     return true;
 }
@@ -109,272 +137,572 @@ std::vector<std::string> StandardFileHandler::getSupportedExtensions() const {
 // ============================================================
 
 bool ExtendedFileHandler::load(const std::string& filename, Grid& grid) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Erreur : Impossible d'ouvrir le fichier " << filename << std::endl;
-        return false;
-    }
+    // Même format que StandardFileHandler : 0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant
+    TextGridParser parser;
+    return parser.parse(filename) && parser.toGrid(grid);
+}
 
-    // Format : "lignes colonnes" (hauteur largeur)
-    int height, width;
-    if (!(file >> height >> width)) {
-        std::cerr << "Erreur : Format de fichier invalide" << std::endl;
-        return false;
-    }
+std::unique_ptr<BitGrid> ExtendedFileHandler::loadBitGrid(const std::string& filename) {
+    TextGridParser parser;
+    return parser.parse(filename) ? parser.toBitGrid() : nullptr;
+}
 
-    if (width <= 0 || height <= 0) {
-        std::cerr << "Erreur : Dimensions invalides" << std::endl;
-        return false;
+bool ExtendedFileHandler::saveBitGrid(const std::string& filename, const BitGrid& grid) {
+    TextGridWriter writer;
+    return writer.write(filename, grid);
+}
+
+bool ExtendedFileHandler::save(const std::string& filename, const Grid& grid) {
+    return saveView(filename, GridView(grid));
+}
+
+bool ExtendedFileHandler::saveView(const std::string& filename, const GridView& view) {
+    // Même format que StandardFileHandler, sans message de confirmation
+    TextGridWriter writer;
+    return writer.write(filename, view);
+}
+
+bool ExtendedFileHandler::supportsFormat(const std::string& filename) const {
+    std::string ext = DirectoryManager::getExtension(filename);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".gol" || ext == ".ext";
+}
+
+std::vector<std::string> ExtendedFileHandler::getSupportedExtensions() const {
+    return {".gol", ".ext"};
+}
+
+// ============================================================
+// Implémentation de RLEFileHandler
+// ============================================================
+
+bool RLEFileHandler::load(const std::string& filename, Grid& grid) {
+    // Décodage en flux : les plages sont posées ligne par ligne, sans liste de cellules
+    RLEGridParser parser;
+    return parser.parse(filename) && parser.toGrid(grid);
+}
+
+std::unique_ptr<BitGrid> RLEFileHandler::loadBitGrid(const std::string& filename) {
+    RLEGridParser parser;
+    return parser.parse(filename) ? parser.toBitGrid() : nullptr;
+}
+
+bool RLEFileHandler::save(const std::string& filename, const Grid& grid) {
+    return saveView(filename, GridView(grid));
+}
+
+bool RLEFileHandler::saveView(const std::string& filename, const GridView& view) {
+    RLEGridWriter writer;
+    return writer.write(filename, view);
+}
+
+bool RLEFileHandler::saveBitGrid(const std::string& filename, const BitGrid& grid) {
+    RLEGridWriter writer;
+    return writer.write(filename, grid);
+}
+
+bool RLEFileHandler::supportsFormat(const std::string& filename) const {
+    std::string ext = DirectoryManager::getExtension(filename);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".rle";
+}
+
+std::vector<std::string> RLEFileHandler::getSupportedExtensions() const {
+    return {".rle"};
+}
+
+// ============================================================
+// Implémentation de BinaryFileHandler
+// ============================================================
+
+namespace {
+
+/**
+ * @brief En-tête d'un fichier .golb (HEADER_BYTES octets)
+ */
+struct BinaryGridHeader {
+    char magic[8];              // "GOLBIN1"
+    std::int64_t width;         // Largeur en cellules
+    std::int64_t height;        // Hauteur en cellules
+    std::int64_t generation;    // Génération enregistrée
+    std::uint32_t flags;        // BitGrid::FLAG_TORIC | BitGrid::FLAG_OBSTACLES
+    std::uint32_t reserved;
+    char rule[24];              // Notation B/S, complétée par des zéros
+};
+
+static_assert(sizeof(BinaryGridHeader) == BinaryFileHandler::HEADER_BYTES,
+              "L'en-tête binaire doit garder les lignes alignées");
+
+/**
+ * @class PackedFilePlaneStorage
+ * @brief Plans d'une BitGrid dont la génération courante est un fichier .golb projeté
+ *
+ * Le fichier est projeté en copie sur écriture : les pages sont lues à la
+ * demande et ne sont copiées que si la grille les modifie ; le fichier
+ * n'est jamais réécrit. Le plan suivant (et les obstacles absents du
+ * fichier) sont en mémoire anonyme.
+ */
+class PackedFilePlaneStorage : public PlaneStorage {
+public:
+    explicit PackedFilePlaneStorage(std::uint64_t planeBytes)
+        : planeBytes(planeBytes), obstaclesInFile(false) {
     }
 
-    grid.resize(width, height);
+    bool open(const std::string& path, bool withObstacles) {
+        if (!file.open(path, MappedFile::Mode::COPY_ON_WRITE)) return false;
+        obstaclesInFile = withObstacles;
+        if (file.size() < BinaryFileHandler::HEADER_BYTES + planeBytes * (withObstacles ? 2 : 1)) {
+            std::cerr << "Erreur : Fichier binaire tronqué " << path << std::endl;
+            return false;
+        }
+        file.advise(0, file.size(), MappedFile::Advice::SEQUENTIAL);
+        if (!next.allocate(planeBytes)) {
+            std::cerr << "Erreur : Mémoire insuffisante pour charger " << path << std::endl;
+            return false;
+        }
+        return true;
+    }
 
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            int value;
-            if (!(file >> value)) {
-                std::cerr << "Erreur : Données insuffisantes" << std::endl;
-                return false;
-            }
-            
-            // Interpréter la valeur étendue
-            // 0 = mort, 1 = vivant, 2 = obstacle mort, 3 = obstacle vivant
-            bool alive = (value == 1 || value == 3);
-            bool obstacle = (value == 2 || value == 3);
-            
-            grid.getCell(x, y).setAlive(alive);
-            grid.getCell(x, y).setObstacle(obstacle);
+    std::uint64_t* plane(int index) override {
+        if (index == 0 || (index == 2 && obstaclesInFile)) {
+            const std::uint64_t offset = BinaryFileHandler::HEADER_BYTES + (index == 2 ? planeBytes : 0);
+            return reinterpret_cast<std::uint64_t*>(file.data() + offset);
         }
+        return static_cast<std::uint64_t*>(index == 1 ? next.data() : extraObstacles.data());
     }
 
-    file.close();
-    return true;
-}
+    bool hasObstaclePlane() const override {
+        return obstaclesInFile || extraObstacles.data() != nullptr;
+    }
 
-bool ExtendedFileHandler::save(const std::string& filename, const Grid& grid) {
-    std::ofstream file(filename);
+    bool addObstaclePlane() override {
+        return hasObstaclePlane() || extraObstacles.allocate(planeBytes);
+    }
+
+private:
+    std::uint64_t planeBytes;
+    bool obstaclesInFile;
+    MappedFile file;
+    HugePageBuffer next;
+    HugePageBuffer extraObstacles;
+};
+
+} // namespace
+
+const char BinaryFileHandler::MAGIC[8] = {'G', 'O', 'L', 'B', 'I', 'N', '1', '\0'};
+
+bool BinaryFileHandler::writeFile(const std::string& filename, std::int64_t width, std::int64_t height,
+                                  std::int64_t generation, bool toric, const std::string& rule,
+                                  const std::uint64_t* alive, const std::uint64_t* obstacles) {
+    BinaryGridHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.width = width;
+    header.height = height;
+    header.generation = generation;
+    header.flags = (toric ? BitGrid::FLAG_TORIC : 0u) | (obstacles ? BitGrid::FLAG_OBSTACLES : 0u);
+    std::memcpy(header.rule, rule.data(), std::min(rule.size(), sizeof(header.rule) - 1));
+
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         std::cerr << "Erreur : Impossible de créer le fichier " << filename << std::endl;
         return false;
     }
 
-    // Format : "lignes colonnes" (hauteur largeur)
-    file << grid.getHeight() << " " << grid.getWidth() << std::endl;
+    // L'en-tête reste dans le tampon du flux : il part avec le premier plan
+    const std::streamsize planeBytes = static_cast<std::streamsize>(
+        (width + BitGrid::WORD_BITS - 1) / BitGrid::WORD_BITS * height * sizeof(std::uint64_t));
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(alive), planeBytes);
+    if (obstacles) {
+        file.write(reinterpret_cast<const char*>(obstacles), planeBytes);
+    }
+    if (!file) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        return false;
+    }
+    std::cout << "Fichier sauvegardé : " << filename << std::endl;
+    return true;
+}
 
-    for (int y = 0; y < grid.getHeight(); ++y) {
-        for (int x = 0; x < grid.getWidth(); ++x) {
-            const Cell& cell = grid.getCell(x, y);
-            int value = 0;
-            if (cell.isObstacle()) {
-                value = cell.isAlive() ? 3 : 2;
-            } else {
-                value = cell.isAlive() ? 1 : 0;
-            }
-            file << value;
-            if (x < grid.getWidth() - 1) {
-                file << " ";
-            }
-        }
-        file << std::endl;
+std::unique_ptr<BitGrid> BinaryFileHandler::loadBitGrid(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    BinaryGridHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        std::cerr << "Erreur : " << filename << " n'est pas une grille binaire" << std::endl;
+        return nullptr;
+    }
+    in.close();
+
+    header.rule[sizeof(header.rule) - 1] = '\0';
+    std::unique_ptr<Rule> rule = RuleFactory::createFromString(header.rule);
+    const std::int64_t maxRows = std::numeric_limits<std::int64_t>::max() / 8;
+    if (header.width <= 0 || header.height <= 0 || header.width > maxRows ||
+        header.height > maxRows / ((header.width + BitGrid::WORD_BITS - 1) / BitGrid::WORD_BITS) || !rule) {
+        std::cerr << "Erreur : En-tête de grille binaire invalide dans " << filename << std::endl;
+        return nullptr;
     }
 
-    file.close();
+    const std::uint64_t planeBytes = static_cast<std::uint64_t>(
+        (header.width + BitGrid::WORD_BITS - 1) / BitGrid::WORD_BITS * header.height) * sizeof(std::uint64_t);
+    std::unique_ptr<PackedFilePlaneStorage> storage(new PackedFilePlaneStorage(planeBytes));
+    if (!storage->open(filename, (header.flags & BitGrid::FLAG_OBSTACLES) != 0)) {
+        return nullptr;
+    }
+
+    std::unique_ptr<BitGrid> grid = BitGrid::createWithStorage(header.width, header.height, std::move(storage));
+    if (!grid) return nullptr;
+    grid->setGeneration(header.generation);
+    grid->setRule(*rule);
+    grid->setToricMode((header.flags & BitGrid::FLAG_TORIC) != 0);
+    return grid;
+}
+
+bool BinaryFileHandler::saveBitGrid(const std::string& filename, const BitGrid& grid) {
+    return writeFile(filename, grid.getWidth(), grid.getHeight(), grid.getGeneration(), grid.isToricMode(),
+                     RuleFactory::toNotation(grid.getBirthMask(), grid.getSurvivalMask()),
+                     grid.row(0), grid.hasObstacles() ? grid.obstacleRow(0) : nullptr);
+}
+
+bool BinaryFileHandler::load(const std::string& filename, Grid& grid) {
+    std::unique_ptr<BitGrid> bits = loadBitGrid(filename);
+    if (!bits || !bits->toGrid(grid)) {
+        return false;
+    }
+    // Règle et mode torique de l'en-tête
+    grid.setToricMode(bits->isToricMode());
+    grid.setRule(RuleFactory::createFromString(
+        RuleFactory::toNotation(bits->getBirthMask(), bits->getSurvivalMask())));
     return true;
 }
 
-bool ExtendedFileHandler::supportsFormat(const std::string& filename) const {
+bool BinaryFileHandler::save(const std::string& filename, const Grid& grid) {
+    return saveView(filename, GridView(grid));
+}
+
+bool BinaryFileHandler::saveView(const std::string& filename, const GridView& view) {
+    GridSnapshot snapshot;
+    snapshot.capture(view);
+    const Grid& parent = view.getGrid();
+    return writeFile(filename, snapshot.getWidth(), snapshot.getHeight(), 0, parent.isToricMode(),
+                     RuleFactory::toNotation(parent.getRule()), snapshot.aliveRow(0), snapshot.obstacleRow(0));
+}
+
+bool BinaryFileHandler::supportsFormat(const std::string& filename) const {
     std::string ext = DirectoryManager::getExtension(filename);
     std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-    return ext == ".gol" || ext == ".ext";
+    return ext == ".golb";
 }
 
-std::vector<std::string> ExtendedFileHandler::getSupportedExtensions() const {
-    return {".gol", ".ext"};
+std::vector<std::string> BinaryFileHandler::getSupportedExtensions() const {
+    return {".golb"};
 }
 
 // ============================================================
-// Implémentation de RLEFileHandler
+// Implémentation de MacrocellFileHandler
 // ============================================================
 
-bool RLEFileHandler::load(const std::string& filename, Grid& grid) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Erreur : Impossible d'ouvrir le fichier " << filename << std::endl;
+std::unique_ptr<BitGrid> MacrocellFileHandler::loadBitGrid(const std::string& filename) {
+    MacrocellTree tree;
+    return tree.parse(filename) ? tree.toBitGrid() : nullptr;
+}
+
+bool MacrocellFileHandler::saveBitGrid(const std::string& filename, const BitGrid& grid) {
+    MacrocellTree tree;
+    tree.build(grid.getWidth(), grid.getHeight(), grid.row(0));
+    return tree.write(filename, RuleFactory::toNotation(grid.getBirthMask(), grid.getSurvivalMask()),
+                      grid.getGeneration());
+}
+
+bool MacrocellFileHandler::load(const std::string& filename, Grid& grid) {
+    std::unique_ptr<BitGrid> bits = loadBitGrid(filename);
+    if (!bits || !bits->toGrid(grid)) {
         return false;
     }
+    // Règle et mode torique de l'en-tête
+    grid.setToricMode(bits->isToricMode());
+    grid.setRule(RuleFactory::createFromString(
+        RuleFactory::toNotation(bits->getBirthMask(), bits->getSurvivalMask())));
+    return true;
+}
 
-    std::string line;
-    int width = 0, height = 0;
-    std::string rleData;
-
-    // Lire les métadonnées
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-        
-        // Ignorer les commentaires
-        if (line[0] == '#') continue;
-
-        // Chercher la ligne x = ..., y = ...
-        if (line[0] == 'x') {
-            std::istringstream iss(line);
-            char c;
-            while (iss >> c) {
-                if (c == 'x') {
-                    iss >> c; // '='
-                    iss >> width;
-                } else if (c == 'y') {
-                    iss >> c; // '='
-                    iss >> height;
-                }
-            }
-            continue;
-        }
+bool MacrocellFileHandler::save(const std::string& filename, const Grid& grid) {
+    return saveView(filename, GridView(grid));
+}
 
-        // Accumuler les données RLE
-        rleData += line;
-    }
+bool MacrocellFileHandler::saveView(const std::string& filename, const GridView& view) {
+    GridSnapshot snapshot;
+    snapshot.capture(view);
+    MacrocellTree tree;
+    tree.build(snapshot.getWidth(), snapshot.getHeight(), snapshot.aliveRow(0));
+    return tree.write(filename, RuleFactory::toNotation(view.getGrid().getRule()), 0);
+}
+
+bool MacrocellFileHandler::supportsFormat(const std::string& filename) const {
+    std::string ext = DirectoryManager::getExtension(filename);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".mc";
+}
+
+std::vector<std::string> MacrocellFileHandler::getSupportedExtensions() const {
+    return {".mc"};
+}
 
-    file.close();
+// ============================================================
+// Implémentation de SparseFileHandler
+// ============================================================
+
+namespace {
+
+/**
+ * @brief Écrit un entier en décimal, retourne la fin
+ */
+char* appendInteger(char* out, std::int64_t value) {
+    char digits[24];
+    int length = 0;
+    std::uint64_t v = value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+    do {
+        digits[length++] = static_cast<char>('0' + v % 10);
+        v /= 10;
+    } while (v != 0);
+    if (value < 0) *out++ = '-';
+    while (length > 0) *out++ = digits[--length];
+    return out;
+}
 
-    if (width <= 0 || height <= 0) {
-        std::cerr << "Erreur : Dimensions non trouvées dans le fichier RLE" << std::endl;
+/**
+ * @brief Lit un entier signé sur une ligne
+ * @return false si le jeton n'est pas un entier (ou dépasse limit en valeur absolue)
+ */
+bool readCoordinate(const char*& p, const char* end, std::int64_t limit, std::int64_t& value) {
+    while (p < end && (*p == ' ' || *p == '\t')) ++p;
+    const bool negative = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+')) ++p;
+    if (p == end || !std::isdigit(static_cast<unsigned char>(*p))) {
         return false;
     }
+    std::int64_t v = 0;
+    while (p < end && std::isdigit(static_cast<unsigned char>(*p))) {
+        v = v * 10 + (*p++ - '0');
+        if (v > limit) return false;
+    }
+    value = negative ? -v : v;
+    return true;
+}
 
-    grid.resize(width, height);
-    grid.clear();
+/**
+ * @brief Lit un fichier Life 1.06 : cellules ramenées dans la grille
+ * @param filename Chemin du fichier
+ * @param width Sortie : largeur (ligne "#Size" ou boîte englobante)
+ * @param height Sortie : hauteur
+ * @param cells Sortie : cellules vivantes dans la grille
+ * @return false si le fichier est absent ou mal formé (message sur std::cerr)
+ */
+bool readSparseCells(const std::string& filename, std::int64_t& width, std::int64_t& height,
+                     std::vector<std::pair<std::int64_t, std::int64_t>>& cells) {
+    MappedFile file;
+    if (!file.open(filename, MappedFile::Mode::READ_ONLY)) {
+        return false;  // Message déjà affiché par MappedFile
+    }
+    const char* p = reinterpret_cast<const char*>(file.data());
+    const char* end = p + file.size();
+    const std::size_t headerLength = std::strlen(SparseFileHandler::HEADER);
+    if (file.size() < headerLength || std::memcmp(p, SparseFileHandler::HEADER, headerLength) != 0) {
+        std::cerr << "Erreur : " << filename << " n'est pas un fichier Life 1.06" << std::endl;
+        return false;
+    }
 
-    // Décoder le RLE
-    auto cells = decodeRLE(rleData);
-    for (const auto& pos : cells) {
-        if (pos.first >= 0 && pos.first < width && 
-            pos.second >= 0 && pos.second < height) {
-            grid.getCell(pos.first, pos.second).setAlive(true);
+    // Coordonnées bornées : les différences et la boîte englobante ne débordent pas
+    const std::int64_t LIMIT = std::numeric_limits<std::int64_t>::max() / 4;
+    width = height = 0;
+    cells.clear();
+    std::int64_t lineNumber = 0;
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!lineEnd) lineEnd = end;
+        ++lineNumber;
+
+        const char* q = p;
+        while (q < lineEnd && std::isspace(static_cast<unsigned char>(*q))) ++q;
+        if (q < lineEnd && *q == '#') {
+            // "#Size x = largeur, y = hauteur", ligne entière ; les autres commentaires
+            // ("#D" description, "#N"...) sont ignorés
+            long long w = 0, h = 0;
+            int consumed = -1;
+            std::string line(q, lineEnd);
+            while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back()))) line.pop_back();
+            if (std::sscanf(line.c_str(), "#Size x = %lld, y = %lld%n", &w, &h, &consumed) == 2 &&
+                consumed == static_cast<int>(line.size()) && w > 0 && h > 0 && w <= LIMIT && h <= LIMIT) {
+                width = w;
+                height = h;
+            }
+        } else if (q < lineEnd) {
+            std::int64_t x = 0, y = 0;
+            if (!readCoordinate(q, lineEnd, LIMIT, x) || !readCoordinate(q, lineEnd, LIMIT, y)) {
+                std::cerr << "Erreur : Coordonnées invalides à la ligne " << lineNumber << std::endl;
+                return false;
+            }
+            cells.emplace_back(x, y);
         }
+        p = lineEnd + (lineEnd < end ? 1 : 0);
     }
 
+    if (width > 0 && height > 0) {
+        // Dimensions connues : les cellules hors de la grille sont ignorées
+        cells.erase(std::remove_if(cells.begin(), cells.end(),
+                                   [width, height](const std::pair<std::int64_t, std::int64_t>& c) {
+                                       return c.first < 0 || c.second < 0 || c.first >= width || c.second >= height;
+                                   }),
+                    cells.end());
+        return true;
+    }
+    if (cells.empty()) {
+        std::cerr << "Erreur : Fichier Life 1.06 vide et sans dimensions" << std::endl;
+        return false;
+    }
+
+    // Sans dimensions : boîte englobante, ramenée en (0, 0)
+    std::int64_t minX = cells[0].first, maxX = minX, minY = cells[0].second, maxY = minY;
+    for (const auto& c : cells) {
+        minX = std::min(minX, c.first);
+        maxX = std::max(maxX, c.first);
+        minY = std::min(minY, c.second);
+        maxY = std::max(maxY, c.second);
+    }
+    for (auto& c : cells) {
+        c.first -= minX;
+        c.second -= minY;
+    }
+    width = maxX - minX + 1;
+    height = maxY - minY + 1;
     return true;
 }
 
-std::vector<std::pair<int, int>> RLEFileHandler::decodeRLE(const std::string& encoded) const {
-    std::vector<std::pair<int, int>> cells;
-    int x = 0, y = 0;
-    int count = 0;
-
-    for (char c : encoded) {
-        if (std::isdigit(c)) {
-            count = count * 10 + (c - '0');
-        } else {
-            if (count == 0) count = 1;
-
-            if (c == 'b' || c == '.') {
-                // Cellules mortes
-                x += count;
-            } else if (c == 'o' || c == 'O') {
-                // Cellules vivantes
-                for (int i = 0; i < count; ++i) {
-                    cells.push_back({x + i, y});
-                }
-                x += count;
-            } else if (c == '$') {
-                // Fin de ligne
-                y += count;
-                x = 0;
-            } else if (c == '!') {
-                // Fin du pattern
-                break;
-            }
-            count = 0;
-        }
-    }
+/**
+ * @brief Prévient que le format Life 1.06 ne garde pas les obstacles
+ */
+void warnObstaclesLost(const std::string& filename) {
+    std::cerr << "Avertissement : Les obstacles ne sont pas enregistrés dans " << filename
+              << " (format Life 1.06)" << std::endl;
+}
 
-    return cells;
+} // namespace
+
+const char SparseFileHandler::HEADER[] = "#Life 1.06";
+constexpr double SparseFileHandler::SPARSE_DENSITY;
+
+bool SparseFileHandler::prefersSparse(std::int64_t population, std::int64_t width, std::int64_t height) {
+    const double area = static_cast<double>(width) * static_cast<double>(height);
+    return area >= static_cast<double>(SPARSE_MIN_CELLS) && static_cast<double>(population) < SPARSE_DENSITY * area;
 }
 
-bool RLEFileHandler::save(const std::string& filename, const Grid& grid) {
-    std::ofstream file(filename);
+bool SparseFileHandler::isSparseFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char start[sizeof(HEADER) - 1];
+    return file.read(start, sizeof(start)) && std::memcmp(start, HEADER, sizeof(start)) == 0;
+}
+
+bool SparseFileHandler::writeFile(const std::string& filename, std::int64_t width, std::int64_t height,
+                                  const std::uint64_t* alive) {
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         std::cerr << "Erreur : Impossible de créer le fichier " << filename << std::endl;
         return false;
     }
 
-    // En-tête
-    file << "#C Generated by Game of Life" << std::endl;
-    file << "x = " << grid.getWidth() << ", y = " << grid.getHeight() << std::endl;
+    // Une ligne par bit à 1 : les mots nuls ne coûtent qu'une comparaison
+    const std::size_t FLUSH_BYTES = 1024 * 1024;
+    const std::size_t MAX_LINE = 2 * 24 + 2;
+    std::vector<char> buffer(FLUSH_BYTES + MAX_LINE);
+    const std::string header = std::string(HEADER) + "\n#Size x = " + std::to_string(width) +
+                               ", y = " + std::to_string(height) + "\n";
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    const std::int64_t wordsPerRow = (width + BitGrid::WORD_BITS - 1) / BitGrid::WORD_BITS;
+    char* out = buffer.data();
+    for (std::int64_t y = 0; y < height && file; ++y) {
+        const std::uint64_t* row = alive + y * wordsPerRow;
+        for (std::int64_t i = 0; i < wordsPerRow; ++i) {
+            for (std::uint64_t bits = row[i]; bits != 0; bits &= bits - 1) {
+                out = appendInteger(out, i * BitGrid::WORD_BITS + __builtin_ctzll(bits));
+                *out++ = ' ';
+                out = appendInteger(out, y);
+                *out++ = '\n';
+                if (static_cast<std::size_t>(out - buffer.data()) >= FLUSH_BYTES) {
+                    file.write(buffer.data(), out - buffer.data());
+                    out = buffer.data();
+                }
+            }
+        }
+    }
+    file.write(buffer.data(), out - buffer.data());
+    if (!file) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        return false;
+    }
+    std::cout << "Fichier sauvegardé : " << filename << std::endl;
+    return true;
+}
 
-    // Encoder le contenu
-    file << encodeRLE(grid) << std::endl;
+std::unique_ptr<BitGrid> SparseFileHandler::loadBitGrid(const std::string& filename) {
+    std::int64_t width = 0, height = 0;
+    std::vector<std::pair<std::int64_t, std::int64_t>> cells;
+    if (!readSparseCells(filename, width, height, cells)) {
+        return nullptr;
+    }
+    std::unique_ptr<BitGrid> grid;
+    try {
+        grid.reset(new BitGrid(width, height));
+    } catch (const std::exception&) {
+        std::cerr << "Erreur : Mémoire insuffisante pour une grille " << width << "x" << height << std::endl;
+        return nullptr;
+    }
+    for (const auto& c : cells) {
+        grid->setAlive(c.first, c.second, true);
+    }
+    return grid;
+}
 
-    file.close();
+bool SparseFileHandler::load(const std::string& filename, Grid& grid) {
+    std::int64_t width = 0, height = 0;
+    std::vector<std::pair<std::int64_t, std::int64_t>> cells;
+    if (!readSparseCells(filename, width, height, cells) || !grid.resize(width, height)) {
+        return false;
+    }
+    for (const auto& c : cells) {
+        grid.getCell(c.first, c.second).setAlive(true);
+    }
     return true;
 }
 
-std::string RLEFileHandler::encodeRLE(const Grid& grid) const {
-    std::ostringstream oss;
-    int lineLength = 0;
-    const int MAX_LINE_LENGTH = 70;
-
-    for (int y = 0; y < grid.getHeight(); ++y) {
-        int runCount = 0;
-        char runChar = '\0';
-
-        for (int x = 0; x < grid.getWidth(); ++x) {
-            char currentChar = grid.getCell(x, y).isAlive() ? 'o' : 'b';
-            
-            if (currentChar == runChar) {
-                runCount++;
-            } else {
-                if (runCount > 0) {
-                    std::string token;
-                    if (runCount > 1) {
-                        token = std::to_string(runCount) + runChar;
-                    } else {
-                        token = std::string(1, runChar);
-                    }
-                    
-                    if (lineLength + token.length() > MAX_LINE_LENGTH) {
-                        oss << std::endl;
-                        lineLength = 0;
-                    }
-                    oss << token;
-                    lineLength += token.length();
-                }
-                runChar = currentChar;
-                runCount = 1;
-            }
-        }
+bool SparseFileHandler::saveBitGrid(const std::string& filename, const BitGrid& grid) {
+    if (grid.hasObstacles()) {
+        warnObstaclesLost(filename);
+    }
+    return writeFile(filename, grid.getWidth(), grid.getHeight(), grid.row(0));
+}
 
-        // Écrire le dernier run de la ligne (sauf si ce sont des cellules mortes à la fin)
-        if (runCount > 0 && runChar == 'o') {
-            std::string token;
-            if (runCount > 1) {
-                token = std::to_string(runCount) + runChar;
-            } else {
-                token = std::string(1, runChar);
-            }
-            oss << token;
-            lineLength += token.length();
-        }
+bool SparseFileHandler::save(const std::string& filename, const Grid& grid) {
+    return saveView(filename, GridView(grid));
+}
 
-        // Fin de ligne (sauf dernière ligne)
-        if (y < grid.getHeight() - 1) {
-            oss << "$";
-            lineLength++;
-        }
+bool SparseFileHandler::saveView(const std::string& filename, const GridView& view) {
+    GridSnapshot snapshot;
+    snapshot.capture(view);
+    if (snapshot.hasObstacles()) {
+        warnObstaclesLost(filename);
     }
-
-    oss << "!";
-    return oss.str();
+    return writeFile(filename, snapshot.getWidth(), snapshot.getHeight(), snapshot.aliveRow(0));
 }
 
-bool RLEFileHandler::supportsFormat(const std::string& filename) const {
+bool SparseFileHandler::supportsFormat(const std::string& filename) const {
     std::string ext = DirectoryManager::getExtension(filename);
     std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-    return ext == ".rle";
+    return ext == ".lif" || ext == ".life";
 }
 
-std::vector<std::string> RLEFileHandler::getSupportedExtensions() const {
-    return {".rle"};
+std::vector<std::string> SparseFileHandler::getSupportedExtensions() const {
+    return {".lif", ".life"};
 }
 
 // ============================================================
@@ -391,6 +719,15 @@ std::unique_ptr<IFileHandler> FileHandlerFactory::createForFile(const std::strin
     if (ext == ".gol" || ext == ".ext") {
         return std::make_unique<ExtendedFileHandler>();
     }
+    if (ext == ".golb") {
+        return std::make_unique<BinaryFileHandler>();
+    }
+    if (ext == ".mc") {
+        return std::make_unique<MacrocellFileHandler>();
+    }
+    if (ext == ".lif" || ext == ".life") {
+        return std::make_unique<SparseFileHandler>();
+    }
     // Par défaut, format standard
     return std::make_unique<StandardFileHandler>();
 }
@@ -407,6 +744,31 @@ std::unique_ptr<IFileHandler> FileHandlerFactory::createRLE() {
     return std::make_unique<RLEFileHandler>();
 }
 
+std::unique_ptr<IFileHandler> FileHandlerFactory::createBinary() {
+    return std::make_unique<BinaryFileHandler>();
+}
+
+std::unique_ptr<IFileHandler> FileHandlerFactory::createMacrocell() {
+    return std::make_unique<MacrocellFileHandler>();
+}
+
+std::unique_ptr<IFileHandler> FileHandlerFactory::createSparse() {
+    return std::make_unique<SparseFileHandler>();
+}
+
+std::vector<std::string> FileHandlerFactory::getSupportedExtensions() {
+    std::unique_ptr<IFileHandler> handlers[] = {createStandard(), createExtended(), createRLE(),
+                                                createBinary(), createMacrocell(), createSparse()};
+    std::vector<std::string> extensions;
+    for (const auto& handler : handlers) {
+        for (std::string ext : handler->getSupportedExtensions()) {
+            std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+            extensions.push_back(ext);
+        }
+    }
+    return extensions;
+}
+
 // ============================================================
 // Implémentation de DirectoryManager
 // ============================================================
@@ -459,7 +821,7 @@ std::string DirectoryManager::getExtension(const std::string& filename) {
 
 std::string DirectoryManager::generateGenerationFilename(
     const std::string& baseDir, 
-    int generation
+    std::int64_t generation
 ) {
     std::ostringstream oss;
     oss << baseDir << "/generation_" 
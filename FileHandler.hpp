@@ -5,9 +5,12 @@
 #include <vector>
 #include <memory>
 #include <fstream>
+#include <cstdint>
 
 // Déclarations anticipées
 class Grid;
+class GridView;
+class BitGrid;
 
 /**
  * @class IFileHandler
@@ -35,6 +38,40 @@ public:
      */
     virtual bool save(const std::string& filename, const Grid& grid) = 0;
 
+    /**
+     * @brief Sauvegarde une région de grille sans la copier
+     *
+     * Par défaut, la vue est copiée dans une grille temporaire puis sauvegardée ;
+     * les formats courants lisent directement la vue.
+     *
+     * @param filename Chemin du fichier
+     * @param view Vue à sauvegarder
+     * @return true si la sauvegarde a réussi
+     */
+    virtual bool saveView(const std::string& filename, const GridView& view);
+
+    /**
+     * @brief Charge un fichier directement en BitGrid
+     *
+     * Par défaut, passe par une Grid puis la convertit ; les formats qui
+     * savent produire des lignes de bits redéfinissent cette méthode.
+     *
+     * @param filename Chemin du fichier
+     * @return Grille chargée, nullptr en cas d'erreur
+     */
+    virtual std::unique_ptr<BitGrid> loadBitGrid(const std::string& filename);
+
+    /**
+     * @brief Sauvegarde une BitGrid sans passer par les cellules si le format le permet
+     *
+     * Par défaut, la grille est convertie en Grid puis sauvegardée.
+     *
+     * @param filename Chemin du fichier
+     * @param grid Grille à sauvegarder
+     * @return true si la sauvegarde a réussi
+     */
+    virtual bool saveBitGrid(const std::string& filename, const BitGrid& grid);
+
     /**
      * @brief Vérifie si le format de fichier est supporté
      * @param filename Nom du fichier
@@ -56,11 +93,17 @@ public:
  * Format :
  * - Ligne 1 : largeur hauteur
  * - Lignes suivantes : matrice de 0 et 1
+ *
+ * Les grandes grilles presque vides et sans obstacles sont enregistrées en
+ * liste de cellules (SparseFileHandler), relue d'après son en-tête.
  */
 class StandardFileHandler : public IFileHandler {
 public:
     bool load(const std::string& filename, Grid& grid) override;
     bool save(const std::string& filename, const Grid& grid) override;
+    bool saveView(const std::string& filename, const GridView& view) override;
+    std::unique_ptr<BitGrid> loadBitGrid(const std::string& filename) override;
+    bool saveBitGrid(const std::string& filename, const BitGrid& grid) override;
     bool supportsFormat(const std::string& filename) const override;
     std::vector<std::string> getSupportedExtensions() const override;
 };
@@ -81,6 +124,9 @@ class ExtendedFileHandler : public IFileHandler {
 public:
     bool load(const std::string& filename, Grid& grid) override;
     bool save(const std::string& filename, const Grid& grid) override;
+    bool saveView(const std::string& filename, const GridView& view) override;
+    std::unique_ptr<BitGrid> loadBitGrid(const std::string& filename) override;
+    bool saveBitGrid(const std::string& filename, const BitGrid& grid) override;
     bool supportsFormat(const std::string& filename) const override;
     std::vector<std::string> getSupportedExtensions() const override;
 };
@@ -93,28 +139,171 @@ public:
  * Exemple :
  * x = 3, y = 3
  * bo$2bo$3o!
+ *
+ * Lecture et écriture en flux (RLEGridParser, RLEGridWriter) : la mémoire
+ * utilisée est celle de la grille, pas celle du fichier.
  */
 class RLEFileHandler : public IFileHandler {
 public:
     bool load(const std::string& filename, Grid& grid) override;
     bool save(const std::string& filename, const Grid& grid) override;
+    bool saveView(const std::string& filename, const GridView& view) override;
+    std::unique_ptr<BitGrid> loadBitGrid(const std::string& filename) override;
+    bool saveBitGrid(const std::string& filename, const BitGrid& grid) override;
+    bool supportsFormat(const std::string& filename) const override;
+    std::vector<std::string> getSupportedExtensions() const override;
+};
+
+/**
+ * @class BinaryFileHandler
+ * @brief Gestionnaire de fichiers binaires compacts (.golb)
+ *
+ * Format (entiers dans l'ordre de la machine) :
+ * - En-tête de HEADER_BYTES octets : "GOLBIN1", largeur, hauteur,
+ *   génération, drapeaux (torique, obstacles), notation B/S de la règle
+ * - Lignes de bits de la génération, alignées sur 64 bits (bit x % 64 du
+ *   mot x / 64), puis le plan des obstacles s'il est présent
+ *
+ * Le chargement en BitGrid ne copie rien : le fichier est projeté en
+ * copie sur écriture et sert directement de génération courante. La
+ * sauvegarde écrit l'en-tête et les plans d'un bloc.
+ */
+class BinaryFileHandler : public IFileHandler {
+public:
+    /**
+     * @brief Taille de l'en-tête (les lignes commencent alignées)
+     */
+    static const std::uint64_t HEADER_BYTES = 64;
+
+    /**
+     * @brief Signature en tête de fichier
+     */
+    static const char MAGIC[8];
+
+    bool load(const std::string& filename, Grid& grid) override;
+    bool save(const std::string& filename, const Grid& grid) override;
+    bool saveView(const std::string& filename, const GridView& view) override;
+    std::unique_ptr<BitGrid> loadBitGrid(const std::string& filename) override;
+    bool saveBitGrid(const std::string& filename, const BitGrid& grid) override;
     bool supportsFormat(const std::string& filename) const override;
     std::vector<std::string> getSupportedExtensions() const override;
 
 private:
     /**
-     * @brief Décode une chaîne RLE
-     * @param encoded Chaîne encodée
-     * @return Vecteur de paires (x, y) des cellules vivantes
+     * @brief Écrit l'en-tête puis les plans
+     * @param filename Chemin du fichier
+     * @param width Largeur
+     * @param height Hauteur
+     * @param generation Génération
+     * @param toric Mode torique
+     * @param rule Notation B/S de la règle
+     * @param alive Plan des cellules vivantes (lignes contiguës)
+     * @param obstacles Plan des obstacles, nullptr s'il n'y en a pas
+     * @return true si l'écriture a réussi
      */
-    std::vector<std::pair<int, int>> decodeRLE(const std::string& encoded) const;
+    static bool writeFile(const std::string& filename, std::int64_t width, std::int64_t height,
+                          std::int64_t generation, bool toric, const std::string& rule,
+                          const std::uint64_t* alive, const std::uint64_t* obstacles);
+};
+
+/**
+ * @class MacrocellFileHandler
+ * @brief Gestionnaire de fichiers Macrocell (.mc), arbre quaternaire à nœuds partagés
+ *
+ * Chaque bloc distinct du motif n'est écrit qu'une fois (voir
+ * MacrocellTree) : la taille du fichier suit la diversité du motif, pas sa
+ * surface ni son nombre de cellules. Les fichiers Golly sans dimensions
+ * sont chargés dans leur boîte englobante. Les obstacles ne sont pas
+ * enregistrés.
+ */
+class MacrocellFileHandler : public IFileHandler {
+public:
+    bool load(const std::string& filename, Grid& grid) override;
+    bool save(const std::string& filename, const Grid& grid) override;
+    bool saveView(const std::string& filename, const GridView& view) override;
+    std::unique_ptr<BitGrid> loadBitGrid(const std::string& filename) override;
+    bool saveBitGrid(const std::string& filename, const BitGrid& grid) override;
+    bool supportsFormat(const std::string& filename) const override;
+    std::vector<std::string> getSupportedExtensions() const override;
+};
+
+/**
+ * @class SparseFileHandler
+ * @brief Gestionnaire de fichiers creux : liste des cellules vivantes (Life 1.06)
+ *
+ * Format :
+ * - Ligne 1 : "#Life 1.06"
+ * - "#Size x = largeur, y = hauteur" (dimensions de la grille ; ligne
+ *   propre à ce programme, que les autres lecteurs sautent comme un
+ *   commentaire : "#D" reste une description)
+ * - Puis une ligne "x y" par cellule vivante
+ *
+ * La taille du fichier et le coût de la lecture suivent la population, pas
+ * la surface. Sans ligne de dimensions (fichiers d'autres logiciels, aux
+ * coordonnées souvent négatives), la grille est la boîte englobante des
+ * cellules. Le format n'a pas de place pour les obstacles : ils sont
+ * perdus (avertissement sur std::cerr), les obstacles vivants étant
+ * écrits comme des cellules vivantes ordinaires.
+ *
+ * StandardFileHandler choisit ce format de lui-même pour les grandes
+ * grilles presque vides (voir prefersSparse) et reconnaît l'en-tête au
+ * chargement.
+ */
+class SparseFileHandler : public IFileHandler {
+public:
+    /**
+     * @brief Signature en tête de fichier
+     */
+    static const char HEADER[];
+
+    /**
+     * @brief Proportion de cellules vivantes sous laquelle le format creux est choisi
+     *
+     * Une cellule vivante coûte une dizaine d'octets, contre deux par
+     * cellule dans le format de l'énoncé : à 1 %, le fichier est déjà
+     * vingt fois plus petit.
+     */
+    static constexpr double SPARSE_DENSITY = 0.01;
+
+    /**
+     * @brief Surface en dessous de laquelle le format de l'énoncé est toujours gardé
+     */
+    static const std::int64_t SPARSE_MIN_CELLS = 1 << 16;
+
+    /**
+     * @brief Indique si une grille gagne à être enregistrée en format creux
+     * @param population Nombre de cellules vivantes
+     * @param width Largeur
+     * @param height Hauteur
+     * @return true au-delà de SPARSE_MIN_CELLS cellules et sous SPARSE_DENSITY
+     */
+    static bool prefersSparse(std::int64_t population, std::int64_t width, std::int64_t height);
 
     /**
-     * @brief Encode une grille en RLE
-     * @param grid Grille à encoder
-     * @return Chaîne encodée
+     * @brief Vérifie si un fichier commence par HEADER
+     * @param filename Chemin du fichier
+     * @return true pour un fichier Life 1.06
      */
-    std::string encodeRLE(const Grid& grid) const;
+    static bool isSparseFile(const std::string& filename);
+
+    bool load(const std::string& filename, Grid& grid) override;
+    bool save(const std::string& filename, const Grid& grid) override;
+    bool saveView(const std::string& filename, const GridView& view) override;
+    std::unique_ptr<BitGrid> loadBitGrid(const std::string& filename) override;
+    bool saveBitGrid(const std::string& filename, const BitGrid& grid) override;
+    bool supportsFormat(const std::string& filename) const override;
+    std::vector<std::string> getSupportedExtensions() const override;
+
+    /**
+     * @brief Écrit l'en-tête puis les coordonnées des bits à 1
+     * @param filename Chemin du fichier
+     * @param width Largeur
+     * @param height Hauteur
+     * @param alive Plan des cellules vivantes (lignes contiguës)
+     * @return true si l'écriture a réussi
+     */
+    static bool writeFile(const std::string& filename, std::int64_t width, std::int64_t height,
+                          const std::uint64_t* alive);
 };
 
 /**
@@ -147,6 +336,30 @@ public:
      * @return Pointeur unique vers le gestionnaire RLE
      */
     static std::unique_ptr<IFileHandler> createRLE();
+
+    /**
+     * @brief Obtient un gestionnaire binaire compact
+     * @return Pointeur unique vers le gestionnaire binaire
+     */
+    static std::unique_ptr<IFileHandler> createBinary();
+
+    /**
+     * @brief Obtient un gestionnaire Macrocell
+     * @return Pointeur unique vers le gestionnaire Macrocell
+     */
+    static std::unique_ptr<IFileHandler> createMacrocell();
+
+    /**
+     * @brief Obtient un gestionnaire creux (Life 1.06)
+     * @return Pointeur unique vers le gestionnaire creux
+     */
+    static std::unique_ptr<IFileHandler> createSparse();
+
+    /**
+     * @brief Liste les extensions de tous les gestionnaires (en minuscules)
+     * @return Extensions reconnues par createForFile
+     */
+    static std::vector<std::string> getSupportedExtensions();
 };
 
 /**
@@ -198,7 +411,7 @@ public:
      */
     static std::string generateGenerationFilename(
         const std::string& baseDir, 
-        int generation
+        std::int64_t generation
     );
 };
 
@@ -1,19 +1,105 @@
 #include "GameOfLife.hpp"
 #include "FileHandler.hpp"
+#include "CounterRNG.hpp"
+#include "GridView.hpp"
+#include "BitGrid.hpp"
+#include <functional>
 #include <sstream>
 #include <iomanip>
 #include <iostream>
 
-GameOfLife::GameOfLife(int width, int height, float updateInterval)
+namespace {
+
+/**
+ * @brief Boucle du mode console quand toutes les générations ne sont pas écrites
+ *
+ * La grille est copiée dans une BitGrid qui calcule d'une traite jusqu'à
+ * la prochaine génération demandée par la politique : entre deux
+ * écritures, ni capture, ni formatage, ni empreinte (sauf --until-stable,
+ * qui doit observer chaque génération).
+ *
+ * @param grid Grille de départ, remplacée par la grille finale
+ * @param numIterations Nombre d'itérations
+ * @param untilStable true pour s'arrêter dès que la grille est stable ou périodique
+ * @param window Générations de répétition avant de conclure
+ * @param policy Générations à écrire
+ * @param write Écriture d'une génération (numéro : getGeneration())
+ * @return Nombre de générations écrites, -1 en cas d'erreur
+ */
+std::int64_t runSampledGenerations(Grid& grid, std::int64_t numIterations, bool untilStable, std::int64_t window,
+                                   const OutputPolicy& policy, const std::function<void(const BitGrid&)>& write) {
+    BitGrid bits(grid.getWidth(), grid.getHeight());
+    if (!bits.fromGrid(grid)) {
+        return -1;
+    }
+    bits.setParallelMode(true);
+    bits.setGeneration(0);
+
+    std::int64_t written = 0;
+    auto emit = [&]() {
+        write(bits);
+        ++written;
+        const std::int64_t g = bits.getGeneration();
+        if (g % 10 == 0 || g == numIterations) {
+            std::cout << "  Génération " << g << "/" << numIterations << " sauvegardée." << std::endl;
+        }
+    };
+    if (policy.writesInitial() || numIterations <= 0) {
+        emit();
+    }
+
+    StabilizationDetector detector(StabilizationDetector::DEFAULT_MAX_PERIOD, window);
+    if (untilStable) {
+        detector.observe(bits.hash(), 0);
+    }
+    while (bits.getGeneration() < numIterations) {
+        const std::int64_t target = policy.next(bits.getGeneration(), numIterations);
+        bool settled = false;
+        if (untilStable) {
+            while (bits.getGeneration() < target && !settled) {
+                bits.step();
+                settled = detector.observe(bits.hash(), bits.getGeneration());
+            }
+        } else {
+            bits.step(target - bits.getGeneration());
+        }
+
+        bool changed = true;
+        if (policy.requiresChange()) {
+            std::int64_t births = 0;
+            std::int64_t deaths = 0;
+            bits.countChanges(births, deaths);
+            changed = births + deaths > 0;
+        }
+        if (changed || settled || bits.getGeneration() == numIterations) {
+            emit();
+        }
+        if (settled) {
+            std::cout << "Grille stabilisée à la génération " << detector.getSettledGeneration()
+                      << " (période " << detector.getPeriod() << "), arrêt à la génération "
+                      << bits.getGeneration() << "." << std::endl;
+            break;
+        }
+    }
+
+    if (!bits.toGrid(grid)) {
+        return -1;
+    }
+    return written;
+}
+
+} // namespace
+
+GameOfLife::GameOfLife(std::int64_t width, std::int64_t height, float updateInterval)
     : grid(width, height), isRunning(true), isPaused(false),
       updateInterval(updateInterval), timeSinceLastUpdate(0.0f),
       generationCount(0), renderer(std::make_shared<NullRenderer>()),
-      historyIndex(-1), previousGrid(width, height), timeSinceLastChange(0.0f),
-      hasStoppedEvolving(false), detectedCycleLength(0), stopReason("") {
+      historyIndex(-1), hasStoppedEvolving(false), detectedCycleLength(0), stopReason(""), escapeRemoval(false),
+      soupDensity(0.3), soupSeed(CounterRNG::randomSeed()), lastSoupSeed(0) {
     // Initialiser l'historique vide
     history.clear();
-    // Initialiser la grille précédente avec l'état actuel
-    previousGrid.copyFrom(grid);
+    // La génération 0 sert de référence à la détection de cycles
+    stabilization.observe(GridView(grid).hash(), generationCount);
 }
 
 Grid& GameOfLife::getGrid() {
@@ -48,24 +134,6 @@ void GameOfLife::update(float deltaTime) {
             step();
             timeSinceLastUpdate = 0.0f;
         }
-        
-        // Incrémenter le temps depuis le dernier changement si cycle détecté
-        if (detectedCycleLength > 0) {
-            timeSinceLastChange += deltaTime;
-        }
-        
-        // Vérifier si l'automate a arrêté d'évoluer (cycle ou stable pendant 10s)
-        if (detectedCycleLength > 0 && timeSinceLastChange >= STAGNATION_TIMEOUT) {
-            hasStoppedEvolving = true;
-            isPaused = true;  // Mettre en pause automatiquement
-            
-            // Définir la raison de l'arrêt
-            if (detectedCycleLength == 1) {
-                stopReason = "STABLE - L'automate ne change plus";
-            } else {
-                stopReason = "CYCLE détecté (période " + std::to_string(detectedCycleLength) + ")";
-            }
-        }
     }
 }
 
@@ -90,42 +158,57 @@ void GameOfLife::step() {
     grid.update();
     generationCount++;
     
-    // Vérifier si la grille a changé ou si un cycle est détecté
-    bool cycleDetected = false;
-    detectedCycleLength = 0;
-    
-    // Vérifier si la grille est identique à la précédente (stable)
-    if (grid.isEqual(previousGrid)) {
-        detectedCycleLength = 1;  // Stable (cycle de longueur 1)
-        cycleDetected = true;
-    } else {
-        // Vérifier si la grille correspond à une des générations dans l'historique (oscillation)
-        for (size_t i = 0; i < history.size(); ++i) {
-            if (grid.isEqual(history[i])) {
-                detectedCycleLength = static_cast<int>(i + 2);
-                cycleDetected = true;
-                break;
-            }
+    // Cumuler les changements d'état (carte recréée si la grille a changé de taille)
+    if (heatMap) {
+        if (heatMap->getWidth() != grid.getWidth() || heatMap->getHeight() != grid.getHeight()) {
+            heatMap.reset(new HeatMap(grid.getWidth(), grid.getHeight()));
         }
+        heatMap->accumulate(savedGrid, grid);
     }
     
-    if (cycleDetected) {
-        // Un cycle est détecté, le timer continue
-    } else {
-        // La grille a changé de manière unique, réinitialiser le timer
-        timeSinceLastChange = 0.0f;
-        hasStoppedEvolving = false;
+    // Retirer les vaisseaux partis avant de comparer aux générations précédentes
+    if (escapeRemoval && generationCount % ESCAPE_CHECK_INTERVAL == 0) {
+        escapeDetector.removeEscaping(grid, generationCount, grid.isParallelMode());
     }
     
-    // Toujours mettre à jour la grille précédente
-    previousGrid.copyFrom(grid);
+    // Comparer l'empreinte aux générations précédentes (stable = période 1)
+    stabilization.observe(GridView(grid).hash(), generationCount);
+    detectedCycleLength = stabilization.getPeriod();
+    
+    // Arrêt automatique une fois le cycle confirmé pendant la fenêtre
+    if (stabilization.isSettled() && !hasStoppedEvolving) {
+        hasStoppedEvolving = true;
+        isPaused = true;
+        
+        if (detectedCycleLength == 1) {
+            stopReason = "STABLE - L'automate ne change plus";
+        } else {
+            stopReason = "CYCLE détecté (période " + std::to_string(detectedCycleLength) + ")";
+        }
+        stopReason += " depuis la génération " + std::to_string(stabilization.getSettledGeneration());
+    }
 }
 
 void GameOfLife::randomize() {
-    grid.randomize();
+    grid.randomize(soupDensity, soupSeed);
+    lastSoupSeed = soupSeed;
+    soupSeed++;
     resetStagnationTimer();
 }
 
+void GameOfLife::setSoupParameters(double density, std::uint64_t seed) {
+    soupDensity = density;
+    soupSeed = seed;
+}
+
+double GameOfLife::getSoupDensity() const {
+    return soupDensity;
+}
+
+std::uint64_t GameOfLife::getLastSoupSeed() const {
+    return lastSoupSeed;
+}
+
 void GameOfLife::clear() {
     grid.clear();
     resetStagnationTimer();
@@ -134,11 +217,6 @@ void GameOfLife::clear() {
 bool GameOfLife::loadFromFile(const std::string& filename) {
     bool result = grid.loadFromFile(filename);
     if (result) {
-        // Redimensionner previousGrid si nécessaire
-        if (previousGrid.getWidth() != grid.getWidth() || 
-            previousGrid.getHeight() != grid.getHeight()) {
-            previousGrid.resize(grid.getWidth(), grid.getHeight());
-        }
         resetStagnationTimer();
     }
     return result;
@@ -148,12 +226,13 @@ bool GameOfLife::saveToFile(const std::string& filename) const {
     return grid.saveToFile(filename);
 }
 
-int GameOfLife::getGenerationCount() const {
+std::int64_t GameOfLife::getGenerationCount() const {
     return generationCount;
 }
 
 void GameOfLife::resetGenerationCount() {
     generationCount = 0;
+    escapeDetector.clear();
     history.clear();
     historyIndex = -1;
     resetStagnationTimer();
@@ -171,8 +250,7 @@ bool GameOfLife::goForward() {
     }
     
     if (historyIndex >= 0 && historyIndex < static_cast<int>(history.size())) {
-        grid.copyFrom(history[historyIndex]);
-        return true;
+        return grid.copyFrom(history[historyIndex]);
     }
     
     return false;
@@ -196,8 +274,7 @@ bool GameOfLife::goBackward() {
     }
     
     if (historyIndex >= 0 && historyIndex < static_cast<int>(history.size())) {
-        grid.copyFrom(history[historyIndex]);
-        return true;
+        return grid.copyFrom(history[historyIndex]);
     }
     
     return false;
@@ -226,15 +303,23 @@ bool GameOfLife::getHasStoppedEvolving() const {
 }
 
 void GameOfLife::resetStagnationTimer() {
-    timeSinceLastChange = 0.0f;
     hasStoppedEvolving = false;
     detectedCycleLength = 0;
     stopReason = "";
-    previousGrid.copyFrom(grid);
+    stabilization.reset();
+    stabilization.observe(GridView(grid).hash(), generationCount);
+}
+
+void GameOfLife::setStabilizationWindow(std::int64_t generations) {
+    stabilization.setWindow(generations);
+}
+
+std::int64_t GameOfLife::getGenerationsUntilStop() const {
+    return stabilization.getRemaining();
 }
 
-float GameOfLife::getTimeSinceLastChange() const {
-    return timeSinceLastChange;
+std::int64_t GameOfLife::getSettledGeneration() const {
+    return stabilization.getSettledGeneration();
 }
 
 int GameOfLife::getDetectedCycleLength() const {
@@ -245,6 +330,30 @@ std::string GameOfLife::getStopReason() const {
     return stopReason;
 }
 
+void GameOfLife::setEscapeRemoval(bool enabled) {
+    escapeRemoval = enabled;
+}
+
+bool GameOfLife::isEscapeRemovalEnabled() const {
+    return escapeRemoval;
+}
+
+void GameOfLife::setHeatMapEnabled(bool enabled) {
+    if (enabled) {
+        heatMap.reset(new HeatMap(grid.getWidth(), grid.getHeight()));
+    } else {
+        heatMap.reset();
+    }
+}
+
+const HeatMap* GameOfLife::getHeatMap() const {
+    return heatMap.get();
+}
+
+const std::vector<EscapedShip>& GameOfLife::getEscapedShips() const {
+    return escapeDetector.getEscaped();
+}
+
 void GameOfLife::setUpdateInterval(float interval) {
     if (interval > 0.0f) {
         updateInterval = interval;
@@ -290,7 +399,8 @@ const Rule& GameOfLife::getRule() const {
 // Modes d'exécution
 // ============================================================
 
-bool GameOfLife::runConsoleMode(const std::string& inputFilename, int numIterations) {
+bool GameOfLife::runConsoleMode(const std::string& inputFilename, std::int64_t numIterations, bool untilStable,
+                                bool archive, const OutputPolicy& policy) {
     // Charger le fichier d'entrée
     if (!grid.loadFromFile(inputFilename)) {
         std::cerr << "Erreur : Impossible de charger le fichier " << inputFilename << std::endl;
@@ -300,42 +410,92 @@ bool GameOfLife::runConsoleMode(const std::string& inputFilename, int numIterati
     // Extraire le nom de base du fichier
     std::string baseName = DirectoryManager::getBaseName(inputFilename);
     
-    // Créer le dossier de sortie
-    std::string outputDir = baseName + "_out";
-    DirectoryManager::createDirectory(outputDir);
-    
     std::cout << "Mode console : génération de " << numIterations << " itérations..." << std::endl;
-    std::cout << "Dossier de sortie : " << outputDir << std::endl;
-    
-    // Créer un FileRenderer pour sauvegarder les générations
-    auto fileRenderer = std::make_shared<FileRenderer>(outputDir);
-    fileRenderer->initialize();
     
-    // Sauvegarder la génération initiale (génération 0)
-    fileRenderer->render(grid);
+    // Un fichier par génération dans <nom>_out/, ou une seule archive <nom>.gola
+    std::shared_ptr<IRenderer> renderer;
+    std::shared_ptr<FileRenderer> fileRenderer;
+    std::shared_ptr<ArchiveRenderer> archiveRenderer;
+    if (archive) {
+        std::string archiveFile = baseName + ".gola";
+        std::cout << "Archive de sortie : " << archiveFile << std::endl;
+        archiveRenderer = std::make_shared<ArchiveRenderer>(archiveFile);
+        renderer = archiveRenderer;
+    } else {
+        // Créer le dossier de sortie
+        std::string outputDir = baseName + "_out";
+        DirectoryManager::createDirectory(outputDir);
+        std::cout << "Dossier de sortie : " << outputDir << std::endl;
+        fileRenderer = std::make_shared<FileRenderer>(outputDir);
+        renderer = fileRenderer;
+    }
+    if (!renderer->initialize()) {
+        return false;
+    }
     
-    // Générer les n itérations
-    for (int i = 1; i <= numIterations; ++i) {
-        grid.computeNextGeneration();
-        grid.update();
+    std::int64_t written = 0;
+    if (policy.getMode() != OutputPolicy::Mode::ALL) {
+        // Seules certaines générations sont écrites : calcul compact entre elles
+        std::cout << "Générations écrites : " << policy.describe() << std::endl;
+        written = runSampledGenerations(grid, numIterations, untilStable, stabilization.getWindow(), policy,
+            [&](const BitGrid& bits) {
+                if (archiveRenderer) {
+                    archiveRenderer->renderGeneration(bits);
+                } else {
+                    fileRenderer->renderGeneration(bits);
+                }
+            });
+    } else {
+        // Sauvegarder la génération initiale (génération 0)
+        renderer->render(grid);
         
-        // Sauvegarder chaque génération
-        fileRenderer->render(grid);
+        StabilizationDetector detector(StabilizationDetector::DEFAULT_MAX_PERIOD, stabilization.getWindow());
+        detector.observe(GridView(grid).hash(), 0);
         
-        // Afficher la progression
-        if (i % 10 == 0 || i == numIterations) {
-            std::cout << "  Génération " << i << "/" << numIterations << " sauvegardée." << std::endl;
+        // Générer les n itérations
+        written = numIterations + 1;
+        for (std::int64_t i = 1; i <= numIterations; ++i) {
+            grid.computeNextGeneration();
+            grid.update();
+            
+            // Sauvegarder chaque génération (écrite en arrière-plan pendant le calcul suivant)
+            renderer->render(grid);
+            
+            // Afficher la progression
+            if (i % 10 == 0 || i == numIterations) {
+                std::cout << "  Génération " << i << "/" << numIterations << " sauvegardée." << std::endl;
+            }
+            
+            if (untilStable && detector.observe(GridView(grid).hash(), i)) {
+                std::cout << "Grille stabilisée à la génération " << detector.getSettledGeneration()
+                          << " (période " << detector.getPeriod() << "), arrêt à la génération " << i << "." << std::endl;
+                written = i + 1;
+                break;
+            }
         }
     }
     
-    fileRenderer->shutdown();
-    std::cout << "Mode console terminé avec succès ! " << (numIterations + 1) << " fichiers générés." << std::endl;
+    if (archiveRenderer) {
+        bool complete = archiveRenderer->isActive() && written >= 0;
+        renderer->shutdown();
+        if (!complete) {
+            return false;
+        }
+        std::cout << "Mode console terminé avec succès ! " << archiveRenderer->getFrameCount()
+                  << " générations archivées (" << archiveRenderer->getBytesWritten() << " octets)." << std::endl;
+        return true;
+    }
+    renderer->shutdown();
+    if (written < 0) {
+        return false;
+    }
+    std::cout << "Mode console terminé avec succès ! " << written << " fichiers générés." << std::endl;
     return true;
 }
 
-bool GameOfLife::runUnitTest(const std::string& expectedGridFilename, int numIterations) {
+bool GameOfLife::runUnitTest(const std::string& expectedGridFilename, std::int64_t numIterations) {
     // Effectuer les n itérations
-    for (int i = 0; i < numIterations; ++i) {
+    for (std::int64_t i = 0; i < numIterations; ++i) {
         grid.computeNextGeneration();
         grid.update();
     }
@@ -364,7 +524,7 @@ bool GameOfLife::runUnitTest(const std::string& expectedGridFilename, int numIte
 bool GameOfLife::runUnitTestWithInput(
     const std::string& inputFilename,
     const std::string& expectedFilename,
-    int numIterations
+    std::int64_t numIterations
 ) {
     // Charger la grille initiale
     if (!grid.loadFromFile(inputFilename)) {
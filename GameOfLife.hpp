@@ -4,9 +4,14 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstdint>
 #include "Grid.hpp"
 #include "Renderer.hpp"
 #include "Rule.hpp"
+#include "EscapeDetector.hpp"
+#include "StabilizationDetector.hpp"
+#include "HeatMap.hpp"
+#include "OutputPolicy.hpp"
 
 /**
  * @class GameOfLife
@@ -22,7 +27,7 @@ private:
     bool isPaused;       // Indique si le jeu est en pause
     float updateInterval; // Intervalle de temps entre les générations (en secondes)
     float timeSinceLastUpdate; // Temps écoulé depuis la dernière mise à jour
-    int generationCount;  // Compteur de générations
+    std::int64_t generationCount;  // Compteur de générations
     
     // Renderer (Vue) - pattern MVC
     std::shared_ptr<IRenderer> renderer;
@@ -32,22 +37,37 @@ private:
     int historyIndex;            // Index actuel dans l'historique (-1 = génération actuelle)
     static const int MAX_HISTORY = 5;  // Nombre maximum de générations en arrière
     
-    // Détection d'arrêt automatique et cycles
-    Grid previousGrid;           // Grille précédente pour détecter les changements
-    float timeSinceLastChange;   // Temps écoulé depuis le dernier changement
-    static constexpr float STAGNATION_TIMEOUT = 10.0f;  // 10 secondes sans changement
+    // Détection d'arrêt automatique et cycles (comptée en générations)
+    StabilizationDetector stabilization;  // Période des empreintes de grille
     bool hasStoppedEvolving;     // Indique si l'automate a arrêté d'évoluer
     int detectedCycleLength;     // Longueur du cycle détecté (0 = pas de cycle)
     std::string stopReason;      // Raison de l'arrêt
+    
+    // Retrait des vaisseaux qui quittent la zone active
+    EscapeDetector escapeDetector;   // Détection et enregistrement des vaisseaux partis
+    bool escapeRemoval;              // true pour retirer les vaisseaux qui s'échappent
+    
+    // Carte d'activité (changements d'état cumulés par cellule)
+    std::unique_ptr<HeatMap> heatMap;
+    
+    // Paramètres des soupes aléatoires (reproductibles)
+    double soupDensity;          // Densité initiale des cellules vivantes
+    std::uint64_t soupSeed;      // Graine de la prochaine soupe
+    std::uint64_t lastSoupSeed;  // Graine de la dernière soupe générée
 
 public:
+    /**
+     * @brief Générations entre deux recherches de vaisseaux partis
+     */
+    static const int ESCAPE_CHECK_INTERVAL = 32;
+
     /**
      * @brief Constructeur
      * @param width Largeur de la grille
      * @param height Hauteur de la grille
      * @param updateInterval Intervalle entre les générations (en secondes)
      */
-    GameOfLife(int width, int height, float updateInterval = 0.1f);
+    GameOfLife(std::int64_t width, std::int64_t height, float updateInterval = 0.1f);
 
     /**
      * @brief Obtient une référence à la grille
@@ -97,9 +117,30 @@ public:
 
     /**
      * @brief Réinitialise la grille avec un état aléatoire
+     *
+     * Utilise la densité et la graine courantes, puis passe à la graine suivante.
      */
     void randomize();
 
+    /**
+     * @brief Définit les paramètres des soupes aléatoires
+     * @param density Probabilité qu'une cellule soit vivante (0.0 à 1.0)
+     * @param seed Graine de la prochaine soupe
+     */
+    void setSoupParameters(double density, std::uint64_t seed);
+
+    /**
+     * @brief Obtient la densité des soupes aléatoires
+     * @return Densité (0.0 à 1.0)
+     */
+    double getSoupDensity() const;
+
+    /**
+     * @brief Obtient la graine de la dernière soupe générée
+     * @return Graine (permet de rejouer la soupe)
+     */
+    std::uint64_t getLastSoupSeed() const;
+
     /**
      * @brief Efface la grille
      */
@@ -123,7 +164,7 @@ public:
      * @brief Obtient le numéro de génération actuel
      * @return Numéro de génération
      */
-    int getGenerationCount() const;
+    std::int64_t getGenerationCount() const;
 
     /**
      * @brief Réinitialise le compteur de générations
@@ -162,20 +203,32 @@ public:
 
     /**
      * @brief Vérifie si l'automate a arrêté d'évoluer
-     * @return true si l'automate n'a pas évolué depuis 30 secondes
+     * @return true si la grille est stable ou périodique depuis la fenêtre de confirmation
      */
     bool getHasStoppedEvolving() const;
 
     /**
-     * @brief Réinitialise le timer de stagnation
+     * @brief Réinitialise la détection de stagnation à partir de la grille courante
      */
     void resetStagnationTimer();
 
     /**
-     * @brief Obtient le temps écoulé depuis le dernier changement
-     * @return Temps en secondes
+     * @brief Définit la fenêtre de confirmation de la stagnation
+     * @param generations Générations pendant lesquelles le cycle doit se répéter
+     */
+    void setStabilizationWindow(std::int64_t generations);
+
+    /**
+     * @brief Obtient le nombre de générations avant l'arrêt automatique
+     * @return Générations restantes, 0 si aucun cycle n'est en cours de confirmation
      */
-    float getTimeSinceLastChange() const;
+    std::int64_t getGenerationsUntilStop() const;
+
+    /**
+     * @brief Obtient la génération à partir de laquelle la grille est périodique
+     * @return Génération, -1 si la stagnation n'est pas confirmée
+     */
+    std::int64_t getSettledGeneration() const;
 
     /**
      * @brief Obtient la longueur du cycle détecté
@@ -189,6 +242,45 @@ public:
      */
     std::string getStopReason() const;
 
+    /**
+     * @brief Active ou désactive le retrait des vaisseaux qui s'échappent
+     *
+     * Toutes les ESCAPE_CHECK_INTERVAL générations, les vaisseaux qui
+     * s'éloignent définitivement des autres objets sont enregistrés puis
+     * effacés : les planeurs ne bloquent plus la détection de stagnation.
+     *
+     * @param enabled true pour activer
+     */
+    void setEscapeRemoval(bool enabled);
+
+    /**
+     * @brief Vérifie si le retrait des vaisseaux est actif
+     * @return true si actif
+     */
+    bool isEscapeRemovalEnabled() const;
+
+    /**
+     * @brief Active ou désactive la carte d'activité
+     *
+     * Active, chaque génération incrémente le compteur des cellules qui ont
+     * changé d'état. Réactiver repart de zéro.
+     *
+     * @param enabled true pour activer
+     */
+    void setHeatMapEnabled(bool enabled);
+
+    /**
+     * @brief Obtient la carte d'activité
+     * @return Carte, ou nullptr si désactivée
+     */
+    const HeatMap* getHeatMap() const;
+
+    /**
+     * @brief Obtient les vaisseaux retirés depuis la dernière réinitialisation
+     * @return Vaisseaux retirés
+     */
+    const std::vector<EscapedShip>& getEscapedShips() const;
+
     /**
      * @brief Définit l'intervalle de mise à jour entre les générations
      * @param interval Intervalle en secondes
@@ -246,9 +338,14 @@ public:
      * @brief Exécute le mode console
      * @param inputFilename Fichier d'entrée
      * @param numIterations Nombre d'itérations à générer
+     * @param untilStable true pour s'arrêter dès que la grille est stable ou périodique
+     * @param archive true pour écrire toutes les générations dans <nom>.gola au lieu de <nom>_out/
+     * @param policy Générations à écrire (toutes par défaut ; sinon calcul
+     *               sur une grille compacte jusqu'à la prochaine génération écrite)
      * @return true si succès, false sinon
      */
-    bool runConsoleMode(const std::string& inputFilename, int numIterations);
+    bool runConsoleMode(const std::string& inputFilename, std::int64_t numIterations, bool untilStable = false,
+                        bool archive = false, const OutputPolicy& policy = OutputPolicy());
 
     /**
      * @brief Test unitaire : vérifie si la grille correspond à une grille attendue
@@ -256,7 +353,7 @@ public:
      * @param numIterations Nombre d'itérations à effectuer avant comparaison
      * @return true si la grille correspond, false sinon
      */
-    bool runUnitTest(const std::string& expectedGridFilename, int numIterations);
+    bool runUnitTest(const std::string& expectedGridFilename, std::int64_t numIterations);
 
     /**
      * @brief Test unitaire avec grille initiale spécifiée
@@ -268,7 +365,7 @@ public:
     bool runUnitTestWithInput(
         const std::string& inputFilename,
         const std::string& expectedFilename,
-        int numIterations
+        std::int64_t numIterations
     );
 };
 
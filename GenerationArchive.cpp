@@ -0,0 +1,508 @@
+#include "GenerationArchive.hpp"
+#include "BitGrid.hpp"
+#include "FileHandler.hpp"
+#include "Grid.hpp"
+#include "TextGridWriter.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+/**
+ * @brief En-tête d'une archive (HEADER_BYTES octets)
+ */
+struct ArchiveHeader {
+    char magic[8];
+    std::int64_t width;
+    std::int64_t height;
+    std::int64_t keyframeInterval;
+    std::uint8_t reserved[32];
+};
+
+/**
+ * @brief Fin d'une archive, après l'index (TRAILER_BYTES octets)
+ */
+struct ArchiveTrailer {
+    std::uint64_t indexOffset;
+    std::uint64_t frameCount;
+    char magic[8];
+};
+
+static_assert(sizeof(ArchiveHeader) == GenerationArchive::HEADER_BYTES, "en-tête d'archive de 64 octets");
+static_assert(sizeof(ArchiveTrailer) == GenerationArchive::TRAILER_BYTES, "fin d'archive de 24 octets");
+
+/**
+ * @brief Octets nuls en deçà desquels une plage reste dans les littéraux
+ *
+ * Une plage nulle coûte deux varints : plus courte, elle ne fait rien gagner.
+ */
+const std::uint64_t MIN_ZERO_RUN = 4;
+
+void putVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+bool getVarint(const std::uint8_t*& in, const std::uint8_t* end, std::uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && in < end; shift += 7) {
+        const std::uint8_t byte = *in++;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+std::uint64_t loadWord(const std::uint8_t* data) {
+    std::uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/**
+ * @brief Nom d'un fichier du mode console (identique à FileRenderer)
+ */
+std::string generationFilename(const std::string& directory, std::int64_t generation) {
+    std::ostringstream filename;
+    filename << directory << "/generation_" << std::setfill('0') << std::setw(6) << generation << ".txt";
+    return filename.str();
+}
+
+} // namespace
+
+// ============================================================
+// Implémentation de GenerationArchive
+// ============================================================
+
+const char GenerationArchive::MAGIC[8] = {'G', 'O', 'L', 'A', 'R', 'C', '2', '\0'};
+const char GenerationArchive::INDEX_MAGIC[8] = {'G', 'O', 'L', 'A', 'I', 'D', 'X', '\0'};
+
+void GenerationArchive::encode(const std::uint8_t* data, std::uint64_t size, std::vector<std::uint8_t>& out) {
+    std::uint64_t i = 0;
+    while (i < size) {
+        // Plage nulle, 8 octets à la fois dans les zones calmes
+        std::uint64_t literal = i;
+        while (literal + 8 <= size && loadWord(data + literal) == 0) literal += 8;
+        while (literal < size && data[literal] == 0) ++literal;
+
+        // Littéraux jusqu'à la prochaine plage nulle assez longue
+        std::uint64_t end = literal;
+        for (std::uint64_t j = literal; j < size; ++j) {
+            if (data[j] != 0) {
+                end = j + 1;
+            } else if (j + 1 - end >= MIN_ZERO_RUN) {
+                break;
+            }
+        }
+
+        putVarint(out, literal - i);
+        putVarint(out, end - literal);
+        out.insert(out.end(), data + literal, data + end);
+        i = end;
+    }
+}
+
+bool GenerationArchive::decode(const std::uint8_t*& in, const std::uint8_t* end,
+                               std::uint8_t* out, std::uint64_t size, bool combine) {
+    std::uint64_t pos = 0;
+    while (pos < size) {
+        std::uint64_t zeros = 0;
+        std::uint64_t literals = 0;
+        if (!getVarint(in, end, zeros) || !getVarint(in, end, literals) ||
+            zeros > size - pos || literals > size - pos - zeros ||
+            literals > static_cast<std::uint64_t>(end - in)) {
+            return false;
+        }
+        if (!combine) {
+            std::memset(out + pos, 0, static_cast<size_t>(zeros));
+        }
+        pos += zeros;
+        if (combine) {
+            for (std::uint64_t k = 0; k < literals; ++k) {
+                out[pos + k] ^= in[k];
+            }
+        } else {
+            std::memcpy(out + pos, in, static_cast<size_t>(literals));
+        }
+        in += literals;
+        pos += literals;
+    }
+    return true;
+}
+
+// ============================================================
+// Implémentation de GenerationArchiveWriter
+// ============================================================
+
+GenerationArchiveWriter::GenerationArchiveWriter()
+    : keyframeInterval(GenerationArchive::DEFAULT_KEYFRAME_INTERVAL), width(0), height(0), position(0),
+      lastGeneration(-1), previousObstacles(false), failed(false) {
+}
+
+GenerationArchiveWriter::~GenerationArchiveWriter() {
+    close();
+}
+
+bool GenerationArchiveWriter::open(const std::string& path, std::int64_t interval) {
+    close();
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Erreur : Impossible de créer le fichier " << path << std::endl;
+        return false;
+    }
+    filename = path;
+    keyframeInterval = std::max<std::int64_t>(1, interval);
+    width = 0;
+    height = 0;
+    position = 0;
+    lastGeneration = -1;
+    offsets.clear();
+    previousObstacles = false;
+    failed = false;
+    return true;
+}
+
+void GenerationArchiveWriter::put(const void* data, std::uint64_t size) {
+    file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    position += size;
+}
+
+bool GenerationArchiveWriter::append(const Grid& grid, std::int64_t generation) {
+    if (!file.is_open()) return false;
+    snapshot.capture(grid);
+    return appendSnapshot(generation);
+}
+
+bool GenerationArchiveWriter::append(const BitGrid& grid, std::int64_t generation) {
+    if (!file.is_open()) return false;
+    snapshot.capture(grid);
+    return appendSnapshot(generation);
+}
+
+bool GenerationArchiveWriter::appendSnapshot(std::int64_t generation) {
+    if (generation < 0) {
+        generation = lastGeneration + 1;
+    } else if (generation <= lastGeneration) {
+        std::cerr << "Erreur : Génération " << generation << " après la génération " << lastGeneration
+                  << " dans l'archive " << filename << std::endl;
+        failed = true;
+        return false;
+    }
+    const std::uint64_t words = static_cast<std::uint64_t>(snapshot.getWordsPerRow() * snapshot.getHeight());
+    if (offsets.empty()) {
+        width = snapshot.getWidth();
+        height = snapshot.getHeight();
+        ArchiveHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, GenerationArchive::MAGIC, sizeof(header.magic));
+        header.width = width;
+        header.height = height;
+        header.keyframeInterval = keyframeInterval;
+        put(&header, sizeof(header));
+        previous.assign(static_cast<size_t>(2 * words), 0);
+        previousObstacles = false;
+    } else if (snapshot.getWidth() != width || snapshot.getHeight() != height) {
+        std::cerr << "Erreur : Dimensions " << snapshot.getWidth() << "x" << snapshot.getHeight()
+                  << " différentes de celles de l'archive " << filename << std::endl;
+        failed = true;
+        return false;
+    }
+
+    // Image clé : plans complets ; sinon XOR avec la génération précédente.
+    // Sans obstacles, le plan précédent est remis à zéro pour la suite.
+    const bool key = static_cast<std::int64_t>(offsets.size()) % keyframeInterval == 0;
+    const bool obstacles = snapshot.hasObstacles();
+    const std::uint64_t planes = obstacles ? 2 : 1;
+    delta.resize(static_cast<size_t>(planes * words));
+    for (std::uint64_t p = 0; p < planes; ++p) {
+        const std::uint64_t* source = p == 0 ? snapshot.aliveRow(0) : snapshot.obstacleRow(0);
+        std::uint64_t* before = previous.data() + p * words;
+        std::uint64_t* out = delta.data() + p * words;
+        for (std::uint64_t i = 0; i < words; ++i) {
+            out[i] = key ? source[i] : source[i] ^ before[i];
+            before[i] = source[i];
+        }
+    }
+    if (!obstacles && previousObstacles) {
+        std::fill(previous.begin() + static_cast<std::ptrdiff_t>(words), previous.end(), std::uint64_t(0));
+    }
+    previousObstacles = obstacles;
+
+    // Un flux par plan : le lecteur les décode séparément
+    encoded.clear();
+    for (std::uint64_t p = 0; p < planes; ++p) {
+        GenerationArchive::encode(reinterpret_cast<const std::uint8_t*>(delta.data() + p * words),
+                                  words * sizeof(std::uint64_t), encoded);
+    }
+    std::vector<std::uint8_t> prefix(1, static_cast<std::uint8_t>(
+        (key ? GenerationArchive::FRAME_KEY : 0) | (obstacles ? GenerationArchive::FRAME_OBSTACLES : 0)));
+    putVarint(prefix, static_cast<std::uint64_t>(generation - lastGeneration - 1));
+    putVarint(prefix, encoded.size());
+    lastGeneration = generation;
+
+    offsets.push_back(position);
+    put(prefix.data(), prefix.size());
+    put(encoded.data(), encoded.size());
+    if (!file) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        failed = true;
+        return false;
+    }
+    return true;
+}
+
+bool GenerationArchiveWriter::close() {
+    if (!file.is_open()) {
+        return !failed;
+    }
+    if (offsets.empty()) {
+        // Archive vide : en-tête seul, dimensions nulles
+        ArchiveHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, GenerationArchive::MAGIC, sizeof(header.magic));
+        header.keyframeInterval = keyframeInterval;
+        put(&header, sizeof(header));
+    }
+    ArchiveTrailer trailer;
+    trailer.indexOffset = position;
+    trailer.frameCount = offsets.size();
+    std::memcpy(trailer.magic, GenerationArchive::INDEX_MAGIC, sizeof(trailer.magic));
+    put(offsets.data(), offsets.size() * sizeof(std::uint64_t));
+    put(&trailer, sizeof(trailer));
+    file.close();
+    if (!file) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        failed = true;
+    }
+    return !failed;
+}
+
+std::int64_t GenerationArchiveWriter::getFrameCount() const {
+    return static_cast<std::int64_t>(offsets.size());
+}
+
+std::uint64_t GenerationArchiveWriter::getBytesWritten() const {
+    return position;
+}
+
+// ============================================================
+// Implémentation de GenerationArchiveReader
+// ============================================================
+
+GenerationArchiveReader::GenerationArchiveReader()
+    : width(0), height(0), planeWords(0), framesEnd(0), currentFrame(-1), currentObstacles(false) {
+}
+
+bool GenerationArchiveReader::open(const std::string& path) {
+    offsets.clear();
+    generations.clear();
+    currentFrame = -1;
+    currentObstacles = false;
+    filename = path;
+    if (!file.open(path, MappedFile::Mode::READ_ONLY)) {
+        return false;
+    }
+
+    ArchiveHeader header;
+    if (file.size() < GenerationArchive::HEADER_BYTES) {
+        std::memset(&header, 0, sizeof(header));
+    } else {
+        std::memcpy(&header, file.data(), sizeof(header));
+    }
+    if (std::memcmp(header.magic, GenerationArchive::MAGIC, sizeof(header.magic)) != 0) {
+        std::cerr << "Erreur : " << path << " n'est pas une archive de générations" << std::endl;
+        file.close();
+        return false;
+    }
+    const std::int64_t limit = std::numeric_limits<std::int64_t>::max() / 16;
+    const std::int64_t wordsPerRow = (header.width + BitGrid::WORD_BITS - 1) / BitGrid::WORD_BITS;
+    if (header.width < 0 || header.height < 0 || header.width > limit ||
+        (wordsPerRow > 0 && header.height > limit / wordsPerRow)) {
+        std::cerr << "Erreur : En-tête d'archive invalide dans " << path << std::endl;
+        file.close();
+        return false;
+    }
+    width = header.width;
+    height = header.height;
+    planeWords = static_cast<std::uint64_t>(wordsPerRow * height);
+
+    // Index en fin de fichier ; absent si l'exécution a été interrompue
+    bool indexed = false;
+    if (file.size() >= GenerationArchive::HEADER_BYTES + GenerationArchive::TRAILER_BYTES) {
+        ArchiveTrailer trailer;
+        std::memcpy(&trailer, file.data() + file.size() - sizeof(trailer), sizeof(trailer));
+        const std::uint64_t indexEnd = file.size() - sizeof(trailer);
+        indexed = std::memcmp(trailer.magic, GenerationArchive::INDEX_MAGIC, sizeof(trailer.magic)) == 0 &&
+                  trailer.indexOffset >= GenerationArchive::HEADER_BYTES && trailer.indexOffset <= indexEnd &&
+                  trailer.frameCount == (indexEnd - trailer.indexOffset) / sizeof(std::uint64_t) &&
+                  (indexEnd - trailer.indexOffset) % sizeof(std::uint64_t) == 0;
+        if (indexed) {
+            framesEnd = trailer.indexOffset;
+            offsets.resize(static_cast<size_t>(trailer.frameCount));
+            std::memcpy(offsets.data(), file.data() + trailer.indexOffset,
+                        offsets.size() * sizeof(std::uint64_t));
+            for (std::uint64_t offset : offsets) {
+                if (offset < GenerationArchive::HEADER_BYTES || offset >= framesEnd) {
+                    indexed = false;
+                }
+            }
+        }
+    }
+    if (!indexed) {
+        std::cout << "Archive sans index (exécution interrompue ?) : parcours des trames de " << path << std::endl;
+        scanFrames();
+    }
+    if (!readGenerations()) {
+        std::cerr << "Erreur : Trames corrompues dans " << path << std::endl;
+        file.close();
+        return false;
+    }
+
+    current.assign(static_cast<size_t>(2 * planeWords), 0);
+    return true;
+}
+
+void GenerationArchiveReader::scanFrames() {
+    offsets.clear();
+    const std::uint8_t* data = file.data();
+    const std::uint8_t* end = data + file.size();
+    std::uint64_t position = GenerationArchive::HEADER_BYTES;
+    while (position < file.size()) {
+        const std::uint8_t* in = data + position + 1;
+        std::uint64_t gap = 0;
+        std::uint64_t length = 0;
+        if (!getVarint(in, end, gap) || !getVarint(in, end, length) ||
+            length > static_cast<std::uint64_t>(end - in)) {
+            break;  // Dernière trame incomplète
+        }
+        offsets.push_back(position);
+        position = static_cast<std::uint64_t>(in - data) + length;
+    }
+    framesEnd = position;
+}
+
+bool GenerationArchiveReader::readGenerations() {
+    generations.clear();
+    generations.reserve(offsets.size());
+    const std::uint8_t* end = file.data() + framesEnd;
+    std::int64_t generation = -1;
+    for (std::uint64_t offset : offsets) {
+        const std::uint8_t* in = file.data() + offset + 1;
+        std::uint64_t gap = 0;
+        if (!getVarint(in, end, gap) ||
+            gap >= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max() - generation)) {
+            return false;
+        }
+        generation += static_cast<std::int64_t>(gap) + 1;
+        generations.push_back(generation);
+    }
+    return true;
+}
+
+std::int64_t GenerationArchiveReader::getWidth() const {
+    return width;
+}
+
+std::int64_t GenerationArchiveReader::getHeight() const {
+    return height;
+}
+
+std::int64_t GenerationArchiveReader::getGenerationCount() const {
+    return static_cast<std::int64_t>(offsets.size());
+}
+
+const std::vector<std::int64_t>& GenerationArchiveReader::getGenerations() const {
+    return generations;
+}
+
+bool GenerationArchiveReader::decodeFrame(std::int64_t frame) {
+    const std::uint8_t* in = file.data() + offsets[static_cast<size_t>(frame)];
+    const std::uint8_t* end = file.data() + framesEnd;
+    const std::uint8_t flags = *in++;
+    std::uint64_t gap = 0;
+    std::uint64_t length = 0;
+    if (!getVarint(in, end, gap) || !getVarint(in, end, length) ||
+        length > static_cast<std::uint64_t>(end - in)) {
+        return false;
+    }
+    end = in + length;
+
+    const bool key = (flags & GenerationArchive::FRAME_KEY) != 0;
+    const bool obstacles = (flags & GenerationArchive::FRAME_OBSTACLES) != 0;
+    std::uint8_t* alive = reinterpret_cast<std::uint8_t*>(current.data());
+    const std::uint64_t bytes = planeWords * sizeof(std::uint64_t);
+    if (!GenerationArchive::decode(in, end, alive, bytes, !key)) {
+        return false;
+    }
+    if (obstacles) {
+        if (!GenerationArchive::decode(in, end, alive + bytes, bytes, !key)) {
+            return false;
+        }
+    } else if (currentObstacles) {
+        std::fill(current.begin() + static_cast<std::ptrdiff_t>(planeWords), current.end(), std::uint64_t(0));
+    }
+    currentObstacles = obstacles;
+    currentFrame = frame;
+    return true;
+}
+
+bool GenerationArchiveReader::read(std::int64_t generation, GridSnapshot& out) {
+    auto found = std::lower_bound(generations.begin(), generations.end(), generation);
+    if (found == generations.end() || *found != generation) {
+        std::cerr << "Erreur : Génération " << generation << " absente de " << filename
+                  << " (" << getGenerationCount() << " générations archivées)" << std::endl;
+        return false;
+    }
+    const std::int64_t frame = found - generations.begin();
+
+    // Image clé précédente ; inutile si la trame décodée est déjà après elle
+    std::int64_t key = frame;
+    while (key >= 0 && (file.data()[offsets[static_cast<size_t>(key)]] & GenerationArchive::FRAME_KEY) == 0) {
+        --key;
+    }
+    if (key < 0) {
+        std::cerr << "Erreur : Aucune image clé avant la génération " << generation << " dans " << filename << std::endl;
+        return false;
+    }
+    const std::int64_t first = (currentFrame >= key && currentFrame <= frame) ? currentFrame + 1 : key;
+    for (std::int64_t f = first; f <= frame; ++f) {
+        if (!decodeFrame(f)) {
+            std::cerr << "Erreur : Trame de la génération " << generations[static_cast<size_t>(f)]
+                      << " corrompue dans " << filename << std::endl;
+            currentFrame = -1;
+            return false;
+        }
+    }
+
+    out.assign(width, height, current.data(), currentObstacles ? current.data() + planeWords : nullptr);
+    return true;
+}
+
+std::int64_t GenerationArchiveReader::extract(const std::string& directory, std::int64_t first, std::int64_t last) {
+    auto begin = std::lower_bound(generations.begin(), generations.end(), first);
+    auto end = std::upper_bound(generations.begin(), generations.end(), last);
+    if (first > last || begin >= end) {
+        std::cerr << "Erreur : Aucune génération de " << first << " à " << last << " dans l'archive "
+                  << filename << " (" << getGenerationCount() << " générations archivées)" << std::endl;
+        return -1;
+    }
+    DirectoryManager::createDirectory(directory);
+
+    TextGridWriter writer;
+    GridSnapshot snapshot;
+    std::int64_t written = 0;
+    for (auto g = begin; g != end; ++g) {
+        if (!read(*g, snapshot) || !writer.write(generationFilename(directory, *g), snapshot)) {
+            return -1;
+        }
+        ++written;
+    }
+    return written;
+}
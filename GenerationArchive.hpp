@@ -0,0 +1,252 @@
+#ifndef GENERATIONARCHIVE_HPP
+#define GENERATIONARCHIVE_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "GridSnapshot.hpp"
+#include "MappedFile.hpp"
+
+// Déclarations anticipées
+class Grid;
+class BitGrid;
+
+/**
+ * @class GenerationArchive
+ * @brief Format d'archive : toutes les générations d'une exécution dans un seul fichier
+ *
+ * Structure d'un fichier .gola :
+ * - en-tête de HEADER_BYTES octets (MAGIC, largeur, hauteur, intervalle
+ *   entre images clés) ;
+ * - une trame par génération archivée : un octet de drapeaux (FRAME_KEY,
+ *   FRAME_OBSTACLES), l'écart avec la génération de la trame précédente
+ *   moins un (varint, 0 si elles se suivent), la taille des données
+ *   (varint), puis les plans de bits (vivants, puis obstacles s'il y en a)
+ *   compressés. Une image clé contient les plans eux-mêmes, les autres
+ *   trames le XOR avec la trame précédente ;
+ * - l'index : position de chaque trame (64 bits), suivi de TRAILER_BYTES
+ *   octets (position de l'index, nombre de trames, INDEX_MAGIC).
+ *
+ * Compression : les plans sont vus comme une suite d'octets découpée en
+ * paires (nombre d'octets nuls, nombre d'octets littéraux) codées en
+ * varint, suivies des littéraux. D'une génération à l'autre, seules les
+ * zones actives changent : les deltas sont presque entièrement nuls.
+ */
+class GenerationArchive {
+public:
+    static const std::uint64_t HEADER_BYTES = 64;
+    static const std::uint64_t TRAILER_BYTES = 24;
+    static const char MAGIC[8];
+    static const char INDEX_MAGIC[8];
+
+    /**
+     * @brief Drapeaux d'une trame
+     */
+    static const std::uint8_t FRAME_KEY = 1;        // Plans complets (sinon XOR)
+    static const std::uint8_t FRAME_OBSTACLES = 2;  // Plan d'obstacles présent
+
+    /**
+     * @brief Générations entre deux images clés par défaut
+     *
+     * Borne le nombre de deltas à appliquer pour relire une génération au
+     * hasard.
+     */
+    static const std::int64_t DEFAULT_KEYFRAME_INTERVAL = 64;
+
+    /**
+     * @brief Compresse une suite d'octets (plages nulles et littéraux)
+     * @param data Octets à compresser
+     * @param size Nombre d'octets
+     * @param out Sortie (les données compressées sont ajoutées à la fin)
+     */
+    static void encode(const std::uint8_t* data, std::uint64_t size, std::vector<std::uint8_t>& out);
+
+    /**
+     * @brief Décompresse des données produites par encode
+     * @param in Données compressées (avancé jusqu'à la fin de la suite)
+     * @param end Fin des données disponibles
+     * @param out Sortie
+     * @param size Nombre d'octets attendus
+     * @param combine true pour combiner par XOR avec le contenu de out
+     * @return false si les données sont tronquées ou incohérentes
+     */
+    static bool decode(const std::uint8_t*& in, const std::uint8_t* end,
+                       std::uint8_t* out, std::uint64_t size, bool combine);
+};
+
+/**
+ * @class GenerationArchiveWriter
+ * @brief Ajoute les générations d'une exécution à une archive .gola
+ *
+ * Les générations sont capturées (GridSnapshot), comparées à la
+ * précédente et écrites à la suite ; l'index est écrit par close(). Toutes
+ * les générations doivent avoir les dimensions de la première.
+ */
+class GenerationArchiveWriter {
+public:
+    GenerationArchiveWriter();
+
+    /**
+     * @brief Destructeur : termine l'archive si close() n'a pas été appelé
+     */
+    ~GenerationArchiveWriter();
+
+    GenerationArchiveWriter(const GenerationArchiveWriter&) = delete;
+    GenerationArchiveWriter& operator=(const GenerationArchiveWriter&) = delete;
+
+    /**
+     * @brief Crée l'archive (l'en-tête est écrit à la première génération)
+     * @param filename Fichier de sortie
+     * @param keyframeInterval Générations entre deux images clés (au moins 1)
+     * @return false si le fichier ne peut pas être créé
+     */
+    bool open(const std::string& filename, std::int64_t keyframeInterval = GenerationArchive::DEFAULT_KEYFRAME_INTERVAL);
+
+    /**
+     * @brief Ajoute une génération
+     * @param grid Grille à archiver
+     * @param generation Numéro de la génération (-1 : celle qui suit la précédente)
+     * @return false si l'écriture a échoué, si les dimensions ont changé ou
+     *         si les numéros ne sont pas croissants
+     */
+    bool append(const Grid& grid, std::int64_t generation = -1);
+
+    /**
+     * @brief Ajoute une génération de grille compacte
+     * @param grid Grille à archiver
+     * @param generation Numéro de la génération (-1 : celle qui suit la précédente)
+     * @return false si l'écriture a échoué, si les dimensions ont changé ou
+     *         si les numéros ne sont pas croissants
+     */
+    bool append(const BitGrid& grid, std::int64_t generation = -1);
+
+    /**
+     * @brief Écrit l'index et ferme l'archive
+     * @return false si une écriture a échoué depuis open
+     */
+    bool close();
+
+    /**
+     * @brief Obtient le nombre de générations archivées
+     * @return Nombre de trames
+     */
+    std::int64_t getFrameCount() const;
+
+    /**
+     * @brief Obtient la taille actuelle de l'archive
+     * @return Octets écrits (index compris après close)
+     */
+    std::uint64_t getBytesWritten() const;
+
+private:
+    std::ofstream file;
+    std::string filename;
+    std::int64_t keyframeInterval;
+    std::int64_t width;                     // Dimensions de la première génération
+    std::int64_t height;
+    std::uint64_t position;                 // Octets écrits
+    std::int64_t lastGeneration;            // Génération de la dernière trame (-1 : aucune)
+    std::vector<std::uint64_t> offsets;     // Position de chaque trame
+    GridSnapshot snapshot;                  // Génération en cours
+    std::vector<std::uint64_t> previous;    // Plans de la génération précédente
+    std::vector<std::uint64_t> delta;       // Plans XOR
+    std::vector<std::uint8_t> encoded;      // Trame compressée
+    bool previousObstacles;
+    bool failed;
+
+    /**
+     * @brief Compresse et écrit la génération capturée dans snapshot
+     */
+    bool appendSnapshot(std::int64_t generation);
+
+    /**
+     * @brief Écrit des octets et avance la position
+     */
+    void put(const void* data, std::uint64_t size);
+};
+
+/**
+ * @class GenerationArchiveReader
+ * @brief Lecture d'une archive .gola, accès direct à n'importe quelle génération
+ *
+ * Le fichier est projeté en mémoire. Une génération est reconstruite à
+ * partir de l'image clé qui la précède ; une lecture dans l'ordre ne
+ * décode qu'une trame par génération. Une archive sans index (exécution
+ * interrompue) est relue en parcourant ses trames.
+ */
+class GenerationArchiveReader {
+public:
+    GenerationArchiveReader();
+
+    /**
+     * @brief Ouvre une archive
+     * @param filename Fichier .gola
+     * @return false si le fichier est absent ou n'est pas une archive (message sur std::cerr)
+     */
+    bool open(const std::string& filename);
+
+    std::int64_t getWidth() const;
+    std::int64_t getHeight() const;
+
+    /**
+     * @brief Obtient le nombre de générations archivées
+     * @return Nombre de trames
+     */
+    std::int64_t getGenerationCount() const;
+
+    /**
+     * @brief Obtient les numéros des générations archivées
+     * @return Numéros croissants, un par trame
+     */
+    const std::vector<std::int64_t>& getGenerations() const;
+
+    /**
+     * @brief Reconstruit une génération
+     * @param generation Numéro de génération (0 = grille initiale)
+     * @param out Génération reconstruite
+     * @return false si la génération n'est pas archivée ou si la trame est corrompue
+     */
+    bool read(std::int64_t generation, GridSnapshot& out);
+
+    /**
+     * @brief Recrée les fichiers generation_XXXXXX.txt du mode console
+     * @param directory Dossier de sortie (créé au besoin)
+     * @param first Première génération à extraire
+     * @param last Dernière génération à extraire (incluse)
+     * @return Nombre de fichiers écrits (générations archivées de la plage),
+     *         -1 en cas d'erreur ou si la plage n'en contient aucune
+     */
+    std::int64_t extract(const std::string& directory, std::int64_t first, std::int64_t last);
+
+private:
+    MappedFile file;
+    std::string filename;
+    std::int64_t width;
+    std::int64_t height;
+    std::uint64_t planeWords;
+    std::uint64_t framesEnd;                // Fin des trames (début de l'index)
+    std::vector<std::uint64_t> offsets;
+    std::vector<std::int64_t> generations;  // Génération de chaque trame
+    std::vector<std::uint64_t> current;     // Plans de la trame décodée
+    std::int64_t currentFrame;              // -1 : aucune
+    bool currentObstacles;
+
+    /**
+     * @brief Reconstruit l'index en parcourant les trames
+     */
+    void scanFrames();
+
+    /**
+     * @brief Lit les numéros de génération des en-têtes de trames
+     * @return false si un en-tête est illisible
+     */
+    bool readGenerations();
+
+    /**
+     * @brief Applique une trame aux plans courants
+     */
+    bool decodeFrame(std::int64_t frame);
+};
+
+#endif // GENERATIONARCHIVE_HPP
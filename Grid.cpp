@@ -1,28 +1,39 @@
 #include "Grid.hpp"
 #include "FileHandler.hpp"
+#include "CounterRNG.hpp"
+#include "NumaTopology.hpp"
+#include "PatternRegistry.hpp"
 #include <cstdlib>
 #include <ctime>
-#include <random>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <new>
+#include <unistd.h>
 
-Grid::Grid(int width, int height) 
+Grid::Grid(std::int64_t width, std::int64_t height) 
     : width(width), height(height), toricMode(false), parallelMode(false),
       rule(std::make_unique<ClassicRule>()) {
-    cells.resize(height, std::vector<Cell>(width));
+    std::string error;
+    if (!checkAllocation(width, height, error)) {
+        throw std::length_error(error);
+    }
+    cells = allocateRows(width, height);
 }
 
 Grid::Grid(const Grid& other) 
     : width(other.width), height(other.height), 
       toricMode(other.toricMode), parallelMode(other.parallelMode),
       rule(other.rule->clone()) {
-    cells.resize(height, std::vector<Cell>(width));
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
+    cells = allocateRows(width, height);
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
             cells[y][x] = other.cells[y][x];
         }
     }
@@ -36,8 +47,8 @@ Grid& Grid::operator=(const Grid& other) {
         parallelMode = other.parallelMode;
         rule = other.rule->clone();
         cells.resize(height, std::vector<Cell>(width));
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
+        for (std::int64_t y = 0; y < height; ++y) {
+            for (std::int64_t x = 0; x < width; ++x) {
                 cells[y][x] = other.cells[y][x];
             }
         }
@@ -45,45 +56,108 @@ Grid& Grid::operator=(const Grid& other) {
     return *this;
 }
 
-int Grid::wrapCoordinate(int coord, int max) const {
+std::int64_t Grid::wrapCoordinate(std::int64_t coord, std::int64_t max) const {
     if (coord < 0) return max + coord;
     if (coord >= max) return coord - max;
     return coord;
 }
 
-int Grid::getWidth() const {
+void Grid::runOnWorkers(std::int64_t rows, const std::function<void(std::int64_t, std::int64_t)>& work) {
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 4;  // Valeur par défaut
+    numThreads = static_cast<unsigned int>(
+        std::min<std::int64_t>(numThreads, std::max<std::int64_t>(rows, 1)));
+
+    std::vector<std::thread> threads;
+    std::int64_t rowsPerThread = rows / numThreads;
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        std::int64_t startRow = i * rowsPerThread;
+        std::int64_t endRow = (i == numThreads - 1) ? rows : (i + 1) * rowsPerThread;
+        threads.emplace_back([&work, i, numThreads, startRow, endRow]() {
+            NumaTopology::get().pinWorker(i, numThreads);
+            work(startRow, endRow);
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+std::vector<std::vector<Cell>> Grid::allocateRows(std::int64_t width, std::int64_t height) {
+    // En dessous de ce nombre de cellules, créer des threads coûte plus que d'allouer
+    const std::int64_t PARALLEL_THRESHOLD = 1 << 16;
+
+    std::vector<std::vector<Cell>> rows(height);
+    if (width * height < PARALLEL_THRESHOLD) {
+        for (auto& row : rows) {
+            row = std::vector<Cell>(width);
+        }
+        return rows;
+    }
+
+    std::atomic<bool> failed(false);
+    runOnWorkers(height, [&rows, &failed, width](std::int64_t startRow, std::int64_t endRow) {
+        try {
+            for (std::int64_t y = startRow; y < endRow; ++y) {
+                rows[y] = std::vector<Cell>(width);
+            }
+        } catch (const std::bad_alloc&) {
+            failed = true;
+        }
+    });
+    if (failed) {
+        throw std::bad_alloc();
+    }
+    return rows;
+}
+
+std::int64_t Grid::getWidth() const {
     return width;
 }
 
-int Grid::getHeight() const {
+std::int64_t Grid::getHeight() const {
     return height;
 }
 
-Cell& Grid::getCell(int x, int y) {
+Cell& Grid::getCell(std::int64_t x, std::int64_t y) {
     return cells[y][x];
 }
 
-const Cell& Grid::getCell(int x, int y) const {
+const Cell& Grid::getCell(std::int64_t x, std::int64_t y) const {
     return cells[y][x];
 }
 
 void Grid::randomize(double probability) {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> dis(0.0, 1.0);
-    
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            if (!cells[y][x].isObstacle()) {
-                cells[y][x].setAlive(dis(gen) < probability);
+    randomize(probability, CounterRNG::randomSeed());
+}
+
+void Grid::randomize(double probability, std::uint64_t seed) {
+    const std::uint32_t threshold = CounterRNG::quantizeProbability(probability);
+    const std::int64_t wordsPerRow = (width + 63) / 64;
+
+    // Chaque ligne tire ses mots aux indices y * wordsPerRow + wx : le résultat
+    // ne dépend pas du découpage en threads
+    auto fillRows = [this, threshold, wordsPerRow, seed](std::int64_t startRow, std::int64_t endRow) {
+        for (std::int64_t y = startRow; y < endRow; ++y) {
+            for (std::int64_t wx = 0; wx < wordsPerRow; ++wx) {
+                std::uint64_t index = static_cast<std::uint64_t>(y) * wordsPerRow + wx;
+                std::uint64_t word = CounterRNG::bernoulliWord(seed, index, threshold);
+                std::int64_t xEnd = std::min(width, (wx + 1) * 64);
+                for (std::int64_t x = wx * 64; x < xEnd; ++x) {
+                    if (!cells[y][x].isObstacle()) {
+                        cells[y][x].setAlive(((word >> (x & 63)) & 1ULL) != 0);
+                    }
+                }
             }
         }
-    }
+    };
+
+    runOnWorkers(height, fillRows);
 }
 
 void Grid::clear() {
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
             if (!cells[y][x].isObstacle()) {
                 cells[y][x].setAlive(false);
             }
@@ -91,7 +165,7 @@ void Grid::clear() {
     }
 }
 
-int Grid::countLivingNeighbors(int x, int y) const {
+int Grid::countLivingNeighbors(std::int64_t x, std::int64_t y) const {
     int count = 0;
     
     // Parcourt les 8 voisines
@@ -100,8 +174,8 @@ int Grid::countLivingNeighbors(int x, int y) const {
             // Ignore la cellule elle-même
             if (dx == 0 && dy == 0) continue;
             
-            int nx = x + dx;
-            int ny = y + dy;
+            std::int64_t nx = x + dx;
+            std::int64_t ny = y + dy;
             
             if (toricMode) {
                 // Mode torique : les bords sont connectés
@@ -132,8 +206,8 @@ void Grid::computeNextGeneration() {
     }
     
     // Calcule l'état suivant pour chaque cellule via le pattern Strategy
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
             int livingNeighbors = countLivingNeighbors(x, y);
             
             // Utiliser la règle pour calculer le prochain état
@@ -145,18 +219,79 @@ void Grid::computeNextGeneration() {
 
 void Grid::update() {
     // Applique l'état suivant à toutes les cellules
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
             cells[y][x].update();
         }
     }
 }
 
-void Grid::resize(int newWidth, int newHeight) {
+bool Grid::resize(std::int64_t newWidth, std::int64_t newHeight) {
+    std::string error;
+    if (!checkAllocation(newWidth, newHeight, error)) {
+        std::cerr << "Erreur : " << error << std::endl;
+        return false;
+    }
+
+    try {
+        std::vector<std::vector<Cell>> newCells = allocateRows(newWidth, newHeight);
+        cells.swap(newCells);
+    } catch (const std::bad_alloc&) {
+        std::cerr << "Erreur : Mémoire insuffisante pour une grille " << newWidth << "x" << newHeight
+                  << " (~" << (estimateMemoryBytes(newWidth, newHeight) >> 20) << " Mo estimés)" << std::endl;
+        return false;
+    }
     width = newWidth;
     height = newHeight;
-    cells.clear();
-    cells.resize(height, std::vector<Cell>(width));
+    return true;
+}
+
+std::uint64_t Grid::estimateMemoryBytes(std::int64_t width, std::int64_t height) {
+    if (width <= 0 || height <= 0) return 0;
+
+    // Chaque Cell possède deux CellState alloués sur le tas (bloc minimal de l'allocateur)
+    const std::uint64_t HEAP_BLOCK = 32;
+    const std::uint64_t perCell = sizeof(Cell) + 2 * HEAP_BLOCK;
+    const std::uint64_t perRow = sizeof(std::vector<Cell>);
+    const std::uint64_t maxValue = std::numeric_limits<std::uint64_t>::max();
+
+    std::uint64_t w = static_cast<std::uint64_t>(width);
+    std::uint64_t h = static_cast<std::uint64_t>(height);
+    if (w > maxValue / h) return maxValue;
+    std::uint64_t area = w * h;
+    if (area > (maxValue - perRow * h) / perCell) return maxValue;
+    return area * perCell + perRow * h;
+}
+
+bool Grid::checkAllocation(std::int64_t width, std::int64_t height, std::string& error) {
+    if (width <= 0 || height <= 0) {
+        error = "Dimensions invalides (" + std::to_string(width) + "x" + std::to_string(height) + ")";
+        return false;
+    }
+
+    std::uint64_t required = estimateMemoryBytes(width, height);
+    std::uint64_t available = std::numeric_limits<std::uint64_t>::max();
+#ifdef _SC_PHYS_PAGES
+    long pages = sysconf(_SC_PHYS_PAGES);
+    long pageSize = sysconf(_SC_PAGE_SIZE);
+    if (pages > 0 && pageSize > 0) {
+        available = static_cast<std::uint64_t>(pages) * static_cast<std::uint64_t>(pageSize);
+    }
+#endif
+
+    if (required == std::numeric_limits<std::uint64_t>::max() || required > available) {
+        std::ostringstream oss;
+        oss << "Grille " << width << "x" << height << " trop grande : ";
+        if (required == std::numeric_limits<std::uint64_t>::max()) {
+            oss << "la taille dépasse 2^64 octets";
+        } else {
+            oss << "~" << (required >> 20) << " Mo requis";
+        }
+        oss << ", " << (available >> 20) << " Mo de mémoire physique";
+        error = oss.str();
+        return false;
+    }
+    return true;
 }
 
 bool Grid::loadFromFile(const std::string& filename) {
@@ -169,18 +304,19 @@ bool Grid::saveToFile(const std::string& filename) const {
     return handler->save(filename, *this);
 }
 
-void Grid::copyFrom(const Grid& other) {
+bool Grid::copyFrom(const Grid& other) {
     // Redimensionner si nécessaire
-    if (width != other.width || height != other.height) {
-        resize(other.width, other.height);
+    if ((width != other.width || height != other.height) && !resize(other.width, other.height)) {
+        return false;
     }
     
     // Copier l'état de chaque cellule
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
             cells[y][x] = other.cells[y][x];
         }
     }
+    return true;
 }
 
 bool Grid::isEqual(const Grid& other) const {
@@ -190,8 +326,8 @@ bool Grid::isEqual(const Grid& other) const {
     }
     
     // Comparer chaque cellule
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
             if (cells[y][x].isAlive() != other.cells[y][x].isAlive()) {
                 return false;
             }
@@ -218,17 +354,10 @@ bool Grid::isParallelMode() const {
 }
 
 void Grid::computeNextGenerationParallel() {
-    // Nombre de threads basé sur le nombre de coeurs disponibles
-    unsigned int numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 4;  // Valeur par défaut
-    
-    std::vector<std::thread> threads;
-    int rowsPerThread = height / numThreads;
-    
     // Lambda pour calculer une partie de la grille
-    auto computeRows = [this](int startRow, int endRow) {
-        for (int y = startRow; y < endRow; ++y) {
-            for (int x = 0; x < width; ++x) {
+    auto computeRows = [this](std::int64_t startRow, std::int64_t endRow) {
+        for (std::int64_t y = startRow; y < endRow; ++y) {
+            for (std::int64_t x = 0; x < width; ++x) {
                 int livingNeighbors = countLivingNeighbors(x, y);
                 auto nextState = rule->computeNextState(cells[y][x].getState(), livingNeighbors);
                 cells[y][x].setNextState(std::move(nextState));
@@ -236,122 +365,71 @@ void Grid::computeNextGenerationParallel() {
         }
     };
     
-    // Créer les threads
-    for (unsigned int i = 0; i < numThreads; ++i) {
-        int startRow = i * rowsPerThread;
-        int endRow = (i == numThreads - 1) ? height : (i + 1) * rowsPerThread;
-        threads.emplace_back(computeRows, startRow, endRow);
-    }
-    
-    // Attendre que tous les threads se terminent
-    for (auto& t : threads) {
-        t.join();
-    }
+    // Un thread par cœur, fixé sur le nœud NUMA de ses lignes
+    runOnWorkers(height, computeRows);
 }
 
-void Grid::placePattern(const std::string& pattern, int x, int y) {
-    // Définition des motifs pré-programmés
-    std::vector<std::pair<int, int>> coords;
-    
-    if (pattern == "glider") {
-        // Planeur (glider)
-        coords = {{1,0}, {2,1}, {0,2}, {1,2}, {2,2}};
-    }
-    else if (pattern == "blinker") {
-        // Clignotant (oscillateur période 2)
-        coords = {{0,1}, {1,1}, {2,1}};
-    }
-    else if (pattern == "beacon") {
-        // Balise (oscillateur période 2)
-        coords = {{0,0}, {1,0}, {0,1}, {3,2}, {2,3}, {3,3}};
-    }
-    else if (pattern == "toad") {
-        // Crapaud (oscillateur période 2)
-        coords = {{1,0}, {2,0}, {3,0}, {0,1}, {1,1}, {2,1}};
-    }
-    else if (pattern == "lwss") {
-        // Lightweight Spaceship (vaisseau léger)
-        coords = {{1,0}, {4,0}, {0,1}, {0,2}, {4,2}, {0,3}, {1,3}, {2,3}, {3,3}};
-    }
-    else if (pattern == "pulsar") {
-        // Pulsar (oscillateur période 3)
-        coords = {
-            {2,0}, {3,0}, {4,0}, {8,0}, {9,0}, {10,0},
-            {0,2}, {5,2}, {7,2}, {12,2},
-            {0,3}, {5,3}, {7,3}, {12,3},
-            {0,4}, {5,4}, {7,4}, {12,4},
-            {2,5}, {3,5}, {4,5}, {8,5}, {9,5}, {10,5},
-            {2,7}, {3,7}, {4,7}, {8,7}, {9,7}, {10,7},
-            {0,8}, {5,8}, {7,8}, {12,8},
-            {0,9}, {5,9}, {7,9}, {12,9},
-            {0,10}, {5,10}, {7,10}, {12,10},
-            {2,12}, {3,12}, {4,12}, {8,12}, {9,12}, {10,12}
-        };
-    }
-    else if (pattern == "pentadecathlon") {
-        // Pentadécathlon (oscillateur période 15)
-        coords = {{1,0}, {1,1}, {0,2}, {2,2}, {1,3}, {1,4}, {1,5}, {1,6}, {0,7}, {2,7}, {1,8}, {1,9}};
+void Grid::placePattern(const std::string& pattern, std::int64_t x, std::int64_t y,
+                        PatternTransform transform) {
+    // Motif compilé (ou chargé une fois) : recherche par table de hachage
+    const PatternBitmap* bitmap = PatternRegistry::get().find(pattern, transform);
+    if (bitmap) {
+        placeBitmap(*bitmap, x, y, 0, height);
     }
-    else if (pattern == "glider_gun") {
-        // Canon à planeurs de Gosper
-        coords = {
-            {0,4}, {0,5}, {1,4}, {1,5},
-            {10,4}, {10,5}, {10,6}, {11,3}, {11,7}, {12,2}, {12,8}, {13,2}, {13,8},
-            {14,5}, {15,3}, {15,7}, {16,4}, {16,5}, {16,6}, {17,5},
-            {20,2}, {20,3}, {20,4}, {21,2}, {21,3}, {21,4}, {22,1}, {22,5},
-            {24,0}, {24,1}, {24,5}, {24,6},
-            {34,2}, {34,3}, {35,2}, {35,3}
-        };
-    }
-    else if (pattern == "block") {
-        // Bloc (nature morte)
-        coords = {{0,0}, {1,0}, {0,1}, {1,1}};
-    }
-    else if (pattern == "beehive") {
-        // Ruche (nature morte)
-        coords = {{1,0}, {2,0}, {0,1}, {3,1}, {1,2}, {2,2}};
-    }
-    else if (pattern == "loaf") {
-        // Pain (nature morte)
-        coords = {{1,0}, {2,0}, {0,1}, {3,1}, {1,2}, {3,2}, {2,3}};
-    }
-    else if (pattern == "boat") {
-        // Bateau (nature morte)
-        coords = {{0,0}, {1,0}, {0,1}, {2,1}, {1,2}};
-    }
-    else if (pattern == "r_pentomino") {
-        // R-pentomino (méthuselah)
-        coords = {{1,0}, {2,0}, {0,1}, {1,1}, {1,2}};
-    }
-    else if (pattern == "diehard") {
-        // Diehard (méthuselah qui meurt après 130 générations)
-        coords = {{6,0}, {0,1}, {1,1}, {1,2}, {5,2}, {6,2}, {7,2}};
-    }
-    else if (pattern == "acorn") {
-        // Gland (méthuselah)
-        coords = {{1,0}, {3,1}, {0,2}, {1,2}, {4,2}, {5,2}, {6,2}};
+}
+
+std::int64_t Grid::placePatterns(const std::vector<PatternPlacement>& placements, bool parallel) {
+    std::vector<const PatternBitmap*> bitmaps = PatternRegistry::get().resolve(placements);
+    std::int64_t unknown = std::count(bitmaps.begin(), bitmaps.end(), nullptr);
+
+    auto placeBand = [this, &placements, &bitmaps](std::int64_t firstRow, std::int64_t endRow) {
+        for (size_t i = 0; i < placements.size(); ++i) {
+            if (bitmaps[i]) {
+                placeBitmap(*bitmaps[i], placements[i].x, placements[i].y, firstRow, endRow);
+            }
+        }
+    };
+
+    // Chaque thread ne modifie que ses lignes : pas de conflit entre bandes
+    if (parallel) {
+        runOnWorkers(height, placeBand);
+    } else {
+        placeBand(0, height);
     }
-    
-    // Placer le motif sur la grille
-    for (const auto& coord : coords) {
-        int px = x + coord.first;
-        int py = y + coord.second;
-        
+    return unknown;
+}
+
+void Grid::placeBitmap(const PatternBitmap& bitmap, std::int64_t x, std::int64_t y,
+                       std::int64_t firstRow, std::int64_t endRow) {
+    // Parcourt uniquement les bits à 1 de chaque mot
+    for (std::int64_t py = 0; py < bitmap.height; ++py) {
+        std::int64_t cy = y + py;
         if (toricMode) {
-            px = wrapCoordinate(px, width);
-            py = wrapCoordinate(py, height);
-            cells[py][px].setAlive(true);
-        } else {
-            if (px >= 0 && px < width && py >= 0 && py < height) {
-                cells[py][px].setAlive(true);
+            cy = ((cy % height) + height) % height;
+        }
+        if (cy < firstRow || cy >= endRow) continue;
+
+        const std::uint64_t* row = bitmap.row(py);
+        for (std::int64_t wx = 0; wx < bitmap.wordsPerRow; ++wx) {
+            std::uint64_t word = row[wx];
+            while (word != 0) {
+                std::int64_t px = x + wx * 64 + __builtin_ctzll(word);
+                word &= word - 1;
+
+                if (toricMode) {
+                    px = ((px % width) + width) % width;
+                    cells[cy][px].setAlive(true);
+                } else if (px >= 0 && px < width) {
+                    cells[cy][px].setAlive(true);
+                }
             }
         }
     }
 }
 
 void Grid::clearObstacles() {
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
             cells[y][x].setObstacle(false);
         }
     }
@@ -365,10 +443,10 @@ const Rule& Grid::getRule() const {
     return *rule;
 }
 
-int Grid::countLivingCells() const {
-    int count = 0;
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
+std::int64_t Grid::countLivingCells() const {
+    std::int64_t count = 0;
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
             if (cells[y][x].isAlive()) {
                 count++;
             }
@@ -378,21 +456,5 @@ int Grid::countLivingCells() const {
 }
 
 std::vector<std::string> Grid::getAvailablePatterns() {
-    return {
-        "glider",
-        "blinker",
-        "beacon",
-        "toad",
-        "lwss",
-        "pulsar",
-        "pentadecathlon",
-        "glider_gun",
-        "block",
-        "beehive",
-        "loaf",
-        "boat",
-        "r_pentomino",
-        "diehard",
-        "acorn"
-    };
+    return PatternRegistry::get().getNames();
 }
@@ -4,8 +4,11 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <cstdint>
+#include <functional>
 #include "Cell.hpp"
 #include "Rule.hpp"
+#include "PatternRegistry.hpp"
 
 /**
  * @class Grid
@@ -18,8 +21,8 @@
 class Grid {
 private:
     std::vector<std::vector<Cell>> cells;  // Matrice de cellules
-    int width;   // Largeur de la grille
-    int height;  // Hauteur de la grille
+    std::int64_t width;   // Largeur de la grille (64 bits : grilles de plusieurs milliards de cellules)
+    std::int64_t height;  // Hauteur de la grille
     bool toricMode;  // Mode torique (grille sans bords)
     bool parallelMode;  // Mode parallèle pour le calcul
     std::unique_ptr<Rule> rule;  // Règle d'évolution (Strategy pattern)
@@ -30,7 +33,7 @@ private:
      * @param y Coordonnée y de la cellule
      * @return Nombre de voisines vivantes (0-8)
      */
-    int countLivingNeighbors(int x, int y) const;
+    int countLivingNeighbors(std::int64_t x, std::int64_t y) const;
 
     /**
      * @brief Calcule les coordonnées en mode torique
@@ -38,15 +41,34 @@ private:
      * @param max Valeur maximale
      * @return Coordonnée normalisée
      */
-    int wrapCoordinate(int coord, int max) const;
+    std::int64_t wrapCoordinate(std::int64_t coord, std::int64_t max) const;
+
+    /**
+     * @brief Construit la matrice de cellules
+     *
+     * Pour les grandes grilles, chaque tranche de lignes est construite par le
+     * thread qui la calculera (premier accès : mémoire locale à son nœud).
+     *
+     * @param width Largeur
+     * @param height Hauteur
+     * @return Matrice de cellules mortes
+     */
+    static std::vector<std::vector<Cell>> allocateRows(std::int64_t width, std::int64_t height);
+
+    /**
+     * @brief Place la partie d'un motif comprise dans les lignes [firstRow, endRow)
+     */
+    void placeBitmap(const PatternBitmap& bitmap, std::int64_t x, std::int64_t y,
+                     std::int64_t firstRow, std::int64_t endRow);
 
 public:
     /**
      * @brief Constructeur
      * @param width Largeur de la grille
      * @param height Hauteur de la grille
+     * @throws std::length_error si la grille ne tient pas en mémoire
      */
-    Grid(int width, int height);
+    Grid(std::int64_t width, std::int64_t height);
 
     /**
      * @brief Constructeur par copie
@@ -70,13 +92,13 @@ public:
      * @brief Obtient la largeur de la grille
      * @return Largeur de la grille
      */
-    int getWidth() const;
+    std::int64_t getWidth() const;
 
     /**
      * @brief Obtient la hauteur de la grille
      * @return Hauteur de la grille
      */
-    int getHeight() const;
+    std::int64_t getHeight() const;
 
     /**
      * @brief Obtient une référence à une cellule
@@ -84,7 +106,7 @@ public:
      * @param y Coordonnée y
      * @return Référence à la cellule
      */
-    Cell& getCell(int x, int y);
+    Cell& getCell(std::int64_t x, std::int64_t y);
 
     /**
      * @brief Obtient une référence constante à une cellule
@@ -92,14 +114,26 @@ public:
      * @param y Coordonnée y
      * @return Référence constante à la cellule
      */
-    const Cell& getCell(int x, int y) const;
+    const Cell& getCell(std::int64_t x, std::int64_t y) const;
 
     /**
-     * @brief Initialise la grille avec un état aléatoire
+     * @brief Initialise la grille avec un état aléatoire (graine tirée au hasard)
      * @param probability Probabilité qu'une cellule soit vivante (0.0 à 1.0)
      */
     void randomize(double probability = 0.3);
 
+    /**
+     * @brief Initialise la grille avec un état aléatoire reproductible
+     *
+     * Les cellules sont tirées par mots de 64 via CounterRNG, en parallèle
+     * par bandes de lignes. Une même graine donne toujours la même grille,
+     * quel que soit le nombre de threads.
+     *
+     * @param probability Probabilité qu'une cellule soit vivante (0.0 à 1.0)
+     * @param seed Graine du générateur
+     */
+    void randomize(double probability, std::uint64_t seed);
+
     /**
      * @brief Réinitialise la grille (toutes les cellules mortes)
      */
@@ -124,10 +158,43 @@ public:
 
     /**
      * @brief Redimensionne la grille
+     *
+     * Si la grille demandée ne tient pas en mémoire, un message indiquant
+     * l'estimation de mémoire est affiché et la grille reste inchangée.
+     *
      * @param newWidth Nouvelle largeur
      * @param newHeight Nouvelle hauteur
+     * @return true si le redimensionnement a réussi
+     */
+    bool resize(std::int64_t newWidth, std::int64_t newHeight);
+
+    /**
+     * @brief Estime la mémoire nécessaire pour une grille
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @return Nombre d'octets estimé (UINT64_MAX en cas de dépassement)
+     */
+    static std::uint64_t estimateMemoryBytes(std::int64_t width, std::int64_t height);
+
+    /**
+     * @brief Vérifie qu'une grille peut être allouée
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @param error Sortie : message d'erreur avec l'estimation de mémoire
+     * @return true si les dimensions sont valides et tiennent en mémoire
      */
-    void resize(int newWidth, int newHeight);
+    static bool checkAllocation(std::int64_t width, std::int64_t height, std::string& error);
+
+    /**
+     * @brief Exécute une fonction sur des tranches de lignes, un thread par cœur
+     *
+     * Le découpage ne dépend que du nombre de lignes, et chaque thread est
+     * fixé sur son nœud NUMA : une tranche est toujours traitée au même endroit.
+     *
+     * @param rows Nombre de lignes
+     * @param work Fonction appelée avec (début, fin) pour chaque tranche
+     */
+    static void runOnWorkers(std::int64_t rows, const std::function<void(std::int64_t, std::int64_t)>& work);
 
     /**
      * @brief Sauvegarde la grille dans un fichier
@@ -139,8 +206,9 @@ public:
     /**
      * @brief Copie l'état d'une autre grille
      * @param other Grille à copier
+     * @return false si la grille ne peut pas être redimensionnée (elle reste inchangée)
      */
-    void copyFrom(const Grid& other);
+    bool copyFrom(const Grid& other);
 
     /**
      * @brief Compare deux grilles pour vérifier si elles sont identiques
@@ -179,12 +247,22 @@ public:
     void computeNextGenerationParallel();
 
     /**
-     * @brief Place un motif pré-programmé sur la grille
-     * @param pattern Nom du motif (glider, blinker, beacon, etc.)
+     * @brief Place un motif du catalogue (PatternRegistry) sur la grille
+     * @param pattern Nom du motif (glider, blinker, beacon, ou fichier RLE du répertoire)
      * @param x Position x
      * @param y Position y
+     * @param transform Orientation du motif (rotation ou miroir)
+     */
+    void placePattern(const std::string& pattern, std::int64_t x, std::int64_t y,
+                      PatternTransform transform = PatternTransform::IDENTITY);
+
+    /**
+     * @brief Place une liste de motifs en une passe
+     * @param placements Poses (motif, orientation, position)
+     * @param parallel true pour répartir les lignes entre les threads
+     * @return Nombre de poses dont le motif est inconnu
      */
-    void placePattern(const std::string& pattern, int x, int y);
+    std::int64_t placePatterns(const std::vector<PatternPlacement>& placements, bool parallel = false);
 
     /**
      * @brief Efface tous les obstacles de la grille
@@ -207,7 +285,7 @@ public:
      * @brief Compte le nombre de cellules vivantes dans la grille
      * @return Nombre de cellules vivantes
      */
-    int countLivingCells() const;
+    std::int64_t countLivingCells() const;
 
     /**
      * @brief Obtient la liste des motifs disponibles
@@ -0,0 +1,119 @@
+#include "GridSnapshot.hpp"
+#include "BitGrid.hpp"
+#include "Cell.hpp"
+#include "Grid.hpp"
+#include "GridView.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace {
+
+const std::int64_t WORD_BITS = 64;
+
+/**
+ * @brief En dessous de ce nombre de cellules, la capture reste sur le thread appelant
+ */
+const std::int64_t PARALLEL_THRESHOLD = 1 << 16;
+
+} // namespace
+
+GridSnapshot::GridSnapshot()
+    : width(0), height(0), wordsPerRow(0), obstaclesPresent(false) {
+}
+
+void GridSnapshot::reset(std::int64_t newWidth, std::int64_t newHeight) {
+    width = std::max<std::int64_t>(0, newWidth);
+    height = std::max<std::int64_t>(0, newHeight);
+    wordsPerRow = (width + WORD_BITS - 1) / WORD_BITS;
+    alive.resize(static_cast<size_t>(wordsPerRow * height));
+    obstacles.resize(static_cast<size_t>(wordsPerRow * height));
+    obstaclesPresent = false;
+}
+
+void GridSnapshot::capture(const Grid& grid) {
+    capture(GridView(grid));
+}
+
+void GridSnapshot::capture(const GridView& view) {
+    reset(view.getWidth(), view.getHeight());
+
+    std::atomic<bool> anyObstacle(false);
+    auto work = [this, &view, &anyObstacle](std::int64_t startRow, std::int64_t endRow) {
+        bool found = false;
+        for (std::int64_t y = startRow; y < endRow; ++y) {
+            std::uint64_t* a = alive.data() + y * wordsPerRow;
+            std::uint64_t* o = obstacles.data() + y * wordsPerRow;
+            for (std::int64_t i = 0; i < wordsPerRow; ++i) {
+                std::uint64_t aliveBits = 0;
+                std::uint64_t obstacleBits = 0;
+                const std::int64_t end = std::min(width, (i + 1) * WORD_BITS);
+                for (std::int64_t x = i * WORD_BITS; x < end; ++x) {
+                    const Cell& cell = view.at(x, y);
+                    aliveBits |= static_cast<std::uint64_t>(cell.isAlive()) << (x % WORD_BITS);
+                    obstacleBits |= static_cast<std::uint64_t>(cell.isObstacle()) << (x % WORD_BITS);
+                }
+                a[i] = aliveBits;
+                o[i] = obstacleBits;
+                found = found || obstacleBits != 0;
+            }
+        }
+        if (found) {
+            anyObstacle = true;
+        }
+    };
+    if (width * height < PARALLEL_THRESHOLD) {
+        work(0, height);
+    } else {
+        Grid::runOnWorkers(height, work);
+    }
+    obstaclesPresent = anyObstacle;
+}
+
+void GridSnapshot::capture(const BitGrid& grid) {
+    reset(grid.getWidth(), grid.getHeight());
+    const size_t rowBytes = static_cast<size_t>(wordsPerRow) * sizeof(std::uint64_t);
+    obstaclesPresent = grid.hasObstacles();
+    for (std::int64_t y = 0; y < height; ++y) {
+        std::memcpy(alive.data() + y * wordsPerRow, grid.row(y), rowBytes);
+        if (obstaclesPresent) {
+            std::memcpy(obstacles.data() + y * wordsPerRow, grid.obstacleRow(y), rowBytes);
+        }
+    }
+}
+
+void GridSnapshot::assign(std::int64_t newWidth, std::int64_t newHeight,
+                          const std::uint64_t* aliveWords, const std::uint64_t* obstacleWords) {
+    reset(newWidth, newHeight);
+    const size_t bytes = alive.size() * sizeof(std::uint64_t);
+    if (bytes == 0) return;
+    std::memcpy(alive.data(), aliveWords, bytes);
+    obstaclesPresent = obstacleWords != nullptr;
+    if (obstaclesPresent) {
+        std::memcpy(obstacles.data(), obstacleWords, bytes);
+    }
+}
+
+std::int64_t GridSnapshot::getWidth() const {
+    return width;
+}
+
+std::int64_t GridSnapshot::getHeight() const {
+    return height;
+}
+
+std::int64_t GridSnapshot::getWordsPerRow() const {
+    return wordsPerRow;
+}
+
+bool GridSnapshot::hasObstacles() const {
+    return obstaclesPresent;
+}
+
+const std::uint64_t* GridSnapshot::aliveRow(std::int64_t y) const {
+    return alive.data() + y * wordsPerRow;
+}
+
+const std::uint64_t* GridSnapshot::obstacleRow(std::int64_t y) const {
+    return obstaclesPresent ? obstacles.data() + y * wordsPerRow : nullptr;
+}
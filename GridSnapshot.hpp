@@ -0,0 +1,90 @@
+#ifndef GRIDSNAPSHOT_HPP
+#define GRIDSNAPSHOT_HPP
+
+#include <cstdint>
+#include <vector>
+
+// Déclarations anticipées
+class Grid;
+class GridView;
+class BitGrid;
+
+/**
+ * @class GridSnapshot
+ * @brief Copie compacte d'une génération (lignes de bits comme BitGrid)
+ *
+ * Sert à confier une génération à un autre thread sans copier les
+ * cellules : un bit par cellule vivante, plus un plan d'obstacles s'il y en
+ * a. Les tampons sont conservés d'une capture à l'autre.
+ */
+class GridSnapshot {
+public:
+    GridSnapshot();
+
+    /**
+     * @brief Capture une grille (lignes réparties entre les cœurs si elle est grande)
+     * @param grid Grille à copier
+     */
+    void capture(const Grid& grid);
+
+    /**
+     * @brief Capture une vue
+     * @param view Vue à copier
+     */
+    void capture(const GridView& view);
+
+    /**
+     * @brief Capture une grille compacte (copie des lignes)
+     * @param grid Grille à copier
+     */
+    void capture(const BitGrid& grid);
+
+    /**
+     * @brief Copie des plans déjà compacts (génération relue d'une archive)
+     * @param newWidth Largeur de la grille
+     * @param newHeight Hauteur de la grille
+     * @param aliveWords Cellules vivantes, lignes de getWordsPerRow() mots
+     * @param obstacleWords Obstacles au même format (nullptr sans obstacles)
+     */
+    void assign(std::int64_t newWidth, std::int64_t newHeight,
+                const std::uint64_t* aliveWords, const std::uint64_t* obstacleWords);
+
+    std::int64_t getWidth() const;
+    std::int64_t getHeight() const;
+    std::int64_t getWordsPerRow() const;
+
+    /**
+     * @brief Vérifie si la génération contient des obstacles
+     * @return true si au moins un obstacle
+     */
+    bool hasObstacles() const;
+
+    /**
+     * @brief Accède à une ligne de cellules vivantes
+     * @param y Numéro de ligne
+     * @return Mots de la ligne (bit x % 64 du mot x / 64)
+     */
+    const std::uint64_t* aliveRow(std::int64_t y) const;
+
+    /**
+     * @brief Accède à une ligne d'obstacles
+     * @param y Numéro de ligne
+     * @return Mots de la ligne, nullptr sans obstacles
+     */
+    const std::uint64_t* obstacleRow(std::int64_t y) const;
+
+private:
+    std::int64_t width;
+    std::int64_t height;
+    std::int64_t wordsPerRow;
+    bool obstaclesPresent;
+    std::vector<std::uint64_t> alive;
+    std::vector<std::uint64_t> obstacles;
+
+    /**
+     * @brief Dimensionne les plans (sans libérer la mémoire déjà réservée)
+     */
+    void reset(std::int64_t newWidth, std::int64_t newHeight);
+};
+
+#endif // GRIDSNAPSHOT_HPP
@@ -0,0 +1,225 @@
+#include "GridView.hpp"
+#include "Grid.hpp"
+#include "Cell.hpp"
+#include "CounterRNG.hpp"
+#include "FileHandler.hpp"
+#include <algorithm>
+#include <iostream>
+
+GridView::GridView(const Grid& grid)
+    : GridView(grid, 0, 0, grid.getWidth(), grid.getHeight()) {
+}
+
+GridView::GridView(Grid& grid)
+    : GridView(grid, 0, 0, grid.getWidth(), grid.getHeight()) {
+}
+
+GridView::GridView(const Grid& grid, std::int64_t x, std::int64_t y,
+                   std::int64_t width, std::int64_t height,
+                   std::int64_t strideX, std::int64_t strideY)
+    : source(&grid), target(nullptr), originX(x), originY(y),
+      width(width), height(height), strideX(strideX), strideY(strideY) {
+    clip();
+}
+
+GridView::GridView(Grid& grid, std::int64_t x, std::int64_t y,
+                   std::int64_t width, std::int64_t height,
+                   std::int64_t strideX, std::int64_t strideY)
+    : source(&grid), target(&grid), originX(x), originY(y),
+      width(width), height(height), strideX(strideX), strideY(strideY) {
+    clip();
+}
+
+void GridView::clip() {
+    strideX = std::max<std::int64_t>(strideX, 1);
+    strideY = std::max<std::int64_t>(strideY, 1);
+
+    // Une origine négative décale le début de la vue vers la première cellule valide
+    if (originX < 0) {
+        std::int64_t skip = (-originX + strideX - 1) / strideX;
+        originX += skip * strideX;
+        width -= skip;
+    }
+    if (originY < 0) {
+        std::int64_t skip = (-originY + strideY - 1) / strideY;
+        originY += skip * strideY;
+        height -= skip;
+    }
+
+    std::int64_t maxWidth = (source->getWidth() - originX + strideX - 1) / strideX;
+    std::int64_t maxHeight = (source->getHeight() - originY + strideY - 1) / strideY;
+    width = std::max<std::int64_t>(0, std::min(width, maxWidth));
+    height = std::max<std::int64_t>(0, std::min(height, maxHeight));
+}
+
+std::int64_t GridView::getX() const {
+    return originX;
+}
+
+std::int64_t GridView::getY() const {
+    return originY;
+}
+
+std::int64_t GridView::getWidth() const {
+    return width;
+}
+
+std::int64_t GridView::getHeight() const {
+    return height;
+}
+
+std::int64_t GridView::getStrideX() const {
+    return strideX;
+}
+
+std::int64_t GridView::getStrideY() const {
+    return strideY;
+}
+
+bool GridView::isEmpty() const {
+    return width == 0 || height == 0;
+}
+
+bool GridView::isWritable() const {
+    return target != nullptr;
+}
+
+const Grid& GridView::getGrid() const {
+    return *source;
+}
+
+const Cell& GridView::at(std::int64_t x, std::int64_t y) const {
+    return source->getCell(originX + x * strideX, originY + y * strideY);
+}
+
+GridView GridView::subView(std::int64_t x, std::int64_t y, std::int64_t subWidth, std::int64_t subHeight,
+                           std::int64_t subStrideX, std::int64_t subStrideY) const {
+    // Bornée d'abord à cette vue, puis exprimée dans les coordonnées de la grille
+    x = std::max<std::int64_t>(x, 0);
+    y = std::max<std::int64_t>(y, 0);
+    subStrideX = std::max<std::int64_t>(subStrideX, 1);
+    subStrideY = std::max<std::int64_t>(subStrideY, 1);
+    subWidth = std::min(subWidth, (width - x + subStrideX - 1) / subStrideX);
+    subHeight = std::min(subHeight, (height - y + subStrideY - 1) / subStrideY);
+
+    GridView view(*this);
+    view.originX = originX + x * strideX;
+    view.originY = originY + y * strideY;
+    view.strideX = strideX * subStrideX;
+    view.strideY = strideY * subStrideY;
+    view.width = std::max<std::int64_t>(0, subWidth);
+    view.height = std::max<std::int64_t>(0, subHeight);
+    return view;
+}
+
+std::int64_t GridView::countLivingCells() const {
+    std::int64_t count = 0;
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
+            if (at(x, y).isAlive()) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+std::uint64_t GridView::hash() const {
+    std::uint64_t h = CounterRNG::mix(static_cast<std::uint64_t>(width) * 0x9e3779b97f4a7c15ULL
+                                      ^ static_cast<std::uint64_t>(height));
+
+    // Les cellules sont regroupées par mots de 64 avant mélange
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t wx = 0; wx < width; wx += 64) {
+            std::uint64_t word = 0;
+            std::int64_t end = std::min(width, wx + 64);
+            for (std::int64_t x = wx; x < end; ++x) {
+                if (at(x, y).isAlive()) {
+                    word |= 1ULL << (x - wx);
+                }
+            }
+            h = CounterRNG::mix(h ^ word) + static_cast<std::uint64_t>(y);
+        }
+    }
+    return h;
+}
+
+bool GridView::isEqual(const GridView& other) const {
+    if (width != other.width || height != other.height) {
+        return false;
+    }
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
+            if (at(x, y).isAlive() != other.at(x, y).isAlive()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool GridView::overlaps(const GridView& other) const {
+    if (source != other.source || isEmpty() || other.isEmpty()) {
+        return false;
+    }
+    // Test sur les rectangles englobants (suffisant pour choisir une copie sûre)
+    std::int64_t endX = originX + (width - 1) * strideX;
+    std::int64_t endY = originY + (height - 1) * strideY;
+    std::int64_t otherEndX = other.originX + (other.width - 1) * other.strideX;
+    std::int64_t otherEndY = other.originY + (other.height - 1) * other.strideY;
+    return originX <= otherEndX && other.originX <= endX &&
+           originY <= otherEndY && other.originY <= endY;
+}
+
+bool GridView::blitTo(const GridView& destination) const {
+    if (!destination.isWritable()) {
+        std::cerr << "Erreur : La vue destination est en lecture seule" << std::endl;
+        return false;
+    }
+
+    std::int64_t copyWidth = std::min(width, destination.width);
+    std::int64_t copyHeight = std::min(height, destination.height);
+    if (copyWidth <= 0 || copyHeight <= 0) {
+        return true;
+    }
+
+    // Régions qui se chevauchent : passer par une copie de la source
+    if (overlaps(destination)) {
+        Grid copy(1, 1);
+        if (!subView(0, 0, copyWidth, copyHeight).toGrid(copy)) {
+            return false;
+        }
+        return GridView(static_cast<const Grid&>(copy)).blitTo(destination);
+    }
+
+    for (std::int64_t y = 0; y < copyHeight; ++y) {
+        for (std::int64_t x = 0; x < copyWidth; ++x) {
+            destination.target->getCell(destination.originX + x * destination.strideX,
+                                        destination.originY + y * destination.strideY) = at(x, y);
+        }
+    }
+    return true;
+}
+
+bool GridView::toGrid(Grid& grid) const {
+    if (isEmpty()) {
+        std::cerr << "Erreur : Impossible de copier une vue vide" << std::endl;
+        return false;
+    }
+    if (grid.getWidth() != width || grid.getHeight() != height) {
+        if (!grid.resize(width, height)) {
+            return false;
+        }
+    }
+    for (std::int64_t y = 0; y < height; ++y) {
+        for (std::int64_t x = 0; x < width; ++x) {
+            grid.getCell(x, y) = at(x, y);
+        }
+    }
+    return true;
+}
+
+bool GridView::saveToFile(const std::string& filename) const {
+    auto handler = FileHandlerFactory::createForFile(filename);
+    return handler->saveView(filename, *this);
+}
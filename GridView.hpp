@@ -0,0 +1,166 @@
+#ifndef GRIDVIEW_HPP
+#define GRIDVIEW_HPP
+
+#include <cstdint>
+#include <string>
+
+// Déclarations anticipées
+class Grid;
+class Cell;
+
+/**
+ * @class GridView
+ * @brief Vue rectangulaire sur une grille, sans copie des cellules
+ *
+ * Une vue référence la grille parente : la cellule (x, y) de la vue est la
+ * cellule (originX + x * strideX, originY + y * strideY) de la grille. Un pas
+ * supérieur à 1 échantillonne la région (vignette d'un motif). La vue est
+ * invalidée si la grille parente est redimensionnée ou détruite.
+ *
+ * Une vue construite sur une grille constante est en lecture seule.
+ */
+class GridView {
+public:
+    /**
+     * @brief Vue sur toute la grille (lecture seule)
+     * @param grid Grille parente
+     */
+    explicit GridView(const Grid& grid);
+
+    /**
+     * @brief Vue sur toute la grille (lecture/écriture)
+     * @param grid Grille parente
+     */
+    explicit GridView(Grid& grid);
+
+    /**
+     * @brief Vue sur une région (lecture seule), bornée à la grille
+     * @param grid Grille parente
+     * @param x Colonne d'origine
+     * @param y Ligne d'origine
+     * @param width Largeur de la vue (en cellules de la vue)
+     * @param height Hauteur de la vue
+     * @param strideX Pas horizontal dans la grille (1 = contigu)
+     * @param strideY Pas vertical dans la grille
+     */
+    GridView(const Grid& grid, std::int64_t x, std::int64_t y,
+             std::int64_t width, std::int64_t height,
+             std::int64_t strideX = 1, std::int64_t strideY = 1);
+
+    /**
+     * @brief Vue sur une région (lecture/écriture), bornée à la grille
+     */
+    GridView(Grid& grid, std::int64_t x, std::int64_t y,
+             std::int64_t width, std::int64_t height,
+             std::int64_t strideX = 1, std::int64_t strideY = 1);
+
+    std::int64_t getX() const;
+    std::int64_t getY() const;
+    std::int64_t getWidth() const;
+    std::int64_t getHeight() const;
+    std::int64_t getStrideX() const;
+    std::int64_t getStrideY() const;
+
+    /**
+     * @brief Vérifie si la vue ne contient aucune cellule
+     * @return true si la largeur ou la hauteur est nulle
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Vérifie si la vue permet de modifier la grille
+     * @return true si la grille parente n'est pas constante
+     */
+    bool isWritable() const;
+
+    /**
+     * @brief Obtient la grille parente
+     * @return Référence constante vers la grille
+     */
+    const Grid& getGrid() const;
+
+    /**
+     * @brief Accède à une cellule de la vue
+     * @param x Colonne dans la vue
+     * @param y Ligne dans la vue
+     * @return Référence constante vers la cellule de la grille parente
+     */
+    const Cell& at(std::int64_t x, std::int64_t y) const;
+
+    /**
+     * @brief Obtient une sous-vue (coordonnées et pas relatifs à cette vue)
+     * @return Nouvelle vue sur la même grille
+     */
+    GridView subView(std::int64_t x, std::int64_t y, std::int64_t width, std::int64_t height,
+                     std::int64_t strideX = 1, std::int64_t strideY = 1) const;
+
+    /**
+     * @brief Compte les cellules vivantes de la vue
+     * @return Nombre de cellules vivantes
+     */
+    std::int64_t countLivingCells() const;
+
+    /**
+     * @brief Calcule une empreinte du contenu (cellules vivantes et dimensions)
+     *
+     * L'empreinte ne dépend pas de la position : un même motif à deux endroits
+     * donne la même valeur.
+     *
+     * @return Empreinte sur 64 bits
+     */
+    std::uint64_t hash() const;
+
+    /**
+     * @brief Compare les cellules vivantes de deux vues
+     * @param other Vue à comparer
+     * @return true si dimensions et cellules vivantes sont identiques
+     */
+    bool isEqual(const GridView& other) const;
+
+    /**
+     * @brief Copie le contenu de la vue dans une autre (états et obstacles)
+     *
+     * La zone copiée est l'intersection des deux étendues. Les vues peuvent
+     * se chevaucher sur la même grille.
+     *
+     * @param destination Vue destination (modifiable)
+     * @return false si la destination est en lecture seule
+     */
+    bool blitTo(const GridView& destination) const;
+
+    /**
+     * @brief Copie le contenu dans une grille indépendante (redimensionnée)
+     * @param grid Grille destination
+     * @return false si la vue est vide ou si l'allocation échoue
+     */
+    bool toGrid(Grid& grid) const;
+
+    /**
+     * @brief Sauvegarde la vue (format choisi selon l'extension)
+     * @param filename Chemin du fichier
+     * @return true si la sauvegarde a réussi
+     */
+    bool saveToFile(const std::string& filename) const;
+
+private:
+    const Grid* source;     // Grille parente
+    Grid* target;           // Grille parente modifiable (nullptr si lecture seule)
+    std::int64_t originX;
+    std::int64_t originY;
+    std::int64_t width;
+    std::int64_t height;
+    std::int64_t strideX;
+    std::int64_t strideY;
+
+    /**
+     * @brief Borne l'étendue de la vue à la grille parente
+     */
+    void clip();
+
+    /**
+     * @brief Vérifie si deux vues partagent des cellules de la même grille
+     */
+    bool overlaps(const GridView& other) const;
+};
+
+#endif // GRIDVIEW_HPP
@@ -0,0 +1,176 @@
+#include "HeatMap.hpp"
+#include "Grid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+const std::int64_t WORD_BITS = 64;
+
+/**
+ * @brief Ajoute 1 aux compteurs des cellules marquées (64 compteurs)
+ */
+void addCellCounts(std::uint16_t* counters, std::uint64_t changed) {
+#ifdef __SSE2__
+    // Un octet du mot = 8 compteurs : bits étalés en 0/1, addition saturante.
+    // Sans branchement : les octets nuls ajoutent simplement 0.
+    const __m128i lanes = _mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+    for (int k = 0; k < 8; ++k) {
+        const short bits = static_cast<short>((changed >> (8 * k)) & 0xFF);
+        const __m128i hits = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(bits), lanes), lanes);
+        __m128i* block = reinterpret_cast<__m128i*>(counters + 8 * k);
+        _mm_storeu_si128(block, _mm_adds_epu16(_mm_loadu_si128(block), _mm_srli_epi16(hits, 15)));
+    }
+#else
+    for (int b = 0; b < WORD_BITS; ++b) {
+        const unsigned hit = static_cast<unsigned>(changed >> b) & 1u;
+        counters[b] = static_cast<std::uint16_t>(counters[b] + (hit & (counters[b] != HeatMap::MAX_COUNT)));
+    }
+#endif
+}
+
+/**
+ * @brief Ajoute les changements de chaque octet aux compteurs de 8 tuiles
+ */
+void addTileCounts(std::uint16_t* counters, std::uint64_t changed) {
+    // Popcount de chaque octet en parallèle (SWAR) : octet k = changements de la tuile k
+    std::uint64_t x = changed - ((changed >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+#ifdef __SSE2__
+    const __m128i counts = _mm_unpacklo_epi8(_mm_cvtsi64_si128(static_cast<long long>(x)), _mm_setzero_si128());
+    __m128i* block = reinterpret_cast<__m128i*>(counters);
+    _mm_storeu_si128(block, _mm_adds_epu16(_mm_loadu_si128(block), counts));
+#else
+    const unsigned limit = HeatMap::MAX_COUNT;
+    for (int k = 0; k < 8; ++k) {
+        const unsigned count = static_cast<unsigned>(x >> (8 * k)) & 0xFFu;
+        counters[k] = static_cast<std::uint16_t>(std::min(counters[k] + count, limit));
+    }
+#endif
+}
+
+} // namespace
+
+HeatMap::HeatMap(std::int64_t width, std::int64_t height, Resolution resolution)
+    : width(std::max<std::int64_t>(0, width)), height(std::max<std::int64_t>(0, height)),
+      resolution(resolution), tileSize(resolution == Resolution::TILE ? TILE_SIZE : 1) {
+    // Un bloc de 64 / tileSize compteurs par mot de 64 cellules
+    stride = (this->width + WORD_BITS - 1) / WORD_BITS * (WORD_BITS / tileSize);
+    counters.assign(static_cast<size_t>(stride * getRows()), 0);
+}
+
+std::int64_t HeatMap::getWidth() const {
+    return width;
+}
+
+std::int64_t HeatMap::getHeight() const {
+    return height;
+}
+
+HeatMap::Resolution HeatMap::getResolution() const {
+    return resolution;
+}
+
+int HeatMap::getTileSize() const {
+    return tileSize;
+}
+
+std::int64_t HeatMap::getColumns() const {
+    return (width + tileSize - 1) / tileSize;
+}
+
+std::int64_t HeatMap::getRows() const {
+    return (height + tileSize - 1) / tileSize;
+}
+
+void HeatMap::addWord(std::uint16_t* row, std::int64_t word, std::uint64_t changed) const {
+    if (tileSize == 1) {
+        addCellCounts(row + word * WORD_BITS, changed);
+    } else {
+        addTileCounts(row + word * (WORD_BITS / TILE_SIZE), changed);
+    }
+}
+
+void HeatMap::accumulateRow(std::int64_t y, const std::uint64_t* before, const std::uint64_t* after,
+                            std::int64_t words) {
+    std::uint16_t* row = counters.data() + (y / tileSize) * stride;
+    for (std::int64_t i = 0; i < words; ++i) {
+        const std::uint64_t changed = before[i] ^ after[i];
+        if (changed != 0) {  // Zones calmes : un test par mot
+            addWord(row, i, changed);
+        }
+    }
+}
+
+void HeatMap::accumulate(const Grid& before, const Grid& after) {
+    const std::int64_t w = std::min({width, before.getWidth(), after.getWidth()});
+    const std::int64_t h = std::min({height, before.getHeight(), after.getHeight()});
+    for (std::int64_t y = 0; y < h; ++y) {
+        std::uint16_t* row = counters.data() + (y / tileSize) * stride;
+        for (std::int64_t i = 0; i * WORD_BITS < w; ++i) {
+            // Regrouper les changements par mot de 64 cellules, comme BitGrid
+            std::uint64_t changed = 0;
+            const std::int64_t end = std::min(w, (i + 1) * WORD_BITS);
+            for (std::int64_t x = i * WORD_BITS; x < end; ++x) {
+                if (before.getCell(x, y).isAlive() != after.getCell(x, y).isAlive()) {
+                    changed |= 1ULL << (x % WORD_BITS);
+                }
+            }
+            if (changed != 0) {
+                addWord(row, i, changed);
+            }
+        }
+    }
+}
+
+std::uint16_t HeatMap::get(std::int64_t x, std::int64_t y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) return 0;
+    return counters[static_cast<size_t>((y / tileSize) * stride + x / tileSize)];
+}
+
+std::uint16_t HeatMap::getMax() const {
+    // Les compteurs de remplissage (au-delà de la largeur) restent à zéro
+    return counters.empty() ? 0 : *std::max_element(counters.begin(), counters.end());
+}
+
+void HeatMap::clear() {
+    std::fill(counters.begin(), counters.end(), std::uint16_t(0));
+}
+
+std::uint8_t HeatMap::level(std::uint16_t count, std::uint16_t max) {
+    if (count == 0 || max == 0) return 0;
+    return static_cast<std::uint8_t>(std::lround(255.0 * std::log1p(count) / std::log1p(max)));
+}
+
+bool HeatMap::savePGM(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file) {
+        std::cerr << "Erreur : Impossible de créer le fichier " << filename << std::endl;
+        return false;
+    }
+
+    const std::int64_t columns = getColumns();
+    const std::int64_t rows = getRows();
+    file << "P5\n" << columns << " " << rows << "\n255\n";
+    const std::uint16_t max = getMax();
+    std::vector<char> line(static_cast<size_t>(columns));
+    for (std::int64_t y = 0; y < rows; ++y) {
+        const std::uint16_t* row = counters.data() + y * stride;
+        for (std::int64_t x = 0; x < columns; ++x) {
+            line[x] = static_cast<char>(level(row[x], max));
+        }
+        file.write(line.data(), static_cast<std::streamsize>(line.size()));
+    }
+    if (!file) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,145 @@
+#ifndef HEATMAP_HPP
+#define HEATMAP_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Déclaration anticipée
+class Grid;
+
+/**
+ * @class HeatMap
+ * @brief Carte d'activité : nombre de changements d'état par cellule ou par tuile
+ *
+ * Un compteur saturant de 16 bits par cellule, ou par tuile de
+ * TILE_SIZE x TILE_SIZE cellules. Les compteurs sont rangés comme les mots
+ * de BitGrid (64 cellules, soit 64 compteurs ou 8 tuiles par mot) : le
+ * noyau saute les mots inchangés et met à jour les compteurs d'un mot par
+ * blocs SSE2. Les tuiles gardent les compteurs en cache sur les grandes
+ * grilles. Les valeurs sont affichées sur une échelle logarithmique (PGM,
+ * superposition SFML).
+ */
+class HeatMap {
+public:
+    /**
+     * @brief Résolution de la carte
+     */
+    enum class Resolution {
+        CELL,   // Un compteur par cellule
+        TILE    // Un compteur par tuile de TILE_SIZE x TILE_SIZE cellules
+    };
+
+    /**
+     * @brief Valeur maximale d'un compteur (saturation)
+     */
+    static const std::uint16_t MAX_COUNT = 0xFFFF;
+
+    /**
+     * @brief Côté d'une tuile en cellules
+     */
+    static const int TILE_SIZE = 8;
+
+    /**
+     * @brief Constructeur (compteurs à zéro)
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @param resolution Cellule ou tuile
+     */
+    HeatMap(std::int64_t width, std::int64_t height, Resolution resolution = Resolution::CELL);
+
+    std::int64_t getWidth() const;
+    std::int64_t getHeight() const;
+    Resolution getResolution() const;
+
+    /**
+     * @brief Obtient le côté d'une zone comptée
+     * @return 1 par cellule, TILE_SIZE par tuile
+     */
+    int getTileSize() const;
+
+    /**
+     * @brief Obtient le nombre de colonnes de compteurs
+     * @return Largeur (par cellule) ou colonnes de tuiles
+     */
+    std::int64_t getColumns() const;
+
+    /**
+     * @brief Obtient le nombre de lignes de compteurs
+     * @return Hauteur (par cellule) ou lignes de tuiles
+     */
+    std::int64_t getRows() const;
+
+    /**
+     * @brief Ajoute les changements d'une ligne de BitGrid
+     *
+     * Appelé par les threads de calcul : deux threads ne doivent jamais
+     * traiter des lignes d'une même ligne de tuiles.
+     *
+     * @param y Numéro de ligne
+     * @param before Mots de la ligne avant la génération
+     * @param after Mots de la ligne après la génération
+     * @param words Mots par ligne
+     */
+    void accumulateRow(std::int64_t y, const std::uint64_t* before, const std::uint64_t* after,
+                       std::int64_t words);
+
+    /**
+     * @brief Ajoute les changements entre deux états d'une Grid
+     * @param before Grille avant la génération
+     * @param after Grille après la génération (mêmes dimensions)
+     */
+    void accumulate(const Grid& before, const Grid& after);
+
+    /**
+     * @brief Obtient le compteur d'une cellule (celui de sa tuile)
+     * @param x Colonne de la cellule
+     * @param y Ligne de la cellule
+     * @return Nombre de changements (saturé à MAX_COUNT)
+     */
+    std::uint16_t get(std::int64_t x, std::int64_t y) const;
+
+    /**
+     * @brief Obtient le plus grand compteur
+     * @return Maximum (0 si aucune activité)
+     */
+    std::uint16_t getMax() const;
+
+    /**
+     * @brief Remet les compteurs à zéro
+     */
+    void clear();
+
+    /**
+     * @brief Convertit un compteur en niveau de gris (échelle logarithmique)
+     * @param count Compteur
+     * @param max Plus grand compteur de la carte
+     * @return Niveau de 0 (aucune activité) à 255 (max)
+     */
+    static std::uint8_t level(std::uint16_t count, std::uint16_t max);
+
+    /**
+     * @brief Écrit la carte au format PGM binaire (P5), un pixel par compteur
+     * @param filename Fichier de sortie
+     * @return true si l'écriture a réussi
+     */
+    bool savePGM(const std::string& filename) const;
+
+private:
+    std::int64_t width;
+    std::int64_t height;
+    Resolution resolution;
+    int tileSize;                         // 1 ou TILE_SIZE
+    std::int64_t stride;                  // Compteurs par ligne de compteurs
+    std::vector<std::uint16_t> counters;
+
+    /**
+     * @brief Ajoute les changements d'un mot de 64 cellules
+     * @param row Compteurs de la ligne (ou ligne de tuiles)
+     * @param word Position du mot dans la ligne
+     * @param changed Bit i = la cellule i du mot a changé
+     */
+    void addWord(std::uint16_t* row, std::int64_t word, std::uint64_t changed) const;
+};
+
+#endif // HEATMAP_HPP
@@ -0,0 +1,64 @@
+#include "HugePageBuffer.hpp"
+#include <sys/mman.h>
+
+HugePageBuffer::HugePageBuffer()
+    : address(nullptr), mapping(nullptr), length(0), mapped(0), hugePages(false) {
+}
+
+HugePageBuffer::~HugePageBuffer() {
+    release();
+}
+
+bool HugePageBuffer::allocate(std::uint64_t bytes) {
+    release();
+    if (bytes == 0) return true;
+
+    // Petits tampons : une page énorme serait en grande partie gaspillée
+    bool large = bytes >= HUGE_PAGE_SIZE;
+    std::uint64_t total = large ? bytes + HUGE_PAGE_SIZE : bytes;
+
+    void* region = mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (region == MAP_FAILED) {
+        return false;
+    }
+    mapping = region;
+    mapped = total;
+    length = bytes;
+
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(region);
+    if (large) {
+        start = (start + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    }
+    address = reinterpret_cast<void*>(start);
+
+#ifdef MADV_HUGEPAGE
+    if (large) {
+        hugePages = madvise(address, length, MADV_HUGEPAGE) == 0;
+    }
+#endif
+    return true;
+}
+
+void HugePageBuffer::release() {
+    if (mapping) {
+        munmap(mapping, mapped);
+    }
+    address = nullptr;
+    mapping = nullptr;
+    length = 0;
+    mapped = 0;
+    hugePages = false;
+}
+
+void* HugePageBuffer::data() const {
+    return address;
+}
+
+std::uint64_t HugePageBuffer::size() const {
+    return length;
+}
+
+bool HugePageBuffer::usesHugePages() const {
+    return hugePages;
+}
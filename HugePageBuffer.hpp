@@ -0,0 +1,66 @@
+#ifndef HUGEPAGEBUFFER_HPP
+#define HUGEPAGEBUFFER_HPP
+
+#include <cstdint>
+
+/**
+ * @class HugePageBuffer
+ * @brief Zone mémoire anonyme, en pages énormes (THP) lorsque c'est possible
+ *
+ * La zone est réservée sans être touchée : les pages (remises à zéro par le
+ * système) sont placées sur le nœud NUMA du thread qui y écrit en premier.
+ * Les grands tampons sont alignés sur 2 Mo pour que le noyau puisse les
+ * servir en pages énormes et réduire les défauts de TLB.
+ */
+class HugePageBuffer {
+public:
+    /**
+     * @brief Taille d'une page énorme (x86-64, ARM64 en pages de 4 Ko)
+     */
+    static const std::uint64_t HUGE_PAGE_SIZE = 2ULL * 1024 * 1024;
+
+    HugePageBuffer();
+    ~HugePageBuffer();
+
+    HugePageBuffer(const HugePageBuffer&) = delete;
+    HugePageBuffer& operator=(const HugePageBuffer&) = delete;
+
+    /**
+     * @brief Réserve une zone (libère la précédente)
+     * @param bytes Taille demandée en octets
+     * @return true si la réservation a réussi
+     */
+    bool allocate(std::uint64_t bytes);
+
+    /**
+     * @brief Libère la zone
+     */
+    void release();
+
+    /**
+     * @brief Obtient le début de la zone
+     * @return Pointeur vers la zone, nullptr si vide
+     */
+    void* data() const;
+
+    /**
+     * @brief Obtient la taille demandée
+     * @return Taille en octets
+     */
+    std::uint64_t size() const;
+
+    /**
+     * @brief Vérifie si les pages énormes ont été demandées au noyau
+     * @return true si madvise(MADV_HUGEPAGE) a été accepté
+     */
+    bool usesHugePages() const;
+
+private:
+    void* address;          // Début aligné de la zone
+    void* mapping;          // Début de la projection (avant alignement)
+    std::uint64_t length;   // Taille demandée
+    std::uint64_t mapped;   // Taille projetée
+    bool hugePages;         // Pages énormes acceptées
+};
+
+#endif // HUGEPAGEBUFFER_HPP
@@ -0,0 +1,214 @@
+#include "LifespanMeter.hpp"
+#include "BitGrid.hpp"
+#include "EscapeDetector.hpp"
+#include "Grid.hpp"
+#include "PatternRegistry.hpp"
+#include "StabilizationDetector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+namespace {
+
+typedef std::uint64_t Word;
+
+/**
+ * @brief Vérifie si une cellule vivante occupe le cadre extérieur de la grille
+ *
+ * Tant que le cadre est vide, une génération non torique est exacte : aucune
+ * cellule ne peut naître hors de la grille.
+ */
+bool touchesBorder(const BitGrid& grid) {
+    const std::int64_t width = grid.getWidth();
+    const std::int64_t height = grid.getHeight();
+    const std::int64_t usedWords = (width + 63) / 64;
+    const std::int64_t lastWord = (width - 1) / 64;
+    const Word lastBit = Word(1) << ((width - 1) % 64);
+
+    for (std::int64_t wx = 0; wx < usedWords; ++wx) {
+        if (grid.row(0)[wx] != 0 || grid.row(height - 1)[wx] != 0) {
+            return true;
+        }
+    }
+    for (std::int64_t y = 1; y < height - 1; ++y) {
+        const Word* row = grid.row(y);
+        if ((row[0] & 1) != 0 || (row[lastWord] & lastBit) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Agrandit la grille de GROWTH_PADDING cellules de chaque côté
+ *
+ * Le décalage est un multiple de 64 : les lignes sont recopiées mot à mot.
+ */
+void grow(BitGrid& grid) {
+    const std::int64_t padding = LifespanMeter::GROWTH_PADDING;
+    const std::int64_t wordOffset = padding / 64;
+    BitGrid larger(grid.getWidth() + 2 * padding, grid.getHeight() + 2 * padding);
+    larger.setRuleMasks(grid.getBirthMask(), grid.getSurvivalMask());
+    larger.setParallelMode(grid.isParallelMode());
+
+    const std::int64_t usedWords = (grid.getWidth() + 63) / 64;
+    for (std::int64_t y = 0; y < grid.getHeight(); ++y) {
+        std::copy(grid.row(y), grid.row(y) + usedWords, larger.row(y + padding) + wordOffset);
+    }
+    grid = larger;
+}
+
+/**
+ * @brief Vérifie que les window dernières populations se répètent avec la période donnée
+ */
+bool periodicTail(const std::vector<std::int64_t>& populations, std::int64_t period, std::int64_t window) {
+    const std::int64_t count = static_cast<std::int64_t>(populations.size());
+    if (count < period + window) {
+        return false;
+    }
+    for (std::int64_t k = 1; k <= window; ++k) {
+        if (populations[count - k] != populations[count - k - period]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::int64_t gcd(std::int64_t a, std::int64_t b) {
+    while (b != 0) {
+        std::int64_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+} // namespace
+
+LifespanMeter::LifespanMeter(std::int64_t maxGenerations, std::int64_t maxUniverse)
+    : maxGenerations(std::max<std::int64_t>(1, maxGenerations)), maxUniverse(maxUniverse) {
+}
+
+LifespanResult LifespanMeter::measure(const PatternBitmap& pattern, bool parallel) const {
+    LifespanResult result;
+    result.name = pattern.name;
+
+    BitGrid grid(pattern.width + 2 * GROWTH_PADDING, pattern.height + 2 * GROWTH_PADDING);
+    grid.setParallelMode(parallel);
+    grid.stamp(pattern, GROWTH_PADDING, GROWTH_PADDING);
+
+    EscapeDetector escapes;
+    StabilizationDetector detector(StabilizationDetector::DEFAULT_MAX_PERIOD, CONFIRMATION_WINDOW);
+    detector.observe(grid.hash(), 0);
+
+    // Population totale par génération : cellules vivantes + cellules des vaisseaux retirés
+    std::vector<std::int64_t> populations(1, grid.countLivingCells());
+    std::int64_t removedCells = 0;
+
+    std::int64_t generation = 0;
+    while (generation < maxGenerations && !detector.isSettled()) {
+        grid.step();
+        ++generation;
+
+        if (touchesBorder(grid)) {
+            // Génération exacte, mais la suivante déborderait de l'univers plafonné
+            if (grid.getWidth() + 2 * GROWTH_PADDING > maxUniverse ||
+                grid.getHeight() + 2 * GROWTH_PADDING > maxUniverse) {
+                result.capped = true;
+            } else {
+                grow(grid);
+            }
+        }
+        std::int64_t living = grid.countLivingCells();
+        const bool checked = generation % ESCAPE_CHECK_INTERVAL == 0;
+        if (checked) {
+            if (escapes.removeEscaping(grid, generation, parallel) > 0) {
+                std::int64_t remaining = grid.countLivingCells();
+                removedCells += living - remaining;
+                living = remaining;
+            }
+        }
+        populations.push_back(living + removedCells);
+        detector.observe(grid.hash(), generation);
+
+        // Vaisseaux qui s'éloignent de tout, encore dans la marge : la grille ne se
+        // répétera plus, mais la population si
+        if (checked && escapes.remainingShipsLeave() &&
+            periodicTail(populations, escapes.getRemainingPeriod(), CONFIRMATION_WINDOW)) {
+            result.escaped = true;
+            break;
+        }
+        if (result.capped) {
+            break;
+        }
+    }
+
+    result.generations = generation;
+    result.width = grid.getWidth();
+    result.height = grid.getHeight();
+    result.settled = detector.isSettled() || result.escaped;
+    result.finalPopulation = populations.back();
+
+    if (result.settled) {
+        // Les vaisseaux en vol ont leur propre période : on affine sur le multiple commun
+        const std::int64_t basePeriod = result.escaped ? escapes.getRemainingPeriod() : detector.getPeriod();
+        std::int64_t period = basePeriod;
+        for (const EscapedShip& ship : escapes.getEscaped()) {
+            const std::int64_t shipPeriod = std::max(1, ship.type.period);
+            const std::int64_t combined = period / gcd(period, shipPeriod) * shipPeriod;
+            if (combined <= generation) {
+                period = combined;
+            }
+        }
+        std::int64_t settle = generation - period;
+        while (settle > 0 && populations[settle - 1] == populations[settle - 1 + period]) {
+            --settle;
+        }
+        result.settleGeneration = settle;
+        result.period = static_cast<int>(basePeriod);
+        result.finalPopulation = populations[settle];
+    }
+
+    // Recensement : objets restants puis vaisseaux partis
+    ObjectCensus census;
+    std::vector<const ObjectClass*> classes;
+    census.identify(grid, classes, parallel);
+    for (const EscapedShip& ship : escapes.getEscaped()) {
+        classes.push_back(&ship.type);
+    }
+    result.census = ObjectCensus::tally(classes);
+    return result;
+}
+
+std::vector<LifespanResult> LifespanMeter::measureAll(const std::vector<PatternBitmap>& patterns) const {
+    std::vector<LifespanResult> results(patterns.size());
+    const std::int64_t count = static_cast<std::int64_t>(patterns.size());
+
+    // Les durées varient beaucoup d'un motif à l'autre : chaque thread prend le suivant
+    std::atomic<std::int64_t> next(0);
+    auto work = [&](std::int64_t, std::int64_t) {
+        for (std::int64_t i = next++; i < count; i = next++) {
+            results[i] = measure(patterns[i], false);
+        }
+    };
+    if (count > 1) {
+        Grid::runOnWorkers(count, work);
+    } else {
+        work(0, count);
+    }
+    return results;
+}
+
+void LifespanMeter::print(std::ostream& out, const LifespanResult& result) {
+    out << result.name << " : ";
+    if (result.settled) {
+        out << "stabilisé à la génération " << result.settleGeneration
+            << " (période " << result.period << (result.escaped ? ", vaisseaux en vol" : "") << ")";
+    } else {
+        out << "non stabilisé après " << result.generations << " générations"
+            << (result.capped ? " (univers plafonné)" : "");
+    }
+    out << ", population finale " << result.finalPopulation
+        << ", univers " << result.width << "x" << result.height << "\n";
+    ObjectCensus::print(out, result.census);
+}
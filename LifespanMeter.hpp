@@ -0,0 +1,109 @@
+#ifndef LIFESPANMETER_HPP
+#define LIFESPANMETER_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "ObjectCensus.hpp"
+
+// Déclarations anticipées
+struct PatternBitmap;
+
+/**
+ * @brief Résultat de la mesure de la durée de vie d'un motif
+ */
+struct LifespanResult {
+    std::string name;                  // Nom du motif
+    bool settled = false;              // true si le motif s'est stabilisé avant la limite
+    bool escaped = false;              // true si stabilisé avec des vaisseaux encore en vol
+    bool capped = false;               // true si l'univers a atteint sa taille maximale
+    std::int64_t settleGeneration = -1; // Première génération de l'état final (-1 si non stabilisé)
+    int period = 0;                    // Période de l'état final
+    std::int64_t finalPopulation = 0;  // Population à la stabilisation (vaisseaux partis compris)
+    std::int64_t generations = 0;      // Générations simulées
+    std::int64_t width = 0;            // Taille finale de l'univers
+    std::int64_t height = 0;
+    std::vector<CensusEntry> census;   // Objets restants et vaisseaux partis
+};
+
+/**
+ * @class LifespanMeter
+ * @brief Mesure le temps de stabilisation des mathusalems (r_pentomino, acorn...)
+ *
+ * Le motif évolue sur une BitGrid qui s'agrandit dès qu'une cellule vivante
+ * touche le bord : l'univers se comporte comme un plan infini. Les vaisseaux
+ * qui s'échappent sont retirés (EscapeDetector) pour que l'univers reste
+ * borné, et la stabilisation est détectée sur l'empreinte de la grille
+ * (StabilizationDetector). Si les vaisseaux restants s'éloignent déjà de
+ * tout sans avoir franchi la marge de retrait, et que la population est
+ * périodique, le motif est considéré comme stabilisé (vaisseaux en vol). L'univers ne dépasse pas
+ * maxUniverse cellules de côté : au-delà, la mesure s'arrête (non stabilisé).
+ *
+ * La génération de stabilisation est ensuite affinée sur la population totale
+ * (cellules vivantes plus cellules des vaisseaux retirés) : c'est la première
+ * génération à partir de laquelle elle est périodique, vaisseaux en vol compris.
+ */
+class LifespanMeter {
+public:
+    /**
+     * @brief Nombre maximal de générations simulées par défaut
+     */
+    static const std::int64_t DEFAULT_MAX_GENERATIONS = 100000;
+
+    /**
+     * @brief Générations entre deux recherches de vaisseaux partis
+     */
+    static const std::int64_t ESCAPE_CHECK_INTERVAL = 32;
+
+    /**
+     * @brief Cellules ajoutées de chaque côté quand l'univers s'agrandit
+     */
+    static const std::int64_t GROWTH_PADDING = 64;
+
+    /**
+     * @brief Côté maximal de l'univers par défaut
+     */
+    static const std::int64_t MAX_UNIVERSE_SIZE = 2048;
+
+    /**
+     * @brief Générations de répétition exigées avant de conclure
+     */
+    static const std::int64_t CONFIRMATION_WINDOW = 32;
+
+    /**
+     * @brief Constructeur
+     * @param maxGenerations Limite de générations par motif
+     * @param maxUniverse Côté maximal de l'univers (cellules)
+     */
+    explicit LifespanMeter(std::int64_t maxGenerations = DEFAULT_MAX_GENERATIONS,
+                           std::int64_t maxUniverse = MAX_UNIVERSE_SIZE);
+
+    /**
+     * @brief Mesure la durée de vie d'un motif
+     * @param pattern Motif initial (règle B3/S23)
+     * @param parallel true pour calculer chaque génération en parallèle
+     * @return Résultat de la mesure
+     */
+    LifespanResult measure(const PatternBitmap& pattern, bool parallel = false) const;
+
+    /**
+     * @brief Mesure plusieurs motifs en parallèle (un motif par cœur à la fois)
+     * @param patterns Motifs à mesurer
+     * @return Résultats, dans l'ordre des motifs
+     */
+    std::vector<LifespanResult> measureAll(const std::vector<PatternBitmap>& patterns) const;
+
+    /**
+     * @brief Affiche un résultat (résumé puis recensement)
+     * @param out Flux de sortie
+     * @param result Résultat à afficher
+     */
+    static void print(std::ostream& out, const LifespanResult& result);
+
+private:
+    std::int64_t maxGenerations;
+    std::int64_t maxUniverse;
+};
+
+#endif // LIFESPANMETER_HPP
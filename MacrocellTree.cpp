@@ -0,0 +1,357 @@
+#include "MacrocellTree.hpp"
+#include "BitGrid.hpp"
+#include "Rule.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+const std::int64_t WORD_BITS = 64;
+
+/**
+ * @brief Taille du texte au-delà de laquelle il est écrit dans le fichier
+ */
+const std::size_t FLUSH_BYTES = 1024 * 1024;
+
+} // namespace
+
+std::size_t MacrocellTree::NodeHash::operator()(const Node& node) const {
+    std::uint64_t h = node.leaf * 0x9E3779B97F4A7C15ULL + static_cast<std::uint64_t>(node.level);
+    for (std::uint32_t c : node.child) {
+        h = (h ^ c) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+    }
+    return static_cast<std::size_t>(h);
+}
+
+bool MacrocellTree::NodeEqual::operator()(const Node& a, const Node& b) const {
+    return a.level == b.level && a.leaf == b.leaf && a.child[0] == b.child[0] && a.child[1] == b.child[1] &&
+           a.child[2] == b.child[2] && a.child[3] == b.child[3];
+}
+
+MacrocellTree::MacrocellTree() {
+    clear();
+}
+
+void MacrocellTree::clear() {
+    nodes.assign(1, Node{0, 0, {0, 0, 0, 0}});
+    index.clear();
+    width = height = 0;
+    originX = originY = 0;
+    level = LEAF_LEVEL;
+    rule.clear();
+    generation = 0;
+}
+
+std::uint32_t MacrocellTree::intern(const Node& node) {
+    auto found = index.find(node);
+    if (found != index.end()) {
+        return found->second;
+    }
+    const std::uint32_t id = static_cast<std::uint32_t>(nodes.size());
+    nodes.push_back(node);
+    index.emplace(node, id);
+    return id;
+}
+
+std::uint32_t MacrocellTree::buildNode(int n, std::int64_t x, std::int64_t y, const std::uint64_t* alive,
+                                       std::int64_t wordsPerRow) {
+    if (x >= width || y >= height) {
+        return 0;
+    }
+    if (n == LEAF_LEVEL) {
+        // x est multiple de 8 : chaque ligne du bloc est un octet d'un seul mot
+        std::uint64_t bits = 0;
+        for (int r = 0; r < 8 && y + r < height; ++r) {
+            const std::uint64_t word = alive[(y + r) * wordsPerRow + x / WORD_BITS];
+            bits |= ((word >> (x % WORD_BITS)) & 0xFFu) << (8 * r);
+        }
+        return bits == 0 ? 0 : intern(Node{LEAF_LEVEL, bits, {0, 0, 0, 0}});
+    }
+
+    const std::int64_t half = 1LL << (n - 1);
+    Node node{n, 0, {buildNode(n - 1, x, y, alive, wordsPerRow),
+                     buildNode(n - 1, x + half, y, alive, wordsPerRow),
+                     buildNode(n - 1, x, y + half, alive, wordsPerRow),
+                     buildNode(n - 1, x + half, y + half, alive, wordsPerRow)}};
+    if ((node.child[0] | node.child[1] | node.child[2] | node.child[3]) == 0) {
+        return 0;
+    }
+    return intern(node);
+}
+
+void MacrocellTree::build(std::int64_t gridWidth, std::int64_t gridHeight, const std::uint64_t* alive) {
+    clear();
+    width = gridWidth;
+    height = gridHeight;
+    while (level < MAX_LEVEL && (1LL << level) < std::max(width, height)) {
+        ++level;
+    }
+    buildNode(level, 0, 0, alive, (width + WORD_BITS - 1) / WORD_BITS);
+    index.clear();  // Inutile une fois l'arbre construit
+}
+
+bool MacrocellTree::write(const std::string& filename, const std::string& ruleNotation,
+                          std::int64_t gen) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Erreur : Impossible de créer le fichier " << filename << std::endl;
+        return false;
+    }
+
+    std::string text = "[M2] (JeDeLaVie)\n#R " + ruleNotation + "\n#G " + std::to_string(gen) +
+                       "\n#C x = " + std::to_string(width) + ", y = " + std::to_string(height) + "\n";
+    for (std::size_t i = 1; i < nodes.size() && file; ++i) {
+        const Node& node = nodes[i];
+        if (node.level == LEAF_LEVEL) {
+            // Lignes du bloc jusqu'à la dernière non vide, cellules jusqu'à la dernière vivante
+            int lastRow = 7;
+            while (((node.leaf >> (8 * lastRow)) & 0xFFu) == 0) --lastRow;
+            for (int r = 0; r <= lastRow; ++r) {
+                const unsigned row = static_cast<unsigned>(node.leaf >> (8 * r)) & 0xFFu;
+                for (int c = 0; row >> c != 0; ++c) {
+                    text += ((row >> c) & 1u) ? '*' : '.';
+                }
+                text += '$';
+            }
+            text += '\n';
+        } else {
+            text += std::to_string(node.level);
+            for (std::uint32_t c : node.child) {
+                text += ' ';
+                text += std::to_string(c);
+            }
+            text += '\n';
+        }
+        if (text.size() >= FLUSH_BYTES) {
+            file.write(text.data(), static_cast<std::streamsize>(text.size()));
+            text.clear();
+        }
+    }
+    file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    if (!file) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool MacrocellTree::parse(const std::string& filename) {
+    clear();
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Erreur : Impossible d'ouvrir le fichier " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line.compare(0, 4, "[M2]") != 0) {
+        std::cerr << "Erreur : " << filename << " n'est pas un fichier Macrocell" << std::endl;
+        return false;
+    }
+
+    long long sizeX = 0, sizeY = 0;
+    std::int64_t lineNumber = 1;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+
+        if (line[0] == '#') {
+            // Autres commentaires (#C, #N, #D...) ignorés
+            long long value = 0, valueY = 0;
+            if (line.compare(0, 3, "#R ") == 0) {
+                rule = line.substr(3);
+            } else if (std::sscanf(line.c_str(), "#G %lld", &value) == 1) {
+                generation = value;
+            } else if (std::sscanf(line.c_str(), "#C x = %lld, y = %lld", &value, &valueY) == 2) {
+                sizeX = value;
+                sizeY = valueY;
+            }
+            continue;
+        }
+
+        Node node{LEAF_LEVEL, 0, {0, 0, 0, 0}};
+        bool valid = true;
+        if (line[0] == '.' || line[0] == '*' || line[0] == '$') {
+            int x = 0, y = 0;
+            for (char c : line) {
+                if (c == '$') {
+                    ++y;
+                    x = 0;
+                } else if (c == '.' || c == '*') {
+                    valid = valid && x < 8 && y < 8;
+                    if (valid && c == '*') node.leaf |= 1ULL << (8 * y + x);
+                    ++x;
+                } else if (c != ' ') {
+                    valid = false;
+                }
+            }
+        } else {
+            // "niveau no ne so se" : enfants déjà lus, d'un niveau de moins (ou vides)
+            std::istringstream iss(line);
+            std::int64_t children[4];
+            valid = static_cast<bool>(iss >> node.level >> children[0] >> children[1] >> children[2] >> children[3]);
+            if (valid && node.level <= LEAF_LEVEL) {
+                std::cerr << "Erreur : Macrocell à plusieurs états non supporté (ligne " << lineNumber << ")" << std::endl;
+                return false;
+            }
+            valid = valid && node.level <= MAX_LEVEL;
+            for (int i = 0; i < 4 && valid; ++i) {
+                const std::int64_t c = children[i];
+                valid = c >= 0 && c < static_cast<std::int64_t>(nodes.size()) &&
+                        (c == 0 || nodes[c].level == node.level - 1);
+                node.child[i] = valid ? static_cast<std::uint32_t>(c) : 0;
+            }
+        }
+        if (!valid) {
+            std::cerr << "Erreur : Nœud Macrocell invalide à la ligne " << lineNumber << std::endl;
+            return false;
+        }
+        nodes.push_back(node);
+    }
+
+    level = nodes.size() > 1 ? nodes.back().level : LEAF_LEVEL;
+    if (sizeX > 0 && sizeY > 0) {
+        width = sizeX;
+        height = sizeY;
+        return true;
+    }
+    if (nodes.size() == 1) {
+        std::cerr << "Erreur : Fichier Macrocell vide et sans dimensions" << std::endl;
+        return false;
+    }
+
+    // Sans dimensions : boîte englobante, calculée dans l'ordre du fichier (enfants d'abord)
+    const std::int64_t NONE = std::numeric_limits<std::int64_t>::max();
+    std::vector<Box> boxes(nodes.size(), Box{NONE, NONE, -1, -1});
+    for (std::size_t i = 1; i < nodes.size(); ++i) {
+        const Node& node = nodes[i];
+        Box& box = boxes[i];
+        if (node.level == LEAF_LEVEL) {
+            for (int b = 0; b < 64; ++b) {
+                if ((node.leaf >> b) & 1) {
+                    box.minX = std::min<std::int64_t>(box.minX, b % 8);
+                    box.maxX = std::max<std::int64_t>(box.maxX, b % 8);
+                    box.minY = std::min<std::int64_t>(box.minY, b / 8);
+                    box.maxY = std::max<std::int64_t>(box.maxY, b / 8);
+                }
+            }
+            continue;
+        }
+        const std::int64_t half = 1LL << (node.level - 1);
+        for (int k = 0; k < 4; ++k) {
+            const Box& child = boxes[node.child[k]];
+            if (child.minX == NONE) continue;
+            const std::int64_t dx = (k % 2) * half;
+            const std::int64_t dy = (k / 2) * half;
+            box.minX = std::min(box.minX, child.minX + dx);
+            box.maxX = std::max(box.maxX, child.maxX + dx);
+            box.minY = std::min(box.minY, child.minY + dy);
+            box.maxY = std::max(box.maxY, child.maxY + dy);
+        }
+    }
+    const Box& root = boxes.back();
+    if (root.minX == NONE) {
+        std::cerr << "Erreur : Fichier Macrocell vide et sans dimensions" << std::endl;
+        return false;
+    }
+    originX = root.minX;
+    originY = root.minY;
+    width = root.maxX - root.minX + 1;
+    height = root.maxY - root.minY + 1;
+    return true;
+}
+
+void MacrocellTree::paint(std::uint32_t id, std::int64_t x, std::int64_t y, BitGrid& grid) const {
+    const Node& node = nodes[id];
+    const std::int64_t gx = x - originX;
+    const std::int64_t gy = y - originY;
+    const std::int64_t size = 1LL << node.level;
+    if (id == 0 || gx >= width || gy >= height || gx + size <= 0 || gy + size <= 0) {
+        return;
+    }
+
+    if (node.level == LEAF_LEVEL) {
+        const std::int64_t words = grid.getWordsPerRow();
+        const std::uint64_t lastMask = width % WORD_BITS == 0 ? ~0ULL : (1ULL << (width % WORD_BITS)) - 1;
+        for (int r = 0; r < 8; ++r) {
+            std::uint64_t bits = (node.leaf >> (8 * r)) & 0xFFu;
+            std::int64_t px = gx;
+            if (bits == 0 || gy + r < 0 || gy + r >= height) continue;
+            if (px < 0) {
+                bits >>= -px;
+                px = 0;
+            }
+            std::uint64_t* row = grid.row(gy + r);
+            const std::int64_t w = px / WORD_BITS;
+            const int s = static_cast<int>(px % WORD_BITS);
+            row[w] |= bits << s;
+            if (s > WORD_BITS - 8 && w + 1 < words) {
+                row[w + 1] |= bits >> (WORD_BITS - s);
+            }
+            if (px + 8 > width) {
+                row[(width - 1) / WORD_BITS] &= lastMask;  // Rien au-delà de la grille
+            }
+        }
+        return;
+    }
+
+    const std::int64_t half = size / 2;
+    paint(node.child[0], x, y, grid);
+    paint(node.child[1], x + half, y, grid);
+    paint(node.child[2], x, y + half, grid);
+    paint(node.child[3], x + half, y + half, grid);
+}
+
+std::unique_ptr<BitGrid> MacrocellTree::toBitGrid() const {
+    if (width <= 0 || height <= 0) {
+        return nullptr;
+    }
+    std::unique_ptr<BitGrid> grid;
+    try {
+        grid.reset(new BitGrid(width, height));
+    } catch (const std::exception&) {
+        std::cerr << "Erreur : Mémoire insuffisante pour une grille " << width << "x" << height << std::endl;
+        return nullptr;
+    }
+    grid->setGeneration(generation);
+    if (!rule.empty()) {
+        std::unique_ptr<Rule> parsed = RuleFactory::createFromString(rule);
+        if (parsed) {
+            grid->setRule(*parsed);
+        }
+    }
+    if (nodes.size() > 1) {
+        paint(static_cast<std::uint32_t>(nodes.size() - 1), 0, 0, *grid);
+    }
+    return grid;
+}
+
+std::int64_t MacrocellTree::getWidth() const {
+    return width;
+}
+
+std::int64_t MacrocellTree::getHeight() const {
+    return height;
+}
+
+int MacrocellTree::getLevel() const {
+    return level;
+}
+
+std::int64_t MacrocellTree::getNodeCount() const {
+    return static_cast<std::int64_t>(nodes.size()) - 1;
+}
+
+const std::string& MacrocellTree::getRule() const {
+    return rule;
+}
+
+std::int64_t MacrocellTree::getGeneration() const {
+    return generation;
+}
@@ -0,0 +1,151 @@
+#ifndef MACROCELLTREE_HPP
+#define MACROCELLTREE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Déclarations anticipées
+class BitGrid;
+
+/**
+ * @class MacrocellTree
+ * @brief Arbre quaternaire à nœuds partagés, lu et écrit au format Macrocell (.mc)
+ *
+ * La grille est découpée en carrés de 2^niveau cellules. Les feuilles
+ * (niveau LEAF_LEVEL) sont des blocs de 8x8 cellules tenant dans un mot de
+ * 64 bits (octet r = ligne r) ; un nœud de niveau n a quatre enfants de
+ * niveau n - 1 (nord-ouest, nord-est, sud-ouest, sud-est). Chaque nœud
+ * distinct n'existe qu'une fois (table de hachage sur son contenu) et le
+ * numéro 0 désigne un carré vide de n'importe quel niveau : un motif
+ * répétitif ne coûte que ses blocs différents, quelle que soit sa surface.
+ *
+ * Format (compatible Golly) :
+ * - "[M2] (...)", puis les commentaires "#R règle", "#G génération" et
+ *   "#C x = largeur, y = hauteur" (dimensions de la grille) ;
+ * - une ligne par nœud, numérotés à partir de 1 dans l'ordre du fichier,
+ *   enfants avant parents : une feuille s'écrit ligne par ligne avec "."
+ *   mort, "*" vivant, "$" fin de ligne ; un nœud "niveau no ne so se" ;
+ * - le dernier nœud est la racine, dont le coin nord-ouest est la cellule
+ *   (0, 0). Sans dimensions (fichier Golly), la grille est la boîte
+ *   englobante des cellules vivantes.
+ */
+class MacrocellTree {
+public:
+    static const int LEAF_LEVEL = 3;
+    static const int MAX_LEVEL = 60;
+
+    MacrocellTree();
+
+    /**
+     * @brief Construit l'arbre d'une grille
+     * @param width Largeur
+     * @param height Hauteur
+     * @param alive Lignes de bits contiguës (bit x % 64 du mot x / 64)
+     */
+    void build(std::int64_t width, std::int64_t height, const std::uint64_t* alive);
+
+    /**
+     * @brief Écrit l'arbre au format Macrocell
+     * @param filename Fichier de sortie
+     * @param rule Notation B/S de la règle
+     * @param generation Génération
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const std::string& rule, std::int64_t generation) const;
+
+    /**
+     * @brief Lit un fichier Macrocell
+     * @param filename Fichier à lire
+     * @return false si le fichier est absent ou mal formé (message sur std::cerr)
+     */
+    bool parse(const std::string& filename);
+
+    /**
+     * @brief Dessine l'arbre dans une nouvelle BitGrid (règle et génération comprises)
+     * @return Grille, nullptr si elle ne peut pas être allouée
+     */
+    std::unique_ptr<BitGrid> toBitGrid() const;
+
+    std::int64_t getWidth() const;
+    std::int64_t getHeight() const;
+
+    /**
+     * @brief Obtient le niveau de la racine
+     * @return Niveau (la racine couvre 2^niveau cellules de côté)
+     */
+    int getLevel() const;
+
+    /**
+     * @brief Obtient le nombre de nœuds distincts (feuilles comprises)
+     * @return Nombre de nœuds non vides
+     */
+    std::int64_t getNodeCount() const;
+
+    /**
+     * @brief Obtient la règle lue ("" si le fichier n'en donne pas)
+     */
+    const std::string& getRule() const;
+
+    std::int64_t getGeneration() const;
+
+private:
+    /**
+     * @brief Nœud : feuille (bits) ou enfants (numéros, 0 = vide)
+     */
+    struct Node {
+        int level;
+        std::uint64_t leaf;
+        std::uint32_t child[4];
+    };
+
+    /**
+     * @brief Boîte englobante des cellules vivantes d'un nœud (coordonnées dans le nœud)
+     */
+    struct Box {
+        std::int64_t minX, minY, maxX, maxY;
+    };
+
+    struct NodeHash {
+        std::size_t operator()(const Node& node) const;
+    };
+
+    struct NodeEqual {
+        bool operator()(const Node& a, const Node& b) const;
+    };
+
+    std::vector<Node> nodes;                 // nodes[0] : carré vide
+    std::unordered_map<Node, std::uint32_t, NodeHash, NodeEqual> index;
+    std::int64_t width;
+    std::int64_t height;
+    std::int64_t originX;                    // Cellule de l'arbre placée en (0, 0) de la grille
+    std::int64_t originY;
+    int level;
+    std::string rule;
+    std::int64_t generation;
+
+    /**
+     * @brief Vide l'arbre
+     */
+    void clear();
+
+    /**
+     * @brief Retourne le numéro d'un nœud, créé s'il n'existe pas encore
+     */
+    std::uint32_t intern(const Node& node);
+
+    /**
+     * @brief Construit le nœud du carré de niveau n au coin (x, y)
+     */
+    std::uint32_t buildNode(int n, std::int64_t x, std::int64_t y, const std::uint64_t* alive,
+                            std::int64_t wordsPerRow);
+
+    /**
+     * @brief Dessine un nœud dont le coin nord-ouest est en (x, y) de l'arbre
+     */
+    void paint(std::uint32_t id, std::int64_t x, std::int64_t y, BitGrid& grid) const;
+};
+
+#endif // MACROCELLTREE_HPP
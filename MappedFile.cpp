@@ -0,0 +1,147 @@
+#include "MappedFile.hpp"
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+MappedFile::MappedFile() : fd(-1), address(nullptr), length(0) {
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& path, Mode mode) {
+    close();
+
+    int flags = (mode == Mode::READ_WRITE) ? O_RDWR : O_RDONLY;
+    fd = ::open(path.c_str(), flags);
+    if (fd < 0) {
+        std::cerr << "Erreur : Impossible d'ouvrir le fichier " << path
+                  << " (" << std::strerror(errno) << ")" << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        std::cerr << "Erreur : Fichier vide ou illisible " << path << std::endl;
+        close();
+        return false;
+    }
+    length = static_cast<std::uint64_t>(info.st_size);
+
+    int prot = PROT_READ;
+    int share = MAP_SHARED;
+    if (mode == Mode::READ_WRITE) {
+        prot |= PROT_WRITE;
+    } else if (mode == Mode::COPY_ON_WRITE) {
+        prot |= PROT_WRITE;
+        share = MAP_PRIVATE;
+    }
+
+    void* mapped = mmap(nullptr, length, prot, share, fd, 0);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "Erreur : Projection mémoire impossible pour " << path
+                  << " (" << std::strerror(errno) << ")" << std::endl;
+        close();
+        return false;
+    }
+    address = static_cast<unsigned char*>(mapped);
+    return true;
+}
+
+bool MappedFile::create(const std::string& path, std::uint64_t size) {
+    close();
+
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "Erreur : Impossible de créer le fichier " << path
+                  << " (" << std::strerror(errno) << ")" << std::endl;
+        return false;
+    }
+
+    // ftruncate crée un fichier creux : seules les pages écrites occupent le disque
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        std::cerr << "Erreur : Impossible de dimensionner " << path << " à " << size
+                  << " octets (" << std::strerror(errno) << ")" << std::endl;
+        close();
+        return false;
+    }
+    length = size;
+
+    void* mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "Erreur : Projection mémoire impossible pour " << path
+                  << " (" << std::strerror(errno) << ")" << std::endl;
+        close();
+        return false;
+    }
+    address = static_cast<unsigned char*>(mapped);
+    return true;
+}
+
+void MappedFile::close() {
+    if (address) {
+        munmap(address, length);
+        address = nullptr;
+    }
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    length = 0;
+}
+
+bool MappedFile::isOpen() const {
+    return address != nullptr;
+}
+
+unsigned char* MappedFile::data() {
+    return address;
+}
+
+const unsigned char* MappedFile::data() const {
+    return address;
+}
+
+std::uint64_t MappedFile::size() const {
+    return length;
+}
+
+std::uint64_t MappedFile::pageSize() {
+    static const std::uint64_t size = static_cast<std::uint64_t>(sysconf(_SC_PAGE_SIZE));
+    return size;
+}
+
+bool MappedFile::alignRange(std::uint64_t& offset, std::uint64_t& len) const {
+    if (!address || offset >= length) return false;
+    if (len > length - offset) len = length - offset;
+
+    std::uint64_t page = pageSize();
+    std::uint64_t start = offset - (offset % page);
+    len += offset - start;
+    offset = start;
+    return len > 0;
+}
+
+void MappedFile::advise(std::uint64_t offset, std::uint64_t len, Advice advice) const {
+    if (!alignRange(offset, len)) return;
+
+    int flag = MADV_NORMAL;
+    switch (advice) {
+        case Advice::SEQUENTIAL: flag = MADV_SEQUENTIAL; break;
+        case Advice::WILL_NEED:  flag = MADV_WILLNEED; break;
+        case Advice::DONT_NEED:  flag = MADV_DONTNEED; break;
+        default: break;
+    }
+    // Un conseil refusé n'est pas une erreur : on l'ignore
+    madvise(address + offset, len, flag);
+}
+
+bool MappedFile::sync(std::uint64_t offset, std::uint64_t len, bool wait) const {
+    if (!alignRange(offset, len)) return true;
+    return msync(address + offset, len, wait ? MS_SYNC : MS_ASYNC) == 0;
+}
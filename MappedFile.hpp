@@ -0,0 +1,124 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <string>
+#include <cstdint>
+
+/**
+ * @class MappedFile
+ * @brief Fichier projeté en mémoire (RAII autour de mmap)
+ *
+ * Sert de support aux grilles plus grandes que la RAM : le système pagine
+ * le fichier à la demande, et les conseils madvise() permettent de lui
+ * indiquer l'ordre d'accès (séquentiel, prochaine bande, bande terminée).
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Modes d'ouverture
+     */
+    enum class Mode {
+        READ_ONLY,      // Lecture seule, partagée
+        READ_WRITE,     // Lecture/écriture, les écritures vont dans le fichier
+        COPY_ON_WRITE   // Lecture/écriture privée, le fichier n'est jamais modifié
+    };
+
+    /**
+     * @brief Conseils d'accès transmis au système
+     */
+    enum class Advice {
+        NORMAL,
+        SEQUENTIAL,  // Lecture séquentielle : lecture anticipée agressive
+        WILL_NEED,   // Zone bientôt utilisée : précharger
+        DONT_NEED    // Zone terminée : les pages peuvent être libérées
+    };
+
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Projette un fichier existant
+     * @param path Chemin du fichier
+     * @param mode Mode d'ouverture
+     * @return true si la projection a réussi
+     */
+    bool open(const std::string& path, Mode mode);
+
+    /**
+     * @brief Crée (ou tronque) un fichier de la taille donnée et le projette en lecture/écriture
+     * @param path Chemin du fichier
+     * @param size Taille en octets
+     * @return true si la création a réussi
+     */
+    bool create(const std::string& path, std::uint64_t size);
+
+    /**
+     * @brief Libère la projection et ferme le fichier
+     */
+    void close();
+
+    /**
+     * @brief Vérifie si un fichier est projeté
+     * @return true si la projection est active
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Obtient l'adresse du début de la projection
+     * @return Pointeur vers les données
+     */
+    unsigned char* data();
+
+    /**
+     * @brief Obtient l'adresse du début de la projection (lecture seule)
+     * @return Pointeur constant vers les données
+     */
+    const unsigned char* data() const;
+
+    /**
+     * @brief Obtient la taille projetée
+     * @return Taille en octets
+     */
+    std::uint64_t size() const;
+
+    /**
+     * @brief Transmet un conseil d'accès pour une zone (alignée sur les pages)
+     * @param offset Début de la zone
+     * @param length Longueur de la zone
+     * @param advice Conseil
+     */
+    void advise(std::uint64_t offset, std::uint64_t length, Advice advice) const;
+
+    /**
+     * @brief Écrit une zone modifiée sur le disque
+     * @param offset Début de la zone
+     * @param length Longueur de la zone
+     * @param wait true pour attendre la fin de l'écriture (point de reprise)
+     * @return true si la synchronisation a réussi
+     */
+    bool sync(std::uint64_t offset, std::uint64_t length, bool wait) const;
+
+    /**
+     * @brief Obtient la taille d'une page mémoire
+     * @return Taille en octets
+     */
+    static std::uint64_t pageSize();
+
+private:
+    int fd;                 // Descripteur du fichier
+    unsigned char* address; // Début de la projection
+    std::uint64_t length;   // Taille projetée
+
+    /**
+     * @brief Aligne une zone sur les pages
+     * @param offset Début (aligné vers le bas en sortie)
+     * @param length Longueur (ajustée en sortie)
+     * @return false si la zone est vide après alignement
+     */
+    bool alignRange(std::uint64_t& offset, std::uint64_t& length) const;
+};
+
+#endif // MAPPEDFILE_HPP
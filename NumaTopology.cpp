@@ -0,0 +1,78 @@
+#include "NumaTopology.hpp"
+#include <fstream>
+#include <sstream>
+#include <pthread.h>
+#include <sched.h>
+
+NumaTopology::NumaTopology() {
+    // Les nœuds sont numérotés de façon contiguë à partir de 0
+    for (int node = 0; ; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file) break;
+        std::string list;
+        std::getline(file, list);
+        nodes.push_back(parseCpuList(list));
+    }
+
+    // Machine non NUMA ou /sys indisponible : un seul nœud
+    if (nodes.empty()) {
+        nodes.emplace_back();
+    }
+}
+
+const NumaTopology& NumaTopology::get() {
+    static const NumaTopology topology;
+    return topology;
+}
+
+int NumaTopology::getNodeCount() const {
+    return static_cast<int>(nodes.size());
+}
+
+const std::vector<int>& NumaTopology::getCpus(int node) const {
+    return nodes[node];
+}
+
+int NumaTopology::nodeForWorker(unsigned int worker, unsigned int numWorkers) const {
+    if (numWorkers == 0) return 0;
+    // Blocs contigus : les premières tranches de lignes sur le nœud 0, etc.
+    return static_cast<int>(static_cast<unsigned long long>(worker) * nodes.size() / numWorkers);
+}
+
+int NumaTopology::pinWorker(unsigned int worker, unsigned int numWorkers) const {
+    int node = nodeForWorker(worker, numWorkers);
+    if (nodes.size() < 2 || nodes[node].empty()) {
+        return node;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : nodes[node]) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    // Un échec (processeurs interdits par cgroup, etc.) n'empêche pas le calcul
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    return node;
+}
+
+std::vector<int> NumaTopology::parseCpuList(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty()) continue;
+        try {
+            size_t dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::exception&) {
+            // Entrée mal formée : ignorée
+        }
+    }
+    return cpus;
+}
@@ -0,0 +1,72 @@
+#ifndef NUMATOPOLOGY_HPP
+#define NUMATOPOLOGY_HPP
+
+#include <string>
+#include <vector>
+
+/**
+ * @class NumaTopology
+ * @brief Topologie NUMA de la machine (nœuds mémoire et leurs processeurs)
+ *
+ * Lue une seule fois dans /sys/devices/system/node. Les threads de calcul
+ * sont répartis par blocs contigus sur les nœuds : le thread qui initialise
+ * une tranche de lignes (premier accès) est aussi celui qui la calcule, sur
+ * le même nœud, donc en mémoire locale.
+ */
+class NumaTopology {
+public:
+    /**
+     * @brief Obtient la topologie de la machine (détectée au premier appel)
+     * @return Topologie partagée
+     */
+    static const NumaTopology& get();
+
+    /**
+     * @brief Obtient le nombre de nœuds NUMA
+     * @return Nombre de nœuds (1 sur une machine non NUMA)
+     */
+    int getNodeCount() const;
+
+    /**
+     * @brief Obtient les processeurs d'un nœud
+     * @param node Numéro du nœud
+     * @return Liste des processeurs (vide si inconnue)
+     */
+    const std::vector<int>& getCpus(int node) const;
+
+    /**
+     * @brief Calcule le nœud d'un thread de calcul
+     * @param worker Indice du thread (0 à numWorkers - 1)
+     * @param numWorkers Nombre de threads
+     * @return Nœud attribué au thread
+     */
+    int nodeForWorker(unsigned int worker, unsigned int numWorkers) const;
+
+    /**
+     * @brief Fixe le thread courant sur les processeurs de son nœud
+     *
+     * Sans effet sur une machine à un seul nœud.
+     *
+     * @param worker Indice du thread
+     * @param numWorkers Nombre de threads
+     * @return Nœud attribué au thread
+     */
+    int pinWorker(unsigned int worker, unsigned int numWorkers) const;
+
+    /**
+     * @brief Décode une liste de processeurs au format du noyau ("0-3,8,10-11")
+     * @param list Liste à décoder
+     * @return Numéros des processeurs
+     */
+    static std::vector<int> parseCpuList(const std::string& list);
+
+private:
+    std::vector<std::vector<int>> nodes;  // Processeurs de chaque nœud
+
+    /**
+     * @brief Constructeur : lit la topologie du système
+     */
+    NumaTopology();
+};
+
+#endif // NUMATOPOLOGY_HPP
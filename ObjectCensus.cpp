@@ -0,0 +1,734 @@
+#include "ObjectCensus.hpp"
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+
+namespace {
+
+typedef BitGrid::Word Word;
+
+/**
+ * @brief Segment de cellules vivantes consécutives sur une ligne : [x0, x1]
+ */
+struct Run {
+    std::int64_t y;
+    std::int64_t x0;
+    std::int64_t x1;
+};
+
+/**
+ * @brief Racine d'un élément (compression de chemin par moitiés)
+ */
+std::int64_t findRoot(std::vector<std::int64_t>& parent, std::int64_t i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+/**
+ * @brief Réunit deux ensembles ; la racine est toujours le plus petit indice
+ */
+void unite(std::vector<std::int64_t>& parent, std::int64_t a, std::int64_t b) {
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a < b) {
+        parent[b] = a;
+    } else if (b < a) {
+        parent[a] = b;
+    }
+}
+
+/**
+ * @brief Réunit les segments de deux lignes voisines qui se touchent (8-connexité)
+ * @param above Segments de la ligne du dessus, triés par x
+ * @param aboveBase Indice du premier segment du dessus dans parent
+ * @param below Segments de la ligne du dessous, triés par x
+ * @param belowBase Indice du premier segment du dessous dans parent
+ */
+void linkRows(const Run* above, std::int64_t aboveCount, std::int64_t aboveBase,
+              const Run* below, std::int64_t belowCount, std::int64_t belowBase,
+              std::vector<std::int64_t>& parent) {
+    std::int64_t i = 0;
+    std::int64_t j = 0;
+    while (i < aboveCount && j < belowCount) {
+        if (above[i].x1 + 1 < below[j].x0) {
+            ++i;
+        } else if (below[j].x1 + 1 < above[i].x0) {
+            ++j;
+        } else {
+            unite(parent, aboveBase + i, belowBase + j);
+            if (above[i].x1 < below[j].x1) ++i; else ++j;
+        }
+    }
+}
+
+/**
+ * @brief Ajoute les segments d'une ligne de bits
+ */
+void appendRuns(const Word* row, std::int64_t wordsPerRow, std::int64_t width, std::int64_t y,
+                std::vector<Run>& runs) {
+    std::int64_t runStart = -1;
+    for (std::int64_t wx = 0; wx < wordsPerRow; ++wx) {
+        const Word word = row[wx];
+        const std::int64_t base = wx * 64;
+        int bit = 0;
+        while (bit < 64) {
+            if (runStart < 0) {
+                Word rest = word >> bit;
+                if (rest == 0) break;
+                bit += __builtin_ctzll(rest);
+                runStart = base + bit;
+            }
+            // Fin du segment : premier bit nul à partir de bit
+            Word holes = ~word >> bit;
+            if (holes == 0) break;  // Le segment continue dans le mot suivant
+            bit += __builtin_ctzll(holes);
+            runs.push_back({y, runStart, base + bit - 1});
+            runStart = -1;
+        }
+    }
+    if (runStart >= 0) {
+        runs.push_back({y, runStart, width - 1});
+    }
+}
+
+/**
+ * @brief Crée un motif vide de la taille donnée
+ */
+PatternBitmap emptyShape(std::int64_t width, std::int64_t height) {
+    PatternBitmap shape;
+    shape.width = width;
+    shape.height = height;
+    shape.wordsPerRow = (width + 63) / 64;
+    shape.words.assign(static_cast<size_t>(shape.wordsPerRow * height), 0);
+    return shape;
+}
+
+/**
+ * @brief Construit un motif à partir de lignes de texte ('O' = vivante)
+ */
+PatternBitmap shapeFromRows(const std::vector<std::string>& rows) {
+    std::int64_t width = 0;
+    for (const std::string& line : rows) {
+        width = std::max<std::int64_t>(width, static_cast<std::int64_t>(line.size()));
+    }
+    PatternBitmap shape = emptyShape(width, static_cast<std::int64_t>(rows.size()));
+    for (size_t y = 0; y < rows.size(); ++y) {
+        for (size_t x = 0; x < rows[y].size(); ++x) {
+            if (rows[y][x] == 'O') {
+                shape.words[y * shape.wordsPerRow + x / 64] |= Word(1) << (x % 64);
+            }
+        }
+    }
+    return shape;
+}
+
+/**
+ * @brief Compare deux formes (dimensions puis mots)
+ */
+bool sameShape(const PatternBitmap& a, const PatternBitmap& b) {
+    return a.width == b.width && a.height == b.height && a.words == b.words;
+}
+
+/**
+ * @brief Ordre total sur les formes, pour choisir un représentant canonique
+ */
+bool lessShape(const PatternBitmap& a, const PatternBitmap& b) {
+    if (a.height != b.height) return a.height < b.height;
+    if (a.width != b.width) return a.width < b.width;
+    return a.words < b.words;
+}
+
+/**
+ * @brief Clé d'une forme brute (dimensions et mots) pour le cache
+ */
+std::string shapeKey(const PatternBitmap& shape) {
+    std::string key(reinterpret_cast<const char*>(&shape.width), sizeof(shape.width));
+    key.append(reinterpret_cast<const char*>(&shape.height), sizeof(shape.height));
+    key.append(reinterpret_cast<const char*>(shape.words.data()), shape.words.size() * sizeof(Word));
+    return key;
+}
+
+/**
+ * @brief Empreinte 64 bits (FNV-1a) d'une forme
+ */
+std::uint64_t shapeHash(const PatternBitmap& shape) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](std::uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            hash ^= (value >> (8 * i)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    };
+    mix(static_cast<std::uint64_t>(shape.width));
+    mix(static_cast<std::uint64_t>(shape.height));
+    for (Word word : shape.words) {
+        mix(word);
+    }
+    return hash;
+}
+
+/**
+ * @brief Représentant canonique : plus petite forme parmi toutes les phases et orientations
+ */
+PatternBitmap canonicalShape(const std::vector<PatternBitmap>& phases) {
+    PatternBitmap best = phases.front();
+    for (const PatternBitmap& phase : phases) {
+        for (int t = 0; t < PATTERN_TRANSFORM_COUNT; ++t) {
+            PatternBitmap candidate = phase.transformed(static_cast<PatternTransform>(t));
+            if (lessShape(candidate, best)) {
+                best = candidate;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Cadre les cellules vivantes d'un plan sur leur boîte englobante
+ * @param plane Plan de bits
+ * @param wordsPerRow Mots par ligne
+ * @param height Nombre de lignes
+ * @param x Sortie : colonne du coin supérieur gauche
+ * @param y Sortie : ligne du coin supérieur gauche
+ * @param shape Sortie : forme cadrée
+ * @return false si le plan est vide
+ */
+bool cropPlane(const std::vector<Word>& plane, std::int64_t wordsPerRow, std::int64_t height,
+               std::int64_t& x, std::int64_t& y, PatternBitmap& shape) {
+    std::int64_t minX = -1, maxX = -1, minY = -1, maxY = -1;
+    for (std::int64_t r = 0; r < height; ++r) {
+        const Word* row = &plane[r * wordsPerRow];
+        for (std::int64_t wx = 0; wx < wordsPerRow; ++wx) {
+            if (row[wx] == 0) continue;
+            std::int64_t first = wx * 64 + __builtin_ctzll(row[wx]);
+            std::int64_t last = wx * 64 + 63 - __builtin_clzll(row[wx]);
+            if (minY < 0) minY = r;
+            maxY = r;
+            minX = (minX < 0) ? first : std::min(minX, first);
+            maxX = std::max(maxX, last);
+        }
+    }
+    if (minY < 0) return false;
+
+    x = minX;
+    y = minY;
+    shape = emptyShape(maxX - minX + 1, maxY - minY + 1);
+    const int tail = static_cast<int>(shape.width % 64);
+    for (std::int64_t r = 0; r < shape.height; ++r) {
+        const Word* source = &plane[(minY + r) * wordsPerRow];
+        for (std::int64_t i = 0; i < shape.wordsPerRow; ++i) {
+            std::int64_t bit = minX + i * 64;
+            std::int64_t wi = bit / 64;
+            int shift = static_cast<int>(bit % 64);
+            Word value = source[wi] >> shift;
+            if (shift != 0 && wi + 1 < wordsPerRow) {
+                value |= source[wi + 1] << (64 - shift);
+            }
+            if (i == shape.wordsPerRow - 1 && tail != 0) {
+                value &= (Word(1) << tail) - 1;
+            }
+            shape.words[r * shape.wordsPerRow + i] = value;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Écrit une empreinte en hexadécimal
+ */
+std::string toHex(std::uint64_t value) {
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+    return buffer;
+}
+
+// Masques de la règle de Conway (B3/S23) : les noms usuels ne valent que pour elle
+const std::uint16_t CONWAY_BIRTH = 1 << 3;
+const std::uint16_t CONWAY_SURVIVAL = (1 << 2) | (1 << 3);
+
+} // namespace
+
+ObjectCensus::ObjectCensus(int maxPeriod)
+    : maxPeriod(std::max(1, maxPeriod)), birthMask(CONWAY_BIRTH), survivalMask(CONWAY_SURVIVAL) {
+}
+
+void ObjectCensus::setRuleMasks(std::uint16_t birth, std::uint16_t survival) {
+    if (birth != birthMask || survival != survivalMask) {
+        birthMask = birth;
+        survivalMask = survival;
+        cache.clear();
+    }
+}
+
+std::vector<DetectedObject> ObjectCensus::findObjects(const BitGrid& grid, bool parallel) {
+    const std::int64_t width = grid.getWidth();
+    const std::int64_t height = grid.getHeight();
+    const std::int64_t wordsPerRow = grid.getWordsPerRow();
+
+    std::int64_t bandCount = 1;
+    if (parallel) {
+        unsigned int threads = std::thread::hardware_concurrency();
+        bandCount = std::max<std::int64_t>(1, std::min<std::int64_t>(threads == 0 ? 4 : threads, height));
+    }
+
+    // 1. Chaque bande extrait ses segments et les réunit entre ses propres lignes
+    struct Band {
+        std::vector<Run> runs;
+        std::vector<std::int64_t> parent;     // Union-find local à la bande
+        std::int64_t firstRowEnd = 0;         // Fin des segments de la première ligne
+        std::int64_t lastRowBegin = 0;        // Début des segments de la dernière ligne
+    };
+    std::vector<Band> bands(static_cast<size_t>(bandCount));
+
+    auto labelBands = [&](std::int64_t firstBand, std::int64_t endBand) {
+        for (std::int64_t b = firstBand; b < endBand; ++b) {
+            Band& band = bands[b];
+            const std::int64_t firstRow = b * height / bandCount;
+            const std::int64_t endRow = (b + 1) * height / bandCount;
+            std::int64_t previousBegin = 0;
+            for (std::int64_t y = firstRow; y < endRow; ++y) {
+                const std::int64_t begin = static_cast<std::int64_t>(band.runs.size());
+                appendRuns(grid.row(y), wordsPerRow, width, y, band.runs);
+                const std::int64_t end = static_cast<std::int64_t>(band.runs.size());
+                for (std::int64_t i = begin; i < end; ++i) {
+                    band.parent.push_back(i);
+                }
+                if (y == firstRow) {
+                    band.firstRowEnd = end;
+                } else {
+                    linkRows(band.runs.data() + previousBegin, begin - previousBegin, previousBegin,
+                             band.runs.data() + begin, end - begin, begin, band.parent);
+                }
+                band.lastRowBegin = begin;
+                previousBegin = begin;
+            }
+        }
+    };
+    if (bandCount > 1) {
+        Grid::runOnWorkers(bandCount, labelBands);
+    } else {
+        labelBands(0, bandCount);
+    }
+
+    // 2. Union-find global : les indices locaux sont décalés, puis les bandes sont recousues
+    std::vector<std::int64_t> offsets(static_cast<size_t>(bandCount) + 1, 0);
+    for (std::int64_t b = 0; b < bandCount; ++b) {
+        offsets[b + 1] = offsets[b] + static_cast<std::int64_t>(bands[b].runs.size());
+    }
+    const std::int64_t runCount = offsets[bandCount];
+    std::vector<Run> runs;
+    std::vector<std::int64_t> parent;
+    runs.reserve(static_cast<size_t>(runCount));
+    parent.reserve(static_cast<size_t>(runCount));
+    for (std::int64_t b = 0; b < bandCount; ++b) {
+        runs.insert(runs.end(), bands[b].runs.begin(), bands[b].runs.end());
+        for (std::int64_t p : bands[b].parent) {
+            parent.push_back(offsets[b] + p);
+        }
+    }
+    for (std::int64_t b = 0; b + 1 < bandCount; ++b) {
+        // Dernière ligne de la bande b contre première ligne de la bande b + 1
+        const Band& upper = bands[b];
+        const Band& lower = bands[b + 1];
+        linkRows(runs.data() + offsets[b] + upper.lastRowBegin,
+                 static_cast<std::int64_t>(upper.runs.size()) - upper.lastRowBegin,
+                 offsets[b] + upper.lastRowBegin,
+                 runs.data() + offsets[b + 1], lower.firstRowEnd, offsets[b + 1], parent);
+    }
+    bands.clear();
+
+    // 3. Numérotation des composantes : la racine est le premier segment de chaque objet
+    std::vector<std::int64_t> component(static_cast<size_t>(runCount));
+    std::int64_t componentCount = 0;
+    for (std::int64_t i = 0; i < runCount; ++i) {
+        std::int64_t root = findRoot(parent, i);
+        component[i] = (root == i) ? componentCount++ : component[root];
+    }
+
+    // Tri par composante (tri par dénombrement, stable : segments dans l'ordre des lignes)
+    std::vector<std::int64_t> start(static_cast<size_t>(componentCount) + 1, 0);
+    for (std::int64_t i = 0; i < runCount; ++i) {
+        ++start[component[i] + 1];
+    }
+    for (std::int64_t c = 0; c < componentCount; ++c) {
+        start[c + 1] += start[c];
+    }
+    std::vector<std::int64_t> order(static_cast<size_t>(runCount));
+    {
+        std::vector<std::int64_t> next(start.begin(), start.end() - 1);
+        for (std::int64_t i = 0; i < runCount; ++i) {
+            order[next[component[i]]++] = i;
+        }
+    }
+
+    // 4. Chaque objet est cadré sur la boîte englobante de ses segments
+    std::vector<DetectedObject> objects(static_cast<size_t>(componentCount));
+    auto buildObjects = [&](std::int64_t first, std::int64_t end) {
+        for (std::int64_t c = first; c < end; ++c) {
+            std::int64_t minX = width;
+            std::int64_t maxX = -1;
+            for (std::int64_t k = start[c]; k < start[c + 1]; ++k) {
+                minX = std::min(minX, runs[order[k]].x0);
+                maxX = std::max(maxX, runs[order[k]].x1);
+            }
+            const std::int64_t minY = runs[order[start[c]]].y;
+            const std::int64_t maxY = runs[order[start[c + 1] - 1]].y;
+
+            DetectedObject& object = objects[c];
+            object.x = minX;
+            object.y = minY;
+            object.shape = emptyShape(maxX - minX + 1, maxY - minY + 1);
+            for (std::int64_t k = start[c]; k < start[c + 1]; ++k) {
+                const Run& run = runs[order[k]];
+                Word* row = &object.shape.words[(run.y - minY) * object.shape.wordsPerRow];
+                for (std::int64_t x = run.x0 - minX; x <= run.x1 - minX; ++x) {
+                    row[x / 64] |= Word(1) << (x % 64);
+                }
+            }
+        }
+    };
+    if (parallel && componentCount > 1) {
+        Grid::runOnWorkers(componentCount, buildObjects);
+    } else {
+        buildObjects(0, componentCount);
+    }
+    return objects;
+}
+
+void ObjectCensus::mergeFragments(std::vector<DetectedObject>& objects,
+                                  std::vector<const ObjectClass*>& classes, bool parallel) {
+    std::vector<size_t> fragments;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        if (classes[i]->kind == ObjectKind::OTHER) {
+            fragments.push_back(i);
+        }
+    }
+    if (fragments.size() < 2) return;
+
+    // Les objets sont triés par ligne de départ : on s'arrête dès qu'un fragment est trop bas
+    const std::int64_t count = static_cast<std::int64_t>(fragments.size());
+    std::vector<std::int64_t> parent(static_cast<size_t>(count));
+    for (std::int64_t a = 0; a < count; ++a) {
+        parent[a] = a;
+    }
+    for (std::int64_t a = 0; a < count; ++a) {
+        const DetectedObject& first = objects[fragments[a]];
+        const std::int64_t bottom = first.y + first.shape.height - 1;
+        const std::int64_t right = first.x + first.shape.width - 1;
+        for (std::int64_t b = a + 1; b < count; ++b) {
+            const DetectedObject& second = objects[fragments[b]];
+            if (second.y > bottom + FRAGMENT_GAP) break;
+            if (second.x > right + FRAGMENT_GAP ||
+                first.x > second.x + second.shape.width - 1 + FRAGMENT_GAP) continue;
+            unite(parent, a, b);
+        }
+    }
+
+    // Réunion des fragments de chaque groupe dans le premier d'entre eux
+    std::vector<std::vector<size_t>> groups(static_cast<size_t>(count));
+    for (std::int64_t a = 0; a < count; ++a) {
+        groups[findRoot(parent, a)].push_back(fragments[a]);
+    }
+    std::vector<DetectedObject> merged;
+    std::vector<size_t> targets;
+    std::vector<char> removed(objects.size(), 0);
+    for (const std::vector<size_t>& group : groups) {
+        if (group.size() < 2) continue;
+
+        std::int64_t minX = objects[group[0]].x, minY = objects[group[0]].y;
+        std::int64_t maxX = minX, maxY = minY;
+        for (size_t index : group) {
+            const DetectedObject& part = objects[index];
+            minX = std::min(minX, part.x);
+            minY = std::min(minY, part.y);
+            maxX = std::max(maxX, part.x + part.shape.width - 1);
+            maxY = std::max(maxY, part.y + part.shape.height - 1);
+        }
+        DetectedObject object;
+        object.x = minX;
+        object.y = minY;
+        object.shape = emptyShape(maxX - minX + 1, maxY - minY + 1);
+        for (size_t index : group) {
+            const DetectedObject& part = objects[index];
+            for (std::int64_t y = 0; y < part.shape.height; ++y) {
+                const Word* row = part.shape.row(y);
+                Word* target = &object.shape.words[(part.y - minY + y) * object.shape.wordsPerRow];
+                for (std::int64_t wx = 0; wx < part.shape.wordsPerRow; ++wx) {
+                    Word word = row[wx];
+                    while (word != 0) {
+                        std::int64_t x = part.x - minX + wx * 64 + __builtin_ctzll(word);
+                        word &= word - 1;
+                        target[x / 64] |= Word(1) << (x % 64);
+                    }
+                }
+            }
+            removed[index] = 1;
+        }
+        removed[group[0]] = 0;
+        merged.push_back(std::move(object));
+        targets.push_back(group[0]);
+    }
+    if (merged.empty()) return;
+
+    std::vector<const ObjectClass*> mergedClasses = classifyAll(merged, parallel);
+    for (size_t k = 0; k < merged.size(); ++k) {
+        objects[targets[k]] = std::move(merged[k]);
+        classes[targets[k]] = mergedClasses[k];
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        if (!removed[i]) {
+            if (kept != i) {
+                objects[kept] = std::move(objects[i]);
+                classes[kept] = classes[i];
+            }
+            ++kept;
+        }
+    }
+    objects.resize(kept);
+    classes.resize(kept);
+}
+
+ObjectClass ObjectCensus::simulate(const PatternBitmap& shape) const {
+    ObjectClass result;
+    PatternBitmap initial = shape;
+    initial.name.clear();
+    result.population = initial.countLivingCells();
+
+    std::vector<PatternBitmap> phases(1, initial);
+    PatternBitmap phase = initial;
+    std::int64_t offsetX = 0;  // Position de la phase courante par rapport à la forme initiale
+    std::int64_t offsetY = 0;
+    std::vector<Word> current;
+    std::vector<Word> next;
+    for (int generation = 1; generation <= maxPeriod && result.population > 0; ++generation) {
+        if (phase.width > MAX_OBJECT_SIZE || phase.height > MAX_OBJECT_SIZE) {
+            break;  // L'objet grandit : on abandonne
+        }
+
+        // Plan juste assez grand : la forme entourée d'une case vide de chaque côté
+        const std::int64_t width = phase.width + 2;
+        const std::int64_t height = phase.height + 2;
+        const std::int64_t wordsPerRow = (width + 63) / 64;
+        current.assign(static_cast<size_t>(wordsPerRow * height), 0);
+        next.assign(current.size(), 0);
+        for (std::int64_t y = 0; y < phase.height; ++y) {
+            const Word* source = phase.row(y);
+            Word* target = &current[(y + 1) * wordsPerRow];
+            for (std::int64_t i = 0; i < phase.wordsPerRow; ++i) {
+                target[i] |= source[i] << 1;
+                if (i + 1 < wordsPerRow) {
+                    target[i + 1] |= source[i] >> 63;
+                }
+            }
+        }
+
+        for (std::int64_t y = 0; y < height; ++y) {
+            BitGrid::stepRow(y > 0 ? &current[(y - 1) * wordsPerRow] : nullptr,
+                             &current[y * wordsPerRow],
+                             y + 1 < height ? &current[(y + 1) * wordsPerRow] : nullptr,
+                             nullptr, &next[y * wordsPerRow], wordsPerRow, width, false,
+                             birthMask, survivalMask);
+        }
+
+        std::int64_t x = 0;
+        std::int64_t y = 0;
+        if (!cropPlane(next, wordsPerRow, height, x, y, phase)) {
+            break;  // L'objet meurt
+        }
+        offsetX += x - 1;
+        offsetY += y - 1;
+
+        if (sameShape(phase, initial)) {
+            result.period = generation;
+            result.dx = offsetX;
+            result.dy = offsetY;
+            if (offsetX != 0 || offsetY != 0) {
+                result.kind = ObjectKind::SPACESHIP;
+            } else if (generation == 1) {
+                result.kind = ObjectKind::STILL_LIFE;
+            } else {
+                result.kind = ObjectKind::OSCILLATOR;
+            }
+            break;
+        }
+        result.population = std::min(result.population, phase.countLivingCells());
+        phases.push_back(phase);
+    }
+
+    // Le code ne dépend ni de la phase observée ni de l'orientation
+    std::string hash;
+    if (result.kind == ObjectKind::OTHER) {
+        result.population = initial.countLivingCells();
+        hash = toHex(shapeHash(canonicalShape(std::vector<PatternBitmap>(1, initial))));
+    } else {
+        hash = toHex(shapeHash(canonicalShape(phases)));
+    }
+    switch (result.kind) {
+        case ObjectKind::STILL_LIFE: result.code = "xs" + std::to_string(result.population) + "_" + hash; break;
+        case ObjectKind::OSCILLATOR: result.code = "xp" + std::to_string(result.period) + "_" + hash; break;
+        case ObjectKind::SPACESHIP:  result.code = "xq" + std::to_string(result.period) + "_" + hash; break;
+        case ObjectKind::OTHER:      result.code = "zz_" + hash; break;
+    }
+    return result;
+}
+
+const std::unordered_map<std::string, std::string>& ObjectCensus::knownNames() {
+    static const std::unordered_map<std::string, std::string> names = [] {
+        const std::vector<std::pair<std::string, std::vector<std::string>>> objects = {
+            {"block",            {"OO", "OO"}},
+            {"beehive",          {".OO.", "O..O", ".OO."}},
+            {"loaf",             {".OO.", "O..O", ".O.O", "..O."}},
+            {"boat",             {"OO.", "O.O", ".O."}},
+            {"ship",             {"OO.", "O.O", ".OO"}},
+            {"tub",              {".O.", "O.O", ".O."}},
+            {"pond",             {".OO.", "O..O", "O..O", ".OO."}},
+            {"long_boat",        {"OO..", "O.O.", ".O.O", "..O."}},
+            {"barge",            {".O..", "O.O.", ".O.O", "..O."}},
+            {"mango",            {".OO..", "O..O.", ".O..O", "..OO."}},
+            {"aircraft_carrier", {"OO..", "O..O", "..OO"}},
+            {"snake",            {"OO.O", "O.OO"}},
+            {"blinker",          {"OOO"}},
+            {"toad",             {".OOO", "OOO."}},
+            {"beacon",           {"OO..", "OO..", "..OO", "..OO"}},
+            {"clock",            {"..O.", "O.O.", ".O.O", ".O.."}},
+            {"pentadecathlon",   {"..O....O..", "OO.OOOO.OO", "..O....O.."}},
+            {"glider",           {".O.", "..O", "OOO"}},
+            {"lwss",             {"O..O.", "....O", "O...O", ".OOOO"}},
+            {"mwss",             {"..O...", "O...O.", ".....O", "O....O", ".OOOOO"}},
+            {"hwss",             {"..OO...", "O....O.", "......O", "O.....O", ".OOOOOO"}},
+        };
+        ObjectCensus reference;
+        std::unordered_map<std::string, std::string> table;
+        for (const auto& object : objects) {
+            table[reference.simulate(shapeFromRows(object.second)).code] = object.first;
+        }
+        return table;
+    }();
+    return names;
+}
+
+const ObjectClass& ObjectCensus::classify(const PatternBitmap& shape) {
+    DetectedObject object;
+    object.shape = shape;
+    return *classifyAll(std::vector<DetectedObject>(1, object), false).front();
+}
+
+std::vector<const ObjectClass*> ObjectCensus::classifyAll(const std::vector<DetectedObject>& objects, bool parallel) {
+    std::vector<std::string> keys;
+    keys.reserve(objects.size());
+    std::vector<size_t> pending;
+    std::unordered_map<std::string, size_t> pendingKeys;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        keys.push_back(shapeKey(objects[i].shape));
+        if (cache.count(keys.back()) == 0 && pendingKeys.emplace(keys.back(), i).second) {
+            pending.push_back(i);
+        }
+    }
+
+    // Seules les formes jamais vues sont simulées
+    std::vector<ObjectClass> results(pending.size());
+    auto simulatePending = [&](std::int64_t first, std::int64_t end) {
+        for (std::int64_t k = first; k < end; ++k) {
+            results[k] = simulate(objects[pending[k]].shape);
+        }
+    };
+    const std::int64_t pendingCount = static_cast<std::int64_t>(pending.size());
+    if (parallel && pendingCount > 1) {
+        Grid::runOnWorkers(pendingCount, simulatePending);
+    } else {
+        simulatePending(0, pendingCount);
+    }
+
+    const bool conway = birthMask == CONWAY_BIRTH && survivalMask == CONWAY_SURVIVAL;
+    for (size_t k = 0; k < pending.size(); ++k) {
+        if (conway) {
+            auto known = knownNames().find(results[k].code);
+            if (known != knownNames().end()) {
+                results[k].name = known->second;
+            }
+        }
+        cache.emplace(keys[pending[k]], std::move(results[k]));
+    }
+
+    // Les éléments d'une unordered_map ne bougent pas : les pointeurs restent valides
+    std::vector<const ObjectClass*> classes;
+    classes.reserve(objects.size());
+    for (const std::string& key : keys) {
+        classes.push_back(&cache.at(key));
+    }
+    return classes;
+}
+
+std::vector<DetectedObject> ObjectCensus::identify(const BitGrid& grid, std::vector<const ObjectClass*>& classes,
+                                                   bool parallel) {
+    setRuleMasks(grid.getBirthMask(), grid.getSurvivalMask());
+
+    std::vector<DetectedObject> objects = findObjects(grid, parallel);
+    classes = classifyAll(objects, parallel);
+    mergeFragments(objects, classes, parallel);
+    return objects;
+}
+
+std::vector<CensusEntry> ObjectCensus::tally(const std::vector<const ObjectClass*>& classes) {
+    std::map<std::string, CensusEntry> byCode;
+    for (const ObjectClass* type : classes) {
+        CensusEntry& entry = byCode[type->code];
+        if (entry.count == 0) {
+            entry.type = *type;
+        }
+        entry.count++;
+    }
+
+    std::vector<CensusEntry> census;
+    census.reserve(byCode.size());
+    for (auto& item : byCode) {
+        census.push_back(std::move(item.second));
+    }
+    std::stable_sort(census.begin(), census.end(), [](const CensusEntry& a, const CensusEntry& b) {
+        return a.count > b.count;
+    });
+    return census;
+}
+
+std::vector<CensusEntry> ObjectCensus::take(const BitGrid& grid, bool parallel) {
+    std::vector<const ObjectClass*> classes;
+    identify(grid, classes, parallel);
+    return tally(classes);
+}
+
+std::vector<CensusEntry> ObjectCensus::take(const Grid& grid, bool parallel) {
+    BitGrid packed(grid.getWidth(), grid.getHeight());
+    packed.fromGrid(grid);
+    return take(packed, parallel);
+}
+
+std::string ObjectCensus::kindName(ObjectKind kind) {
+    switch (kind) {
+        case ObjectKind::STILL_LIFE: return "stable";
+        case ObjectKind::OSCILLATOR: return "oscillateur";
+        case ObjectKind::SPACESHIP:  return "vaisseau";
+        case ObjectKind::OTHER:      return "autre";
+    }
+    return "autre";
+}
+
+void ObjectCensus::print(std::ostream& out, const std::vector<CensusEntry>& census) {
+    out << std::left << std::setw(24) << "Code" << std::setw(18) << "Nom"
+        << std::setw(13) << "Nature" << std::right << std::setw(10) << "Nombre" << "\n";
+    for (const CensusEntry& entry : census) {
+        out << std::left << std::setw(24) << entry.type.code
+            << std::setw(18) << (entry.type.name.empty() ? "-" : entry.type.name)
+            << std::setw(13) << kindName(entry.type.kind)
+            << std::right << std::setw(10) << entry.count << "\n";
+    }
+}
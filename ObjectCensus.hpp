@@ -0,0 +1,200 @@
+#ifndef OBJECTCENSUS_HPP
+#define OBJECTCENSUS_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "PatternRegistry.hpp"
+
+// Déclarations anticipées
+class BitGrid;
+class Grid;
+
+/**
+ * @brief Nature d'un objet isolé
+ */
+enum class ObjectKind {
+    STILL_LIFE,   // Stable (période 1, immobile)
+    OSCILLATOR,   // Revient à sa forme sur place après une période
+    SPACESHIP,    // Revient à sa forme décalée après une période
+    OTHER         // Meurt, grandit ou période trop longue
+};
+
+/**
+ * @brief Classification d'une forme simulée seule
+ */
+struct ObjectClass {
+    ObjectKind kind = ObjectKind::OTHER;
+    int period = 0;               // Période (0 si inconnue)
+    std::int64_t dx = 0;          // Déplacement par période (vaisseaux)
+    std::int64_t dy = 0;
+    std::int64_t population = 0;  // Population de la phase la plus petite
+    std::string code;             // Code canonique : xs<pop>_..., xp<p>_..., xq<p>_..., zz_...
+    std::string name;             // Nom usuel ("block", "glider"...) ou vide
+};
+
+/**
+ * @brief Objet trouvé sur la grille : composante 8-connexe de cellules vivantes
+ */
+struct DetectedObject {
+    std::int64_t x = 0;  // Coin supérieur gauche de la boîte englobante
+    std::int64_t y = 0;
+    PatternBitmap shape; // Cellules de l'objet, cadrées sur la boîte
+};
+
+/**
+ * @brief Ligne du recensement : un type d'objet et son nombre d'exemplaires
+ */
+struct CensusEntry {
+    ObjectClass type;
+    std::int64_t count = 0;
+};
+
+/**
+ * @class ObjectCensus
+ * @brief Découpe une grille en objets et les recense par type
+ *
+ * L'étiquetage travaille sur les segments de cellules vivantes de chaque
+ * ligne (union-find) : chaque bande de lignes est étiquetée par son propre
+ * thread, puis les bandes sont recousues le long de leurs bords. Chaque forme
+ * distincte est ensuite simulée seule pour savoir si c'est un objet stable,
+ * un oscillateur ou un vaisseau ; le résultat est gardé en cache.
+ *
+ * Les morceaux voisins qui ne forment pas un objet seuls (phases en deux
+ * parties) sont réunis avant le recensement.
+ *
+ * Les bords d'une grille torique ne sont pas recousus : un objet à cheval sur
+ * un bord est compté en deux morceaux.
+ */
+class ObjectCensus {
+public:
+    /**
+     * @brief Période maximale recherchée par défaut
+     */
+    static const int DEFAULT_MAX_PERIOD = 64;
+
+    /**
+     * @brief Plus grande boîte englobante simulée (au-delà : OTHER)
+     */
+    static const std::int64_t MAX_OBJECT_SIZE = 256;
+
+    /**
+     * @brief Écart maximal (en cellules) entre deux fragments réunis
+     *
+     * Certaines phases d'objets sont en plusieurs morceaux (beacon, lwss) :
+     * les fragments non classés aussi proches sont réunis puis reclassés.
+     */
+    static const std::int64_t FRAGMENT_GAP = 2;
+
+    /**
+     * @brief Constructeur
+     * @param maxPeriod Période maximale recherchée lors de la classification
+     */
+    explicit ObjectCensus(int maxPeriod = DEFAULT_MAX_PERIOD);
+
+    /**
+     * @brief Définit la règle utilisée pour simuler les objets (B3/S23 par défaut)
+     * @param birthMask Masque de naissance
+     * @param survivalMask Masque de survie
+     */
+    void setRuleMasks(std::uint16_t birthMask, std::uint16_t survivalMask);
+
+    /**
+     * @brief Découpe la grille en composantes 8-connexes
+     * @param grid Grille compacte
+     * @param parallel true pour répartir les bandes de lignes entre les threads
+     * @return Objets, dans l'ordre de leur première cellule (ligne puis colonne)
+     */
+    static std::vector<DetectedObject> findObjects(const BitGrid& grid, bool parallel = true);
+
+    /**
+     * @brief Classe une forme en la simulant seule (résultat mis en cache)
+     * @param shape Forme cadrée sur sa boîte englobante
+     * @return Classification
+     */
+    const ObjectClass& classify(const PatternBitmap& shape);
+
+    /**
+     * @brief Classe une liste de formes (formes inconnues simulées en parallèle)
+     * @param objects Objets à classer
+     * @param parallel true pour répartir les simulations entre les threads
+     * @return Classification de chaque objet (même ordre)
+     */
+    std::vector<const ObjectClass*> classifyAll(const std::vector<DetectedObject>& objects, bool parallel = true);
+
+    /**
+     * @brief Découpe une grille en objets et les classe (fragments voisins réunis)
+     * @param grid Grille compacte (sa règle est utilisée)
+     * @param classes Sortie : classification de chaque objet
+     * @param parallel true pour travailler en parallèle
+     * @return Objets, dans l'ordre de leur première cellule
+     */
+    std::vector<DetectedObject> identify(const BitGrid& grid, std::vector<const ObjectClass*>& classes,
+                                         bool parallel = true);
+
+    /**
+     * @brief Regroupe des classifications par type
+     * @param classes Classification de chaque objet
+     * @return Types d'objets, du plus fréquent au plus rare
+     */
+    static std::vector<CensusEntry> tally(const std::vector<const ObjectClass*>& classes);
+
+    /**
+     * @brief Recense les objets d'une grille compacte (la règle de la grille est utilisée)
+     * @param grid Grille compacte
+     * @param parallel true pour travailler en parallèle
+     * @return Types d'objets, du plus fréquent au plus rare
+     */
+    std::vector<CensusEntry> take(const BitGrid& grid, bool parallel = true);
+
+    /**
+     * @brief Recense les objets d'une grille
+     * @param grid Grille
+     * @param parallel true pour travailler en parallèle
+     * @return Types d'objets, du plus fréquent au plus rare
+     */
+    std::vector<CensusEntry> take(const Grid& grid, bool parallel = true);
+
+    /**
+     * @brief Affiche un recensement sous forme de tableau
+     * @param out Flux de sortie
+     * @param census Recensement
+     */
+    static void print(std::ostream& out, const std::vector<CensusEntry>& census);
+
+    /**
+     * @brief Obtient le libellé d'une nature d'objet
+     * @param kind Nature
+     * @return Libellé en français
+     */
+    static std::string kindName(ObjectKind kind);
+
+private:
+    int maxPeriod;
+    std::uint16_t birthMask;
+    std::uint16_t survivalMask;
+    std::unordered_map<std::string, ObjectClass> cache;  // Forme brute -> classification
+
+    /**
+     * @brief Simule une forme seule et la classe (sans cache)
+     */
+    ObjectClass simulate(const PatternBitmap& shape) const;
+
+    /**
+     * @brief Réunit les fragments non classés voisins et les reclasse
+     * @param objects Objets (modifiés)
+     * @param classes Classification de chaque objet (modifiée)
+     * @param parallel true pour simuler en parallèle
+     */
+    void mergeFragments(std::vector<DetectedObject>& objects, std::vector<const ObjectClass*>& classes,
+                        bool parallel);
+
+    /**
+     * @brief Table des codes des objets usuels (B3/S23) vers leur nom
+     */
+    static const std::unordered_map<std::string, std::string>& knownNames();
+};
+
+#endif // OBJECTCENSUS_HPP
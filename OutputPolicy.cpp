@@ -0,0 +1,83 @@
+#include "OutputPolicy.hpp"
+#include <algorithm>
+
+OutputPolicy::OutputPolicy() : mode(Mode::ALL), interval(1) {
+}
+
+OutputPolicy::OutputPolicy(Mode mode, std::int64_t interval)
+    : mode(mode), interval(std::max<std::int64_t>(1, interval)) {
+}
+
+OutputPolicy OutputPolicy::all() {
+    return OutputPolicy(Mode::ALL, 1);
+}
+
+OutputPolicy OutputPolicy::every(std::int64_t interval) {
+    return OutputPolicy(Mode::EVERY, interval);
+}
+
+OutputPolicy OutputPolicy::logSpaced() {
+    return OutputPolicy(Mode::LOG_SPACED, 1);
+}
+
+OutputPolicy OutputPolicy::finalOnly() {
+    return OutputPolicy(Mode::FINAL_ONLY, 1);
+}
+
+OutputPolicy OutputPolicy::onChange() {
+    return OutputPolicy(Mode::ON_CHANGE, 1);
+}
+
+OutputPolicy::Mode OutputPolicy::getMode() const {
+    return mode;
+}
+
+std::int64_t OutputPolicy::getInterval() const {
+    return interval;
+}
+
+bool OutputPolicy::writesInitial() const {
+    return mode != Mode::FINAL_ONLY;
+}
+
+bool OutputPolicy::requiresChange() const {
+    return mode == Mode::ON_CHANGE;
+}
+
+std::int64_t OutputPolicy::next(std::int64_t generation, std::int64_t last) const {
+    std::int64_t candidate = last;
+    switch (mode) {
+        case Mode::ALL:
+        case Mode::ON_CHANGE:
+            candidate = generation + 1;
+            break;
+        case Mode::EVERY:
+            if (generation <= last - interval) {
+                candidate = (generation / interval + 1) * interval;
+            }
+            break;
+        case Mode::LOG_SPACED: {
+            // Pas = plus grande puissance de 10 <= génération suivante : 1..9, 10..90, 100..900...
+            std::int64_t step = 1;
+            while (step <= (generation + 1) / 10) step *= 10;
+            if (generation <= last - step) {
+                candidate = (generation / step + 1) * step;
+            }
+            break;
+        }
+        case Mode::FINAL_ONLY:
+            break;
+    }
+    return std::min(candidate, last);
+}
+
+std::string OutputPolicy::describe() const {
+    switch (mode) {
+        case Mode::EVERY:      return "une génération sur " + std::to_string(interval);
+        case Mode::LOG_SPACED: return "espacement logarithmique";
+        case Mode::FINAL_ONLY: return "génération finale seulement";
+        case Mode::ON_CHANGE:  return "générations modifiées";
+        case Mode::ALL:        break;
+    }
+    return "toutes les générations";
+}
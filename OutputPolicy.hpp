@@ -0,0 +1,76 @@
+#ifndef OUTPUTPOLICY_HPP
+#define OUTPUTPOLICY_HPP
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @class OutputPolicy
+ * @brief Choix des générations écrites par le mode console
+ *
+ * Le mode console demande à la politique la prochaine génération à
+ * écrire et calcule d'une traite jusqu'à elle : les générations
+ * intermédiaires ne coûtent que le calcul. La génération finale est
+ * toujours écrite ; la génération 0 l'est sauf en FINAL_ONLY.
+ */
+class OutputPolicy {
+public:
+    /**
+     * @brief Politiques disponibles
+     */
+    enum class Mode {
+        ALL,          // Toutes les générations (défaut)
+        EVERY,        // Une génération sur N (--every N)
+        LOG_SPACED,   // 0..9, 10, 20..90, 100, 200... (--log-spaced)
+        FINAL_ONLY,   // La dernière seulement (--final-only)
+        ON_CHANGE     // Celles qui diffèrent de la précédente (--on-change)
+    };
+
+    /**
+     * @brief Constructeur : toutes les générations
+     */
+    OutputPolicy();
+
+    static OutputPolicy all();
+    static OutputPolicy every(std::int64_t interval);
+    static OutputPolicy logSpaced();
+    static OutputPolicy finalOnly();
+    static OutputPolicy onChange();
+
+    Mode getMode() const;
+    std::int64_t getInterval() const;
+
+    /**
+     * @brief Vérifie si la génération 0 est écrite
+     * @return false en FINAL_ONLY
+     */
+    bool writesInitial() const;
+
+    /**
+     * @brief Vérifie si l'écriture dépend des changements de la grille
+     * @return true en ON_CHANGE : chaque génération est candidate
+     */
+    bool requiresChange() const;
+
+    /**
+     * @brief Obtient la prochaine génération candidate à l'écriture
+     * @param generation Génération courante
+     * @param last Dernière génération calculée
+     * @return Génération suivante à écrire (au plus last)
+     */
+    std::int64_t next(std::int64_t generation, std::int64_t last) const;
+
+    /**
+     * @brief Décrit la politique pour l'affichage
+     * @return Texte court ("toutes", "une sur 100"...)
+     */
+    std::string describe() const;
+
+private:
+    Mode mode;
+    std::int64_t interval;  // EVERY : écart entre deux générations écrites
+
+    OutputPolicy(Mode mode, std::int64_t interval);
+};
+
+#endif // OUTPUTPOLICY_HPP
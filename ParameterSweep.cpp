@@ -0,0 +1,234 @@
+#include "ParameterSweep.hpp"
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include "Rule.hpp"
+#include "StabilizationDetector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Découpe un texte selon un séparateur
+ */
+std::vector<std::string> split(const std::string& text, char separator) {
+    std::vector<std::string> parts;
+    std::istringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, separator)) {
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+/**
+ * @brief Décode <largeur>x<hauteur>
+ */
+bool parseSize(const std::string& text, std::int64_t& width, std::int64_t& height) {
+    size_t sep = text.find('x');
+    try {
+        if (sep == std::string::npos) throw std::invalid_argument(text);
+        width = std::stoll(text.substr(0, sep));
+        height = std::stoll(text.substr(sep + 1));
+    } catch (const std::exception&) {
+        return false;
+    }
+    return width > 0 && height > 0;
+}
+
+} // namespace
+
+ParameterSweep::ParameterSweep(std::int64_t maxGenerations)
+    : maxGenerations(std::max<std::int64_t>(1, maxGenerations)) {
+}
+
+bool ParameterSweep::parseDensities(const std::string& text, std::vector<double>& densities) {
+    densities.clear();
+    try {
+        std::vector<std::string> range = split(text, ':');
+        if (range.size() == 3) {
+            const double first = std::stod(range[0]);
+            const double last = std::stod(range[1]);
+            const double step = std::stod(range[2]);
+            if (step <= 0.0) throw std::invalid_argument(text);
+            // Demi-pas de tolérance pour inclure la borne malgré les arrondis
+            for (std::int64_t k = 0; first + k * step <= last + step / 2; ++k) {
+                densities.push_back(first + k * step);
+            }
+        } else {
+            for (const std::string& value : split(text, ',')) {
+                densities.push_back(std::stod(value));
+            }
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Erreur : Densités attendues au format début:fin:pas ou d1,d2,..., reçu : " << text << std::endl;
+        return false;
+    }
+    for (double density : densities) {
+        if (density < 0.0 || density > 1.0) {
+            std::cerr << "Erreur : Densité hors de [0, 1] : " << density << std::endl;
+            return false;
+        }
+    }
+    return !densities.empty();
+}
+
+bool ParameterSweep::parseRules(const std::string& text, std::vector<std::string>& rules) {
+    rules.clear();
+    if (text == "all") {
+        rules = RuleFactory::getRuleNames();
+        return true;
+    }
+    for (const std::string& name : split(text, ',')) {
+        if (!createRule(name)) {
+            std::cerr << "Erreur : Règle inconnue : " << name << " (";
+            for (const std::string& known : RuleFactory::getRuleNames()) {
+                std::cerr << known << ", ";
+            }
+            std::cerr << "notation B/S ou all)" << std::endl;
+            return false;
+        }
+        rules.push_back(name);
+    }
+    return !rules.empty();
+}
+
+std::unique_ptr<Rule> ParameterSweep::createRule(const std::string& rule) {
+    // createByName retombe sur la règle classique : on ne l'appelle que pour un nom connu
+    const std::vector<std::string> names = RuleFactory::getRuleNames();
+    if (std::find(names.begin(), names.end(), rule) != names.end()) {
+        return RuleFactory::createByName(rule);
+    }
+    return RuleFactory::createFromString(rule);
+}
+
+bool ParameterSweep::parseSizes(const std::string& text, std::vector<std::pair<std::int64_t, std::int64_t>>& sizes) {
+    sizes.clear();
+    std::vector<std::string> range = split(text, ':');
+    std::int64_t width = 0;
+    std::int64_t height = 0;
+    if (range.size() == 2) {
+        std::int64_t lastWidth = 0;
+        std::int64_t lastHeight = 0;
+        if (parseSize(range[0], width, height) && parseSize(range[1], lastWidth, lastHeight)) {
+            for (; width <= lastWidth && height <= lastHeight; width *= 2, height *= 2) {
+                sizes.emplace_back(width, height);
+            }
+        }
+    } else {
+        for (const std::string& value : split(text, ',')) {
+            if (!parseSize(value, width, height)) {
+                sizes.clear();
+                break;
+            }
+            sizes.emplace_back(width, height);
+        }
+    }
+    if (sizes.empty()) {
+        std::cerr << "Erreur : Tailles attendues au format LxH,LxH ou LxH:LxH, reçu : " << text << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::vector<SweepJob> ParameterSweep::plan(const std::vector<double>& densities, const std::vector<std::string>& rules,
+                                           const std::vector<std::pair<std::int64_t, std::int64_t>>& sizes,
+                                           std::int64_t repetitions, std::uint64_t baseSeed) const {
+    std::vector<SweepJob> jobs;
+    for (const auto& size : sizes) {
+        for (const std::string& rule : rules) {
+            for (double density : densities) {
+                for (std::int64_t r = 0; r < repetitions; ++r) {
+                    SweepJob job;
+                    job.index = static_cast<std::int64_t>(jobs.size());
+                    job.rule = rule;
+                    job.density = density;
+                    job.width = size.first;
+                    job.height = size.second;
+                    job.repetition = r;
+                    job.seed = baseSeed + static_cast<std::uint64_t>(job.index);
+                    // Borne haute : mots par génération multipliés par la limite de générations
+                    job.estimatedCost = static_cast<double>((size.first + 63) / 64) * size.second * maxGenerations;
+                    jobs.push_back(job);
+                }
+            }
+        }
+    }
+
+    // Les plus gros calculs d'abord : les petits comblent la fin
+    std::stable_sort(jobs.begin(), jobs.end(), [](const SweepJob& a, const SweepJob& b) {
+        return a.estimatedCost > b.estimatedCost;
+    });
+    return jobs;
+}
+
+SweepResult ParameterSweep::runJob(const SweepJob& job) const {
+    auto start = std::chrono::steady_clock::now();
+    SweepResult result;
+    result.job = job;
+
+    BitGrid grid(job.width, job.height);
+    grid.setParallelMode(false);
+    grid.setRule(*createRule(job.rule));
+    grid.randomize(job.density, job.seed);
+
+    StabilizationDetector detector(StabilizationDetector::DEFAULT_MAX_PERIOD, CONFIRMATION_WINDOW);
+    detector.observe(grid.hash(), 0);
+    std::int64_t generation = 0;
+    while (generation < maxGenerations && !detector.isSettled()) {
+        grid.step();
+        ++generation;
+        detector.observe(grid.hash(), generation);
+    }
+
+    result.settled = detector.isSettled();
+    result.settleGeneration = detector.getSettledGeneration();
+    result.period = result.settled ? detector.getPeriod() : 0;
+    result.finalPopulation = grid.countLivingCells();
+    result.generations = generation;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+std::vector<SweepResult> ParameterSweep::run(const std::vector<SweepJob>& jobs, std::ostream& csv) const {
+    std::vector<SweepResult> results(jobs.size());
+    const std::int64_t count = static_cast<std::int64_t>(jobs.size());
+
+    writeCsvHeader(csv);
+    std::mutex csvMutex;
+    std::atomic<std::int64_t> next(0);
+    auto work = [&](std::int64_t, std::int64_t) {
+        for (std::int64_t i = next++; i < count; i = next++) {
+            results[i] = runJob(jobs[i]);
+            std::lock_guard<std::mutex> lock(csvMutex);
+            writeCsvRow(csv, results[i]);
+            csv.flush();
+        }
+    };
+    if (count > 1) {
+        Grid::runOnWorkers(count, work);
+    } else {
+        work(0, count);
+    }
+    return results;
+}
+
+void ParameterSweep::writeCsvHeader(std::ostream& out) {
+    out << "job,rule,density,width,height,repetition,seed,settled,settle_generation,period,"
+           "final_population,generations,seconds\n";
+}
+
+void ParameterSweep::writeCsvRow(std::ostream& out, const SweepResult& result) {
+    const SweepJob& job = result.job;
+    out << job.index << ',' << job.rule << ',' << job.density << ',' << job.width << ',' << job.height << ','
+        << job.repetition << ',' << job.seed << ',' << (result.settled ? 1 : 0) << ','
+        << result.settleGeneration << ',' << result.period << ',' << result.finalPopulation << ','
+        << result.generations << ',' << result.seconds << '\n';
+}
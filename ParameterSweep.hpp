@@ -0,0 +1,146 @@
+#ifndef PARAMETERSWEEP_HPP
+#define PARAMETERSWEEP_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Déclarations anticipées
+class Rule;
+
+/**
+ * @brief Une combinaison de paramètres à simuler
+ */
+struct SweepJob {
+    std::int64_t index = 0;      // Position dans le produit cartésien
+    std::string rule;            // Nom de la règle (RuleFactory::createByName)
+    double density = 0.0;        // Densité initiale (randomize)
+    std::int64_t width = 0;      // Dimensions de la grille
+    std::int64_t height = 0;
+    std::int64_t repetition = 0; // Numéro de répétition de la combinaison
+    std::uint64_t seed = 0;      // Graine propre au calcul
+    double estimatedCost = 0.0;  // Coût estimé (ordre de lancement)
+};
+
+/**
+ * @brief Résultat d'une combinaison
+ */
+struct SweepResult {
+    SweepJob job;
+    bool settled = false;               // true si stable ou périodique avant la limite
+    std::int64_t settleGeneration = -1; // Première génération de l'état périodique
+    int period = 0;                     // Période de l'état final
+    std::int64_t finalPopulation = 0;   // Population à l'arrêt
+    std::int64_t generations = 0;       // Générations simulées
+    double seconds = 0.0;               // Durée du calcul
+};
+
+/**
+ * @class ParameterSweep
+ * @brief Balayage densité x règle x taille, résultats au format CSV
+ *
+ * Chaque combinaison (répétée si demandé) est une soupe sur une BitGrid
+ * bornée, simulée jusqu'à sa stabilisation (StabilizationDetector) ou la
+ * limite de générations. La graine d'un calcul ne dépend que de sa position
+ * dans le produit cartésien : le balayage est rejouable. Les calculs sont
+ * lancés du plus coûteux au moins coûteux, chaque cœur prenant le suivant
+ * dès qu'il est libre, et chaque ligne CSV est écrite dès la fin du calcul.
+ */
+class ParameterSweep {
+public:
+    /**
+     * @brief Nombre maximal de générations par calcul par défaut
+     */
+    static const std::int64_t DEFAULT_MAX_GENERATIONS = 10000;
+
+    /**
+     * @brief Générations de répétition exigées avant de conclure
+     */
+    static const std::int64_t CONFIRMATION_WINDOW = 16;
+
+    /**
+     * @brief Constructeur
+     * @param maxGenerations Limite de générations par calcul
+     */
+    explicit ParameterSweep(std::int64_t maxGenerations = DEFAULT_MAX_GENERATIONS);
+
+    /**
+     * @brief Décode des densités : "0.1:0.5:0.1" (début:fin:pas) ou "0.2,0.35"
+     * @param text Texte à décoder
+     * @param densities Sortie : densités
+     * @return false si le texte est invalide (message sur std::cerr)
+     */
+    static bool parseDensities(const std::string& text, std::vector<double>& densities);
+
+    /**
+     * @brief Décode des règles : "all" ou "classic,B36/S23,..."
+     * @param text Texte à décoder (noms de RuleFactory::getRuleNames ou notations B/S)
+     * @param rules Sortie : noms de règles
+     * @return false si une règle est inconnue
+     */
+    static bool parseRules(const std::string& text, std::vector<std::string>& rules);
+
+    /**
+     * @brief Crée une règle depuis un nom court ou une notation B/S
+     * @param rule Nom ("classic"...) ou notation ("B36/S23")
+     * @return Règle créée, nullptr si elle est inconnue
+     */
+    static std::unique_ptr<Rule> createRule(const std::string& rule);
+
+    /**
+     * @brief Décode des tailles : "64x64,128x96" ou "64x64:1024x1024" (doublement)
+     * @param text Texte à décoder
+     * @param sizes Sortie : dimensions (largeur, hauteur)
+     * @return false si le texte est invalide
+     */
+    static bool parseSizes(const std::string& text, std::vector<std::pair<std::int64_t, std::int64_t>>& sizes);
+
+    /**
+     * @brief Construit le produit cartésien, trié par coût estimé décroissant
+     * @param densities Densités
+     * @param rules Règles
+     * @param sizes Tailles
+     * @param repetitions Nombre de calculs par combinaison
+     * @param baseSeed Graine du premier calcul
+     * @return Calculs, du plus coûteux au moins coûteux
+     */
+    std::vector<SweepJob> plan(const std::vector<double>& densities, const std::vector<std::string>& rules,
+                               const std::vector<std::pair<std::int64_t, std::int64_t>>& sizes,
+                               std::int64_t repetitions, std::uint64_t baseSeed) const;
+
+    /**
+     * @brief Exécute un calcul
+     * @param job Paramètres du calcul
+     * @return Résultat
+     */
+    SweepResult runJob(const SweepJob& job) const;
+
+    /**
+     * @brief Exécute tous les calculs en parallèle et écrit le CSV au fil de l'eau
+     * @param jobs Calculs (dans l'ordre de lancement)
+     * @param csv Flux CSV (en-tête compris)
+     * @return Résultats, dans l'ordre des calculs
+     */
+    std::vector<SweepResult> run(const std::vector<SweepJob>& jobs, std::ostream& csv) const;
+
+    /**
+     * @brief Écrit l'en-tête CSV
+     * @param out Flux de sortie
+     */
+    static void writeCsvHeader(std::ostream& out);
+
+    /**
+     * @brief Écrit une ligne CSV
+     * @param out Flux de sortie
+     * @param result Résultat à écrire
+     */
+    static void writeCsvRow(std::ostream& out, const SweepResult& result);
+
+private:
+    std::int64_t maxGenerations;
+};
+
+#endif // PARAMETERSWEEP_HPP
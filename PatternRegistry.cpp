@@ -0,0 +1,399 @@
+#include "PatternRegistry.hpp"
+#include "Grid.hpp"
+#include "GridView.hpp"
+#include "FileHandler.hpp"
+#include <algorithm>
+#include <iostream>
+
+#ifndef _WIN32
+#include <dirent.h>
+#endif
+
+namespace {
+
+// Hauteur maximale d'un motif intégré (chaque ligne tient dans un mot de 64 bits)
+const int MAX_BUILTIN_ROWS = 16;
+
+/**
+ * @brief Convertit une ligne de motif ('O' = vivante) en mot de 64 bits
+ */
+constexpr std::uint64_t rowBits(const char* line) {
+    std::uint64_t bits = 0;
+    for (int x = 0; line[x] != '\0'; ++x) {
+        if (line[x] == 'O') {
+            bits |= std::uint64_t(1) << x;
+        }
+    }
+    return bits;
+}
+
+/**
+ * @brief Longueur d'une ligne de motif
+ */
+constexpr int rowLength(const char* line) {
+    int length = 0;
+    while (line[length] != '\0') {
+        ++length;
+    }
+    return length;
+}
+
+/**
+ * @brief Motif intégré, compilé en bitmap à la compilation
+ */
+struct BuiltinPattern {
+    const char* name;
+    int width;
+    int height;
+    std::uint64_t rows[MAX_BUILTIN_ROWS];
+
+    template <typename... Lines>
+    constexpr BuiltinPattern(const char* name, Lines... lines)
+        : name(name), width(0), height(static_cast<int>(sizeof...(lines))), rows{rowBits(lines)...} {
+        const char* all[] = {lines...};
+        for (int y = 0; y < height; ++y) {
+            width = rowLength(all[y]) > width ? rowLength(all[y]) : width;
+        }
+    }
+};
+
+// Les coordonnées sont celles des anciens motifs de Grid::placePattern
+constexpr BuiltinPattern BUILTIN_PATTERNS[] = {
+    // Planeur (glider)
+    BuiltinPattern("glider",
+        ".O.",
+        "..O",
+        "OOO"),
+    // Clignotant (oscillateur période 2)
+    BuiltinPattern("blinker",
+        "...",
+        "OOO"),
+    // Balise (oscillateur période 2)
+    BuiltinPattern("beacon",
+        "OO..",
+        "O...",
+        "...O",
+        "..OO"),
+    // Crapaud (oscillateur période 2)
+    BuiltinPattern("toad",
+        ".OOO",
+        "OOO."),
+    // Lightweight Spaceship (vaisseau léger)
+    BuiltinPattern("lwss",
+        ".O..O",
+        "O....",
+        "O...O",
+        "OOOO."),
+    // Pulsar (oscillateur période 3)
+    BuiltinPattern("pulsar",
+        "..OOO...OOO..",
+        ".............",
+        "O....O.O....O",
+        "O....O.O....O",
+        "O....O.O....O",
+        "..OOO...OOO..",
+        ".............",
+        "..OOO...OOO..",
+        "O....O.O....O",
+        "O....O.O....O",
+        "O....O.O....O",
+        ".............",
+        "..OOO...OOO.."),
+    // Pentadécathlon (oscillateur période 15)
+    BuiltinPattern("pentadecathlon",
+        ".O.",
+        ".O.",
+        "O.O",
+        ".O.",
+        ".O.",
+        ".O.",
+        ".O.",
+        "O.O",
+        ".O.",
+        ".O."),
+    // Canon à planeurs de Gosper
+    BuiltinPattern("glider_gun",
+        "........................O...........",
+        "......................O.O...........",
+        "............OO......OO............OO",
+        "...........O...O....OO............OO",
+        "OO........O.....O...OO..............",
+        "OO........O...O.OO....O.O...........",
+        "..........O.....O.......O...........",
+        "...........O...O....................",
+        "............OO......................"),
+    // Bloc (nature morte)
+    BuiltinPattern("block",
+        "OO",
+        "OO"),
+    // Ruche (nature morte)
+    BuiltinPattern("beehive",
+        ".OO.",
+        "O..O",
+        ".OO."),
+    // Pain (nature morte)
+    BuiltinPattern("loaf",
+        ".OO.",
+        "O..O",
+        ".O.O",
+        "..O."),
+    // Bateau (nature morte)
+    BuiltinPattern("boat",
+        "OO.",
+        "O.O",
+        ".O."),
+    // R-pentomino (méthuselah)
+    BuiltinPattern("r_pentomino",
+        ".OO",
+        "OO.",
+        ".O."),
+    // Diehard (méthuselah qui meurt après 130 générations)
+    BuiltinPattern("diehard",
+        "......O.",
+        "OO......",
+        ".O...OOO"),
+    // Gland (méthuselah)
+    BuiltinPattern("acorn",
+        ".O.....",
+        "...O...",
+        "OO..OOO")
+};
+
+// Vérifications à la compilation : les bitmaps sont bien des constantes
+static_assert(BUILTIN_PATTERNS[0].rows[2] == 7, "Planeur : dernière ligne OOO");
+static_assert(BUILTIN_PATTERNS[7].width == 36 && BUILTIN_PATTERNS[7].height == 9,
+              "Canon de Gosper : 36x9");
+
+} // namespace
+
+// ============================================================
+// Implémentation de PatternBitmap
+// ============================================================
+
+const std::uint64_t* PatternBitmap::row(std::int64_t y) const {
+    return words.data() + y * wordsPerRow;
+}
+
+std::int64_t PatternBitmap::countLivingCells() const {
+    std::int64_t count = 0;
+    for (std::uint64_t word : words) {
+        count += __builtin_popcountll(word);
+    }
+    return count;
+}
+
+PatternBitmap PatternBitmap::fromView(const std::string& name, const GridView& view) {
+    PatternBitmap pattern;
+    pattern.name = name;
+    pattern.width = view.getWidth();
+    pattern.height = view.getHeight();
+    pattern.wordsPerRow = (pattern.width + 63) / 64;
+    pattern.words.assign(static_cast<size_t>(pattern.wordsPerRow * pattern.height), 0);
+    for (std::int64_t y = 0; y < pattern.height; ++y) {
+        for (std::int64_t x = 0; x < pattern.width; ++x) {
+            if (view.at(x, y).isAlive()) {
+                pattern.words[y * pattern.wordsPerRow + x / 64] |= std::uint64_t(1) << (x % 64);
+            }
+        }
+    }
+    return pattern;
+}
+
+PatternBitmap PatternBitmap::transformed(PatternTransform transform) const {
+    bool swapAxes = transform == PatternTransform::ROTATE_90 || transform == PatternTransform::ROTATE_270 ||
+                    transform == PatternTransform::TRANSPOSE || transform == PatternTransform::ANTI_TRANSPOSE;
+
+    PatternBitmap result;
+    result.name = name;
+    result.width = swapAxes ? height : width;
+    result.height = swapAxes ? width : height;
+    result.wordsPerRow = (result.width + 63) / 64;
+    result.words.assign(static_cast<size_t>(result.wordsPerRow * result.height), 0);
+
+    for (std::int64_t y = 0; y < height; ++y) {
+        const std::uint64_t* source = row(y);
+        for (std::int64_t wx = 0; wx < wordsPerRow; ++wx) {
+            std::uint64_t word = source[wx];
+            while (word != 0) {
+                std::int64_t x = wx * 64 + __builtin_ctzll(word);
+                word &= word - 1;
+
+                std::int64_t nx = x;
+                std::int64_t ny = y;
+                switch (transform) {
+                    case PatternTransform::IDENTITY:       nx = x;              ny = y;              break;
+                    case PatternTransform::ROTATE_90:      nx = height - 1 - y; ny = x;              break;
+                    case PatternTransform::ROTATE_180:     nx = width - 1 - x;  ny = height - 1 - y; break;
+                    case PatternTransform::ROTATE_270:     nx = y;              ny = width - 1 - x;  break;
+                    case PatternTransform::FLIP_X:         nx = width - 1 - x;  ny = y;              break;
+                    case PatternTransform::FLIP_Y:         nx = x;              ny = height - 1 - y; break;
+                    case PatternTransform::TRANSPOSE:      nx = y;              ny = x;              break;
+                    case PatternTransform::ANTI_TRANSPOSE: nx = height - 1 - y; ny = width - 1 - x;  break;
+                }
+                result.words[ny * result.wordsPerRow + nx / 64] |= std::uint64_t(1) << (nx % 64);
+            }
+        }
+    }
+    return result;
+}
+
+// ============================================================
+// Implémentation de PatternRegistry
+// ============================================================
+
+const char* const PatternRegistry::DEFAULT_DIRECTORY = "patterns";
+
+PatternRegistry::PatternRegistry() : directory(DEFAULT_DIRECTORY) {
+    for (const BuiltinPattern& builtin : BUILTIN_PATTERNS) {
+        std::unique_ptr<PatternBitmap> pattern(new PatternBitmap());
+        pattern->name = builtin.name;
+        pattern->width = builtin.width;
+        pattern->height = builtin.height;
+        pattern->wordsPerRow = 1;
+        pattern->words.assign(builtin.rows, builtin.rows + builtin.height);
+        patterns[builtin.name] = std::move(pattern);
+    }
+}
+
+PatternRegistry& PatternRegistry::get() {
+    static PatternRegistry registry;
+    return registry;
+}
+
+const PatternBitmap* PatternRegistry::find(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return findLocked(name);
+}
+
+const PatternBitmap* PatternRegistry::findLocked(const std::string& name) {
+    auto it = patterns.find(name);
+    if (it != patterns.end()) {
+        return it->second.get();
+    }
+    if (missing.count(name) != 0) {
+        return nullptr;
+    }
+    const PatternBitmap* loaded = loadFromDirectory(name);
+    if (!loaded) {
+        missing.insert(name);
+    }
+    return loaded;
+}
+
+const PatternBitmap* PatternRegistry::find(const std::string& name, PatternTransform transform) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const PatternBitmap* base = findLocked(name);
+    if (!base || transform == PatternTransform::IDENTITY) {
+        return base;
+    }
+
+    std::string key = name + "#" + std::to_string(static_cast<int>(transform));
+    std::unique_ptr<PatternBitmap>& slot = transformed[key];
+    if (!slot) {
+        slot.reset(new PatternBitmap(base->transformed(transform)));
+    }
+    return slot.get();
+}
+
+std::vector<const PatternBitmap*> PatternRegistry::resolve(const std::vector<PatternPlacement>& placements) {
+    std::vector<const PatternBitmap*> bitmaps;
+    bitmaps.reserve(placements.size());
+
+    // Les listes répètent souvent le même motif : on évite de rechercher deux fois de suite
+    const PatternPlacement* previous = nullptr;
+    for (const PatternPlacement& placement : placements) {
+        if (previous && previous->pattern == placement.pattern && previous->transform == placement.transform) {
+            bitmaps.push_back(bitmaps.back());
+        } else {
+            bitmaps.push_back(find(placement.pattern, placement.transform));
+        }
+        previous = &placement;
+    }
+    return bitmaps;
+}
+
+const PatternBitmap* PatternRegistry::add(const PatternBitmap& pattern) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Remplacer un motif libérerait des bitmaps encore utilisées par d'autres threads
+    std::unique_ptr<PatternBitmap>& slot = patterns[pattern.name];
+    if (slot) {
+        std::cerr << "Erreur : Le motif " << pattern.name << " existe déjà" << std::endl;
+        return nullptr;
+    }
+    slot.reset(new PatternBitmap(pattern));
+    missing.erase(pattern.name);
+    return slot.get();
+}
+
+void PatternRegistry::setDirectory(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    directory = path;
+    missing.clear();
+}
+
+std::string PatternRegistry::getDirectory() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return directory;
+}
+
+const PatternBitmap* PatternRegistry::loadFromDirectory(const std::string& name) {
+    // Un nom de motif ne désigne qu'un fichier du répertoire
+    if (name.empty() || name.find('/') != std::string::npos || name.find('\\') != std::string::npos) {
+        return nullptr;
+    }
+    std::string path = directory + "/" + name + ".rle";
+    if (!DirectoryManager::fileExists(path)) {
+        return nullptr;
+    }
+
+    Grid grid(1, 1);
+    RLEFileHandler handler;
+    if (!handler.load(path, grid)) {
+        return nullptr;
+    }
+
+    std::unique_ptr<PatternBitmap>& slot = patterns[name];
+    slot.reset(new PatternBitmap(PatternBitmap::fromView(name, GridView(grid))));
+    return slot.get();
+}
+
+std::vector<std::string> PatternRegistry::getBuiltinNames() {
+    std::vector<std::string> names;
+    for (const BuiltinPattern& builtin : BUILTIN_PATTERNS) {
+        names.push_back(builtin.name);
+    }
+    return names;
+}
+
+std::vector<std::string> PatternRegistry::getNames() const {
+    std::vector<std::string> names = getBuiltinNames();
+    std::vector<std::string> extra;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& entry : patterns) {
+            if (std::find(names.begin(), names.end(), entry.first) == names.end()) {
+                extra.push_back(entry.first);
+            }
+        }
+
+#ifndef _WIN32
+        // Fichiers du répertoire pas encore chargés
+        if (DIR* dir = opendir(directory.c_str())) {
+            while (dirent* entry = readdir(dir)) {
+                std::string file = entry->d_name;
+                if (file.size() > 4 && file.compare(file.size() - 4, 4, ".rle") == 0) {
+                    std::string name = file.substr(0, file.size() - 4);
+                    if (std::find(names.begin(), names.end(), name) == names.end() &&
+                        std::find(extra.begin(), extra.end(), name) == extra.end()) {
+                        extra.push_back(name);
+                    }
+                }
+            }
+            closedir(dir);
+        }
+#endif
+    }
+    std::sort(extra.begin(), extra.end());
+    names.insert(names.end(), extra.begin(), extra.end());
+    return names;
+}
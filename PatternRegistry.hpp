@@ -0,0 +1,196 @@
+#ifndef PATTERNREGISTRY_HPP
+#define PATTERNREGISTRY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Déclaration anticipée
+class GridView;
+
+/**
+ * @brief Les 8 symétries du carré (groupe D4) applicables à un motif
+ */
+enum class PatternTransform {
+    IDENTITY,        // Orientation d'origine
+    ROTATE_90,       // Rotation d'un quart de tour (sens horaire)
+    ROTATE_180,      // Demi-tour
+    ROTATE_270,      // Rotation de trois quarts de tour (sens horaire)
+    FLIP_X,          // Miroir gauche/droite
+    FLIP_Y,          // Miroir haut/bas
+    TRANSPOSE,       // Symétrie par rapport à la diagonale principale
+    ANTI_TRANSPOSE   // Symétrie par rapport à l'anti-diagonale
+};
+
+/**
+ * @brief Nombre de transformations de PatternTransform
+ */
+const int PATTERN_TRANSFORM_COUNT = 8;
+
+/**
+ * @brief Motif compact : une cellule par bit, lignes de mots de 64 bits
+ *
+ * Même disposition que BitGrid (bit x % 64 du mot x / 64), ce qui permet de
+ * poser un motif par OU de mots entiers.
+ */
+struct PatternBitmap {
+    std::string name;
+    std::int64_t width = 0;
+    std::int64_t height = 0;
+    std::int64_t wordsPerRow = 0;
+    std::vector<std::uint64_t> words;  // height * wordsPerRow mots
+
+    /**
+     * @brief Accède à une ligne du motif
+     * @param y Numéro de ligne
+     * @return Pointeur vers les mots de la ligne
+     */
+    const std::uint64_t* row(std::int64_t y) const;
+
+    /**
+     * @brief Compte les cellules vivantes du motif
+     * @return Nombre de cellules vivantes
+     */
+    std::int64_t countLivingCells() const;
+
+    /**
+     * @brief Construit un motif à partir d'une région de grille
+     * @param name Nom du motif
+     * @param view Région source
+     * @return Motif compact
+     */
+    static PatternBitmap fromView(const std::string& name, const GridView& view);
+
+    /**
+     * @brief Calcule le motif transformé
+     * @param transform Symétrie à appliquer
+     * @return Nouveau motif (dimensions échangées pour les rotations d'un quart de tour)
+     */
+    PatternBitmap transformed(PatternTransform transform) const;
+};
+
+/**
+ * @brief Pose d'un motif : nom, orientation et position (coin supérieur gauche)
+ */
+struct PatternPlacement {
+    std::string pattern;
+    PatternTransform transform;
+    std::int64_t x;
+    std::int64_t y;
+};
+
+/**
+ * @class PatternRegistry
+ * @brief Catalogue des motifs : recherche par nom en table de hachage
+ *
+ * Les motifs intégrés sont compilés en bitmaps (constexpr) ; les autres sont
+ * chargés à la demande depuis un répertoire de fichiers RLE (<nom>.rle), puis
+ * gardés en cache. Les noms introuvables sont aussi retenus : un fichier
+ * ajouté au répertoire après un échec n'est vu qu'après setDirectory().
+ *
+ * Un motif enregistré n'est jamais remplacé ni libéré : les pointeurs rendus
+ * par find(), resolve() et add() restent valides jusqu'à la fin du programme
+ * et peuvent être partagés entre threads.
+ */
+class PatternRegistry {
+public:
+    /**
+     * @brief Répertoire par défaut des motifs supplémentaires
+     */
+    static const char* const DEFAULT_DIRECTORY;
+
+    /**
+     * @brief Obtient le catalogue partagé
+     * @return Catalogue
+     */
+    static PatternRegistry& get();
+
+    /**
+     * @brief Cherche un motif (intégré, déjà chargé, ou fichier RLE du répertoire)
+     * @param name Nom du motif
+     * @return Motif, ou nullptr s'il est inconnu
+     */
+    const PatternBitmap* find(const std::string& name);
+
+    /**
+     * @brief Cherche un motif dans une orientation donnée
+     *
+     * Chaque orientation est calculée au premier appel puis gardée en cache.
+     *
+     * @param name Nom du motif
+     * @param transform Symétrie à appliquer
+     * @return Motif transformé, ou nullptr si le motif est inconnu
+     */
+    const PatternBitmap* find(const std::string& name, PatternTransform transform);
+
+    /**
+     * @brief Résout une liste de poses en motifs (une recherche par nom et orientation)
+     * @param placements Poses à résoudre
+     * @return Motif de chaque pose (nullptr pour un motif inconnu)
+     */
+    std::vector<const PatternBitmap*> resolve(const std::vector<PatternPlacement>& placements);
+
+    /**
+     * @brief Ajoute un motif (un nom déjà enregistré est refusé)
+     * @param pattern Motif à enregistrer
+     * @return Motif enregistré, ou nullptr si le nom existe déjà
+     */
+    const PatternBitmap* add(const PatternBitmap& pattern);
+
+    /**
+     * @brief Définit le répertoire des fichiers RLE supplémentaires
+     *
+     * Les noms introuvables sont oubliés ; les motifs déjà chargés restent.
+     *
+     * @param directory Chemin du répertoire
+     */
+    void setDirectory(const std::string& directory);
+
+    /**
+     * @brief Obtient le répertoire des fichiers RLE supplémentaires
+     * @return Chemin du répertoire
+     */
+    std::string getDirectory() const;
+
+    /**
+     * @brief Liste les motifs : intégrés (dans l'ordre), puis ceux du répertoire
+     * @return Noms des motifs
+     */
+    std::vector<std::string> getNames() const;
+
+    /**
+     * @brief Liste les motifs intégrés
+     * @return Noms des motifs intégrés
+     */
+    static std::vector<std::string> getBuiltinNames();
+
+private:
+    mutable std::mutex mutex;
+    std::string directory;
+    std::unordered_map<std::string, std::unique_ptr<PatternBitmap>> patterns;
+    std::unordered_map<std::string, std::unique_ptr<PatternBitmap>> transformed;  // Clé : nom#orientation
+    std::unordered_set<std::string> missing;      // Noms absents du répertoire
+
+    /**
+     * @brief Cherche un motif (appelé sous verrou)
+     */
+    const PatternBitmap* findLocked(const std::string& name);
+
+    /**
+     * @brief Constructeur : enregistre les motifs intégrés
+     */
+    PatternRegistry();
+
+    /**
+     * @brief Charge un motif depuis le répertoire (appelé sous verrou)
+     * @param name Nom du motif
+     * @return Motif chargé, ou nullptr
+     */
+    const PatternBitmap* loadFromDirectory(const std::string& name);
+};
+
+#endif // PATTERNREGISTRY_HPP
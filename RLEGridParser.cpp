@@ -0,0 +1,342 @@
+#include "RLEGridParser.hpp"
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const std::int64_t WORD_BITS = 64;
+
+/**
+ * @brief Taille nominale d'une tranche (décodage et libération des pages)
+ */
+const std::int64_t CHUNK_BYTES = 1024 * 1024;
+
+inline bool isSpace(char c) {
+    return static_cast<unsigned char>(c) <= ' ';
+}
+
+inline bool isDigit(char c) {
+    return static_cast<unsigned>(c - '0') <= 9u;
+}
+
+/**
+ * @brief Pose les cellules [x, x + count[ d'une ligne de bits
+ *
+ * Les mots entièrement couverts sont remplis d'un coup : une plage de
+ * 10 000 cellules coûte 157 écritures.
+ */
+void fillRun(std::uint64_t* row, std::int64_t x, std::int64_t count) {
+    std::int64_t word = x / WORD_BITS;
+    const int first = static_cast<int>(x % WORD_BITS);
+    const std::int64_t endCell = x + count;
+    const std::int64_t lastWord = (endCell - 1) / WORD_BITS;
+    const int last = static_cast<int>((endCell - 1) % WORD_BITS);
+
+    if (word == lastWord) {
+        const std::uint64_t high = last == WORD_BITS - 1 ? ~0ULL : (2ULL << last) - 1;
+        row[word] |= high & (~0ULL << first);
+        return;
+    }
+    row[word++] |= ~0ULL << first;
+    while (word < lastWord) {
+        row[word++] = ~0ULL;
+    }
+    row[word] |= last == WORD_BITS - 1 ? ~0ULL : (2ULL << last) - 1;
+}
+
+/**
+ * @brief Tranche du corps, commençant en début de ligne
+ */
+struct Chunk {
+    const char* begin;
+    const char* end;
+    std::int64_t rows;   // Passe 1 : fins de ligne de la tranche
+    bool terminated;     // Passe 1 : "!" rencontré
+};
+
+/**
+ * @brief Lit les répétitions : un nombre plus grand que limit vaut limit
+ */
+inline std::int64_t addDigit(std::int64_t count, char c, std::int64_t limit) {
+    return count <= limit / 10 ? count * 10 + (c - '0') : limit;
+}
+
+/**
+ * @brief Compte les fins de ligne d'une tranche (première passe parallèle)
+ */
+void countRows(Chunk& chunk, std::int64_t limit) {
+    std::int64_t rows = 0;
+    std::int64_t count = 0;
+    chunk.terminated = false;
+    for (const char* p = chunk.begin; p < chunk.end; ++p) {
+        const char c = *p;
+        if (isDigit(c)) {
+            count = addDigit(count, c, limit);
+            continue;
+        }
+        if (isSpace(c)) continue;
+        if (c == '$') {
+            rows = std::min(rows + std::max<std::int64_t>(count, 1), limit);
+        } else if (c == '!') {
+            chunk.terminated = true;
+            break;
+        }
+        count = 0;
+    }
+    chunk.rows = rows;
+}
+
+/**
+ * @brief Décode une tranche à partir de la ligne y
+ * @return Ligne atteinte à la fin de la tranche, height après un "!"
+ */
+template <class Target>
+std::int64_t decodeChunk(const Chunk& chunk, std::int64_t y, std::int64_t width, std::int64_t height,
+                         Target& target) {
+    const std::int64_t countLimit = width + height;
+    std::int64_t x = 0;
+    std::int64_t count = 0;
+
+    for (const char* p = chunk.begin; p < chunk.end && y < height; ++p) {
+        const char c = *p;
+        if (isDigit(c)) {
+            // Un nombre plus grand que la grille a le même effet que la grille entière
+            count = addDigit(count, c, countLimit);
+            continue;
+        }
+        if (isSpace(c)) continue;
+        if (count == 0) count = 1;
+
+        if (c == 'b' || c == '.') {
+            x = std::min(x + count, width);
+        } else if (c == 'o' || c == 'O') {
+            if (x < width) {
+                fillRun(target.row(y), x, std::min(count, width - x));
+            }
+            x = std::min(x + count, width);
+        } else if (c == '$') {
+            y += count;
+            x = 0;
+        } else if (c == '!') {
+            return height;
+        }
+        count = 0;
+    }
+    return y;
+}
+
+/**
+ * @brief Destination BitGrid : les lignes sont celles de la génération courante
+ */
+struct BitGridTarget {
+    BitGrid& grid;
+
+    std::uint64_t* row(std::int64_t y) {
+        return grid.row(y);
+    }
+
+    void finish() {
+    }
+};
+
+/**
+ * @brief Destination Grid : une ligne de bits réutilisée, recopiée à chaque changement de ligne
+ */
+struct GridTarget {
+    Grid& grid;
+    std::vector<std::uint64_t> words;
+    std::int64_t current;  // Ligne contenue dans words (-1 : aucune)
+
+    GridTarget(Grid& grid, std::int64_t wordsPerRow)
+        : grid(grid), words(static_cast<size_t>(wordsPerRow), 0), current(-1) {
+    }
+
+    std::uint64_t* row(std::int64_t y) {
+        if (y != current) {
+            finish();
+            current = y;
+        }
+        return words.data();
+    }
+
+    void finish() {
+        if (current < 0) return;
+        for (size_t i = 0; i < words.size(); ++i) {
+            for (std::uint64_t bits = words[i]; bits != 0; bits &= bits - 1) {
+                grid.getCell(static_cast<std::int64_t>(i) * WORD_BITS + __builtin_ctzll(bits), current)
+                    .setAlive(true);
+            }
+            words[i] = 0;
+        }
+        current = -1;
+    }
+};
+
+} // namespace
+
+RLEGridParser::RLEGridParser()
+    : body(nullptr), end(nullptr), width(0), height(0),
+      parallelMode(std::thread::hardware_concurrency() > 1) {  // Deux passes : inutile sur un seul cœur
+}
+
+void RLEGridParser::setParallelMode(bool parallel) {
+    parallelMode = parallel;
+}
+
+bool RLEGridParser::parse(const std::string& filename) {
+    file.close();
+    if (!file.open(filename, MappedFile::Mode::READ_ONLY)) {
+        return false;  // Message déjà affiché par MappedFile
+    }
+    file.advise(0, file.size(), MappedFile::Advice::SEQUENTIAL);
+    return parse(reinterpret_cast<const char*>(file.data()), file.size());
+}
+
+bool RLEGridParser::parse(const char* data, std::uint64_t size) {
+    width = height = 0;
+    body = end = nullptr;
+
+    // En-tête : lignes vides et commentaires "#", puis "x = ..., y = ..., rule = ..."
+    const char* p = data;
+    const char* limit = data + size;
+    const std::int64_t DIMENSION_LIMIT = std::numeric_limits<std::int64_t>::max() / 16;
+    while (p < limit) {
+        while (p < limit && isSpace(*p)) ++p;
+        if (p == limit || *p != '#') break;
+        while (p < limit && *p != '\n') ++p;
+    }
+    if (p == limit || *p != 'x') {
+        std::cerr << "Erreur : Dimensions non trouvées dans le fichier RLE" << std::endl;
+        return false;
+    }
+
+    // Paires "clé = valeur" séparées par des virgules ; seules x et y sont lues
+    std::int64_t w = 0, h = 0;
+    while (p < limit && *p != '\n') {
+        const char key = *p;
+        while (p < limit && *p != '=' && *p != '\n') ++p;
+        if (p < limit && *p == '=') {
+            ++p;
+            while (p < limit && (*p == ' ' || *p == '\t')) ++p;
+            if (key == 'x' || key == 'y') {
+                std::int64_t value = 0;
+                bool digits = false;
+                while (p < limit && isDigit(*p) && value <= DIMENSION_LIMIT) {
+                    value = value * 10 + (*p++ - '0');
+                    digits = true;
+                }
+                (key == 'x' ? w : h) = digits && value <= DIMENSION_LIMIT ? value : -1;
+            }
+        }
+        while (p < limit && *p != ',' && *p != '\n') ++p;
+        if (p < limit && *p == ',') ++p;
+        while (p < limit && (*p == ' ' || *p == '\t')) ++p;
+    }
+
+    if (w <= 0 || h <= 0) {
+        std::cerr << "Erreur : Dimensions non trouvées dans le fichier RLE" << std::endl;
+        return false;
+    }
+    width = w;
+    height = h;
+    body = p;
+    end = limit;
+    return true;
+}
+
+std::int64_t RLEGridParser::getWidth() const {
+    return width;
+}
+
+std::int64_t RLEGridParser::getHeight() const {
+    return height;
+}
+
+template <class MakeTarget>
+void RLEGridParser::decode(MakeTarget makeTarget) {
+    // Tranches coupées juste après un "$" : chacune commence en début de ligne, x = 0
+    std::vector<Chunk> chunks;
+    for (const char* begin = body; begin < end;) {
+        const char* cut = end - begin > CHUNK_BYTES ? begin + CHUNK_BYTES : end;
+        while (cut < end && cut[-1] != '$') ++cut;
+        chunks.push_back({begin, cut, 0, false});
+        begin = cut;
+    }
+    const std::uint64_t base = file.isOpen() ? reinterpret_cast<std::uintptr_t>(file.data()) : 0;
+    auto release = [this, base](const Chunk& chunk) {
+        // Pages déjà décodées : inutile de les garder en mémoire
+        if (base != 0) {
+            file.advise(reinterpret_cast<std::uintptr_t>(chunk.begin) - base,
+                        static_cast<std::uint64_t>(chunk.end - chunk.begin), MappedFile::Advice::DONT_NEED);
+        }
+    };
+
+    if (!parallelMode || static_cast<std::uint64_t>(end - body) < PARALLEL_BYTES) {
+        auto target = makeTarget();
+        std::int64_t y = 0;
+        for (size_t i = 0; i < chunks.size() && y < height; ++i) {
+            y = decodeChunk(chunks[i], y, width, height, target);
+            release(chunks[i]);
+        }
+        target.finish();
+        return;
+    }
+
+    // Passe 1 : fins de ligne de chaque tranche
+    const std::int64_t chunkCount = static_cast<std::int64_t>(chunks.size());
+    const std::int64_t rowLimit = width + height;
+    Grid::runOnWorkers(chunkCount, [&chunks, rowLimit](std::int64_t first, std::int64_t last) {
+        for (std::int64_t i = first; i < last; ++i) {
+            countRows(chunks[i], rowLimit);
+        }
+    });
+
+    // Ligne de départ de chaque tranche ; rien après le "!" ni au-delà de la grille
+    std::vector<std::int64_t> starts(chunks.size(), height);
+    std::int64_t y = 0;
+    for (size_t i = 0; i < chunks.size() && y < height; ++i) {
+        starts[i] = y;
+        y = chunks[i].terminated ? height : std::min(height, y + chunks[i].rows);
+    }
+
+    // Passe 2 : chaque tranche écrit ses propres lignes
+    Grid::runOnWorkers(chunkCount, [&](std::int64_t first, std::int64_t last) {
+        auto target = makeTarget();
+        for (std::int64_t i = first; i < last; ++i) {
+            if (starts[i] >= height) continue;
+            decodeChunk(chunks[i], starts[i], width, height, target);
+            release(chunks[i]);
+        }
+        target.finish();
+    });
+}
+
+bool RLEGridParser::toGrid(Grid& grid) {
+    if (width <= 0 || height <= 0 || !grid.resize(width, height)) {
+        return false;
+    }
+    const std::int64_t wordsPerRow = (width + WORD_BITS - 1) / WORD_BITS;
+    decode([&grid, wordsPerRow]() { return GridTarget(grid, wordsPerRow); });
+    return true;
+}
+
+std::unique_ptr<BitGrid> RLEGridParser::toBitGrid() {
+    if (width <= 0 || height <= 0) {
+        return nullptr;
+    }
+    std::unique_ptr<BitGrid> bits;
+    try {
+        bits.reset(new BitGrid(width, height));
+    } catch (const std::exception&) {
+        std::cerr << "Erreur : Mémoire insuffisante pour une grille " << width << "x" << height << std::endl;
+        return nullptr;
+    }
+    BitGrid& grid = *bits;
+    decode([&grid]() { return BitGridTarget{grid}; });
+    return bits;
+}
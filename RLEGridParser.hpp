@@ -0,0 +1,106 @@
+#ifndef RLEGRIDPARSER_HPP
+#define RLEGRIDPARSER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "MappedFile.hpp"
+
+// Déclarations anticipées
+class Grid;
+class BitGrid;
+
+/**
+ * @class RLEGridParser
+ * @brief Lecture en flux des fichiers RLE, sans tampon intermédiaire
+ *
+ * Le fichier est projeté en mémoire ; parse() ne lit que l'en-tête
+ * (commentaires "#..." puis "x = largeur, y = hauteur"). Le corps est
+ * décodé par toGrid() ou toBitGrid() au fil de la lecture : chaque plage
+ * "no" est posée directement dans la ligne de bits de destination, les
+ * mots entièrement couverts étant remplis d'un coup. Les pages lues sont
+ * rendues au système tranche par tranche : un fichier de plusieurs Go se
+ * lit avec la seule mémoire de la grille.
+ *
+ * Les tranches sont coupées juste après un "$" : chacune commence en
+ * début de ligne. Au-delà de PARALLEL_BYTES, une première passe parallèle
+ * compte les fins de ligne de chaque tranche, ce qui donne sa ligne de
+ * départ, puis les tranches sont décodées en parallèle sur des lignes
+ * disjointes.
+ *
+ * Syntaxe : "b" ou "." mort, "o" ou "O" vivant, "$" fin de ligne, "!" fin
+ * du motif, chacun précédé d'un nombre de répétitions facultatif ; les
+ * blancs sont ignorés, les autres lettres aussi. Les cellules hors de la
+ * grille sont ignorées.
+ */
+class RLEGridParser {
+public:
+    /**
+     * @brief Taille du corps au-delà de laquelle le décodage est parallèle
+     */
+    static const std::uint64_t PARALLEL_BYTES = 4ULL * 1024 * 1024;
+
+    /**
+     * @brief Constructeur (décodage parallèle si la machine a plusieurs cœurs)
+     */
+    RLEGridParser();
+
+    /**
+     * @brief Active ou désactive le décodage parallèle des gros fichiers
+     * @param parallel true pour décoder les tranches en parallèle au-delà de PARALLEL_BYTES
+     */
+    void setParallelMode(bool parallel);
+
+    /**
+     * @brief Ouvre un fichier RLE et lit son en-tête
+     * @param filename Fichier à lire
+     * @return false si le fichier est absent ou sans dimensions (message sur std::cerr)
+     */
+    bool parse(const std::string& filename);
+
+    /**
+     * @brief Lit l'en-tête d'un RLE déjà en mémoire (doit rester valide jusqu'au décodage)
+     * @param data Début du texte
+     * @param size Taille en octets
+     * @return false si les dimensions sont absentes ou invalides
+     */
+    bool parse(const char* data, std::uint64_t size);
+
+    std::int64_t getWidth() const;
+    std::int64_t getHeight() const;
+
+    /**
+     * @brief Décode le motif dans une Grid (redimensionnée)
+     *
+     * Une seule ligne de bits est gardée en mémoire : elle est recopiée
+     * dans la grille quand le décodage passe à la suivante.
+     *
+     * @param grid Grille destination
+     * @return false si la grille ne peut pas être allouée
+     */
+    bool toGrid(Grid& grid);
+
+    /**
+     * @brief Décode le motif directement dans les lignes d'une BitGrid
+     * @return Grille, nullptr si elle ne peut pas être allouée
+     */
+    std::unique_ptr<BitGrid> toBitGrid();
+
+private:
+    MappedFile file;
+    const char* body;        // Corps encodé (après la ligne "x = ...")
+    const char* end;
+    std::int64_t width;
+    std::int64_t height;
+    bool parallelMode;
+
+    /**
+     * @brief Découpe le corps en tranches et pose les plages vivantes
+     * @param makeTarget Crée une destination par thread : row(y) donne la
+     *        ligne y, finish() termine les tranches du thread
+     */
+    template <class MakeTarget>
+    void decode(MakeTarget makeTarget);
+};
+
+#endif // RLEGRIDPARSER_HPP
@@ -0,0 +1,258 @@
+#include "RLEGridWriter.hpp"
+#include "BitGrid.hpp"
+#include "Cell.hpp"
+#include "Grid.hpp"
+#include "GridView.hpp"
+#include "GridSnapshot.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+const std::int64_t WORD_BITS = 64;
+
+/**
+ * @brief Première cellule de [x, width[ dont le bit vaut value (width si aucune)
+ * @param row Mots de la ligne
+ * @param x Cellule de départ
+ * @param width Cellules de la ligne
+ * @param invert 0 pour chercher un bit à 1, ~0 pour un bit à 0
+ */
+std::int64_t findBit(const std::uint64_t* row, std::int64_t x, std::int64_t width, std::uint64_t invert) {
+    std::int64_t word = x / WORD_BITS;
+    std::uint64_t bits = (row[word] ^ invert) & (~0ULL << (x % WORD_BITS));
+    while (bits == 0) {
+        if (++word * WORD_BITS >= width) {
+            return width;
+        }
+        bits = row[word] ^ invert;
+    }
+    return std::min(width, word * WORD_BITS + __builtin_ctzll(bits));
+}
+
+/**
+ * @brief Réserve de la place dans un tampon qui grandit par doublement
+ */
+inline void reserve(std::vector<char>& text, std::size_t needed) {
+    if (text.size() < needed) {
+        text.resize(std::max(text.size() * 2, needed));
+    }
+}
+
+} // namespace
+
+RLEGridWriter::Band::Band()
+    : used(0), lineLength(0), firstLineLength(0), pendingRows(0), leadingRows(-1) {
+}
+
+RLEGridWriter::RLEGridWriter()
+    : parallelMode(std::thread::hardware_concurrency() > 1) {
+}
+
+void RLEGridWriter::setParallelMode(bool parallel) {
+    parallelMode = parallel;
+}
+
+bool RLEGridWriter::open(std::ofstream& file, const std::string& filename) {
+    file.open(filename);
+    if (!file.is_open()) {
+        std::cerr << "Erreur : Impossible de créer le fichier " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void RLEGridWriter::appendHeader(std::int64_t width, std::int64_t height) {
+    const std::string header = "#C Generated by Game of Life\nx = " + std::to_string(width) +
+                               ", y = " + std::to_string(height) + "\n";
+    output.used = 0;
+    reserve(output.text, header.size());
+    std::memcpy(output.text.data(), header.data(), header.size());
+    output.used = header.size();
+    output.lineLength = 0;
+    output.pendingRows = 0;
+}
+
+void RLEGridWriter::appendToken(Band& band, std::int64_t count, char tag) {
+    // Chiffres écrits à l'envers puis recopiés ; pas de nombre pour une seule cellule
+    char digits[24];
+    std::size_t length = 0;
+    if (count > 1) {
+        for (std::int64_t n = count; n > 0; n /= 10) {
+            digits[length++] = static_cast<char>('0' + n % 10);
+        }
+    }
+
+    reserve(band.text, band.used + length + 2);
+    if (band.lineLength + length + 1 > LINE_LENGTH) {
+        band.text[band.used++] = '\n';
+        band.lineLength = 0;
+    }
+    for (std::size_t i = 0; i < length; ++i) {
+        band.text[band.used++] = digits[length - 1 - i];
+    }
+    band.text[band.used++] = tag;
+    band.lineLength += length + 1;
+}
+
+void RLEGridWriter::appendRow(Band& band, const std::uint64_t* alive, std::int64_t width) {
+    std::int64_t x = 0;
+    while (x < width) {
+        const std::int64_t start = findBit(alive, x, width, 0);
+        if (start == width) break;
+        const std::int64_t stop = findBit(alive, start, width, ~0ULL);
+
+        // Les fins de ligne en attente ne sont écrites qu'avant une cellule vivante ;
+        // celles du début de la bande sont laissées à la jonction
+        if (band.leadingRows < 0) {
+            band.leadingRows = band.pendingRows;
+            band.pendingRows = 0;
+        } else if (band.pendingRows > 0) {
+            appendToken(band, band.pendingRows, '$');
+            band.pendingRows = 0;
+        }
+        if (start > x) {
+            appendToken(band, start - x, 'b');
+        }
+        appendToken(band, stop - start, 'o');
+        x = stop;
+    }
+    ++band.pendingRows;
+}
+
+void RLEGridWriter::join(const Band& band) {
+    if (band.leadingRows < 0) {
+        output.pendingRows += band.pendingRows;  // Bande vide : que des fins de ligne
+        return;
+    }
+    output.pendingRows += band.leadingRows;
+    if (output.pendingRows > 0) {
+        appendToken(output, output.pendingRows, '$');
+    }
+
+    // La première ligne de la bande a été coupée comme si elle commençait une ligne du fichier
+    reserve(output.text, output.used + band.used + 1);
+    if (output.lineLength + band.firstLineLength > LINE_LENGTH) {
+        output.text[output.used++] = '\n';
+        output.lineLength = 0;
+    }
+    std::memcpy(output.text.data() + output.used, band.text.data(), band.used);
+    output.used += band.used;
+    output.lineLength = band.firstLineLength == band.used ? output.lineLength + band.used : band.lineLength;
+    output.pendingRows = band.pendingRows;
+}
+
+template <class AliveRow>
+bool RLEGridWriter::appendRows(std::int64_t height, std::int64_t width, AliveRow aliveRow, std::ofstream* file) {
+    // Bandes de lignes entières, indépendantes du nombre de cœurs
+    const std::int64_t batchBands = BATCH_BANDS;
+    const std::int64_t rowsPerBand = std::max<std::int64_t>(1, BAND_CELLS / std::max<std::int64_t>(width, 1));
+    const std::int64_t bandCount = (height + rowsPerBand - 1) / rowsPerBand;
+    bands.resize(static_cast<size_t>(std::min(bandCount, batchBands)));
+
+    for (std::int64_t batchStart = 0; batchStart < bandCount; batchStart += batchBands) {
+        const std::int64_t batchSize = std::min(batchBands, bandCount - batchStart);
+        auto encode = [&](std::int64_t first, std::int64_t last) {
+            for (std::int64_t i = first; i < last; ++i) {
+                Band& band = bands[i];
+                band.used = 0;
+                band.lineLength = 0;
+                band.pendingRows = 0;
+                band.leadingRows = -1;
+                const std::int64_t y0 = (batchStart + i) * rowsPerBand;
+                const std::int64_t y1 = std::min(height, y0 + rowsPerBand);
+                for (std::int64_t y = y0; y < y1; ++y) {
+                    appendRow(band, aliveRow(y, band.words), width);
+                }
+                const void* newline = band.used > 0 ? std::memchr(band.text.data(), '\n', band.used) : nullptr;
+                band.firstLineLength = newline ? static_cast<const char*>(newline) - band.text.data() : band.used;
+            }
+        };
+        if (parallelMode && batchSize > 1) {
+            Grid::runOnWorkers(batchSize, encode);
+        } else {
+            encode(0, batchSize);
+        }
+
+        for (std::int64_t i = 0; i < batchSize; ++i) {
+            join(bands[i]);
+            if (file && output.used >= FLUSH_BYTES && !flush(*file)) {
+                return false;
+            }
+        }
+    }
+
+    appendToken(output, 1, '!');
+    reserve(output.text, output.used + 1);
+    output.text[output.used++] = '\n';
+    return true;
+}
+
+bool RLEGridWriter::flush(std::ofstream& file) {
+    file.write(output.text.data(), static_cast<std::streamsize>(output.used));
+    output.used = 0;
+    return static_cast<bool>(file);
+}
+
+template <class AliveRow>
+bool RLEGridWriter::writeRows(const std::string& filename, std::int64_t height, std::int64_t width,
+                              AliveRow aliveRow) {
+    std::ofstream file;
+    if (!open(file, filename)) {
+        return false;
+    }
+    appendHeader(width, height);
+    if (!appendRows(height, width, aliveRow, &file) || !flush(file)) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+const std::uint64_t* RLEGridWriter::packRow(const GridView& view, std::int64_t y,
+                                            std::vector<std::uint64_t>& words) {
+    const std::int64_t width = view.getWidth();
+    words.resize(static_cast<size_t>((width + WORD_BITS - 1) / WORD_BITS));
+    for (size_t i = 0; i < words.size(); ++i) {
+        std::uint64_t a = 0;
+        const std::int64_t begin = static_cast<std::int64_t>(i) * WORD_BITS;
+        const std::int64_t end = std::min(width, begin + WORD_BITS);
+        for (std::int64_t x = begin; x < end; ++x) {
+            a |= static_cast<std::uint64_t>(view.at(x, y).isAlive()) << (x % WORD_BITS);
+        }
+        words[i] = a;
+    }
+    return words.data();
+}
+
+bool RLEGridWriter::write(const std::string& filename, const Grid& grid) {
+    return write(filename, GridView(grid));
+}
+
+bool RLEGridWriter::write(const std::string& filename, const GridView& view) {
+    return writeRows(filename, view.getHeight(), view.getWidth(),
+                     [&view](std::int64_t y, std::vector<std::uint64_t>& words) {
+                         return packRow(view, y, words);
+                     });
+}
+
+bool RLEGridWriter::write(const std::string& filename, const BitGrid& grid) {
+    return writeRows(filename, grid.getHeight(), grid.getWidth(),
+                     [&grid](std::int64_t y, std::vector<std::uint64_t>&) { return grid.row(y); });
+}
+
+bool RLEGridWriter::write(const std::string& filename, const GridSnapshot& snapshot) {
+    return writeRows(filename, snapshot.getHeight(), snapshot.getWidth(),
+                     [&snapshot](std::int64_t y, std::vector<std::uint64_t>&) { return snapshot.aliveRow(y); });
+}
+
+std::string RLEGridWriter::format(const GridView& view) {
+    appendHeader(view.getWidth(), view.getHeight());
+    appendRows(view.getHeight(), view.getWidth(),
+               [&view](std::int64_t y, std::vector<std::uint64_t>& words) { return packRow(view, y, words); },
+               nullptr);
+    return std::string(output.text.data(), output.used);
+}
@@ -0,0 +1,167 @@
+#ifndef RLEGRIDWRITER_HPP
+#define RLEGRIDWRITER_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Déclarations anticipées
+class Grid;
+class GridView;
+class BitGrid;
+class GridSnapshot;
+
+/**
+ * @class RLEGridWriter
+ * @brief Écriture en flux des fichiers RLE depuis les lignes de bits
+ *
+ * Les plages sont trouvées mot par mot (bits de poids faible) : une zone
+ * vide de 64 cellules ne coûte qu'une comparaison. Les fins de ligne
+ * consécutives sont regroupées ("3$"), les cellules mortes en fin de ligne
+ * et les lignes vides finales omises, et les lignes du fichier coupées à
+ * LINE_LENGTH caractères.
+ *
+ * La grille est découpée en bandes d'environ BAND_CELLS cellules, encodées
+ * chacune dans son propre tampon, en parallèle par lots de BATCH_BANDS.
+ * Une bande ne dit pas combien de lignes vides la précèdent : ses fins de
+ * ligne initiales et finales sont mises de côté, puis additionnées à la
+ * jonction avec les bandes voisines pour former un seul jeton "n$". Le
+ * découpage ne dépend que des dimensions : le fichier est le même quel que
+ * soit le nombre de cœurs, et la mémoire bornée par la taille d'un lot.
+ */
+class RLEGridWriter {
+public:
+    static const std::size_t FLUSH_BYTES = 1024 * 1024;
+    static const std::size_t LINE_LENGTH = 70;
+    static const std::int64_t BAND_CELLS = 1 << 20;
+    static const std::int64_t BATCH_BANDS = 64;
+
+    /**
+     * @brief Constructeur (encodage parallèle si la machine a plusieurs cœurs)
+     */
+    RLEGridWriter();
+
+    /**
+     * @brief Active ou désactive l'encodage parallèle des bandes
+     * @param parallel true pour encoder chaque lot de bandes en parallèle
+     */
+    void setParallelMode(bool parallel);
+
+    /**
+     * @brief Écrit une grille complète
+     * @param filename Fichier de sortie
+     * @param grid Grille à écrire
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const Grid& grid);
+
+    /**
+     * @brief Écrit une vue (région ou grille entière)
+     * @param filename Fichier de sortie
+     * @param view Vue à écrire
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const GridView& view);
+
+    /**
+     * @brief Écrit une grille compacte directement depuis ses lignes de bits
+     * @param filename Fichier de sortie
+     * @param grid Grille à écrire
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const BitGrid& grid);
+
+    /**
+     * @brief Écrit une génération capturée
+     * @param filename Fichier de sortie
+     * @param snapshot Génération à écrire
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const GridSnapshot& snapshot);
+
+    /**
+     * @brief Formate une vue en mémoire, sans l'écrire
+     * @param view Vue à formater
+     * @return Texte du fichier
+     */
+    std::string format(const GridView& view);
+
+private:
+    /**
+     * @brief Texte en cours d'encodage (une bande, ou le fichier lui-même)
+     */
+    struct Band {
+        std::vector<char> text;             // Tampon réutilisé
+        std::size_t used;                   // Octets valides du tampon
+        std::size_t lineLength;             // Caractères de la ligne en cours
+        std::size_t firstLineLength;        // Caractères avant le premier saut de ligne
+        std::int64_t pendingRows;           // Fins de ligne pas encore écrites
+        std::int64_t leadingRows;           // Fins de ligne avant la première cellule (-1 : bande vide)
+        std::vector<std::uint64_t> words;   // Ligne en cours (Grid, GridView)
+
+        Band();
+    };
+
+    Band output;                // Fichier : en-tête, jonctions, bandes recopiées
+    std::vector<Band> bands;    // Lot en cours
+    bool parallelMode;
+
+    /**
+     * @brief Écrit "#C ..." et "x = largeur, y = hauteur" dans le tampon de sortie
+     */
+    void appendHeader(std::int64_t width, std::int64_t height);
+
+    /**
+     * @brief Ajoute un jeton ("12o", "b", "3$"...), précédé d'un saut de ligne au besoin
+     */
+    static void appendToken(Band& band, std::int64_t count, char tag);
+
+    /**
+     * @brief Encode une ligne de cellules dans une bande
+     * @param alive Mots des cellules vivantes
+     * @param width Nombre de cellules de la ligne
+     */
+    static void appendRow(Band& band, const std::uint64_t* alive, std::int64_t width);
+
+    /**
+     * @brief Ajoute une bande encodée au fichier, fins de ligne de la jonction comprises
+     */
+    void join(const Band& band);
+
+    /**
+     * @brief Encode toutes les lignes par bandes et les ajoute au fichier
+     * @param height Nombre de lignes
+     * @param width Cellules par ligne
+     * @param aliveRow Mots des cellules vivantes de la ligne y (aliveRow(y, tampon))
+     * @param file Fichier de sortie (nullptr : tout garder en mémoire)
+     * @return false si une écriture a échoué
+     */
+    template <class AliveRow>
+    bool appendRows(std::int64_t height, std::int64_t width, AliveRow aliveRow, std::ofstream* file);
+
+    /**
+     * @brief Écrit des lignes déjà regroupées en mots de 64 cellules
+     * @return true si l'écriture a réussi
+     */
+    template <class AliveRow>
+    bool writeRows(const std::string& filename, std::int64_t height, std::int64_t width, AliveRow aliveRow);
+
+    /**
+     * @brief Regroupe une ligne de vue en mots de 64 cellules, comme BitGrid
+     */
+    static const std::uint64_t* packRow(const GridView& view, std::int64_t y, std::vector<std::uint64_t>& words);
+
+    /**
+     * @brief Écrit le tampon de sortie dans le fichier et le vide
+     * @return false si l'écriture a échoué
+     */
+    bool flush(std::ofstream& file);
+
+    /**
+     * @brief Ouvre le fichier de sortie (message d'erreur en cas d'échec)
+     */
+    static bool open(std::ofstream& file, const std::string& filename);
+};
+
+#endif // RLEGRIDWRITER_HPP
@@ -1,5 +1,6 @@
 #include "Renderer.hpp"
 #include "Grid.hpp"
+#include "BitGrid.hpp"
 #include "Cell.hpp"
 #include <iostream>
 #include <fstream>
@@ -45,8 +46,8 @@ void ConsoleRenderer::render(const Grid& grid) {
     std::cout << "\033[2J\033[H";
 
     // Afficher la grille
-    for (int y = 0; y < grid.getHeight(); ++y) {
-        for (int x = 0; x < grid.getWidth(); ++x) {
+    for (std::int64_t y = 0; y < grid.getHeight(); ++y) {
+        for (std::int64_t x = 0; x < grid.getWidth(); ++x) {
             const Cell& cell = grid.getCell(x, y);
             if (cell.isObstacle()) {
                 std::cout << (cell.isAlive() ? '#' : 'X');
@@ -72,7 +73,7 @@ void ConsoleRenderer::showMessage(const std::string& message) {
     std::cout << "[INFO] " << message << std::endl;
 }
 
-void ConsoleRenderer::showStats(int generation, int livingCells, bool isPaused) {
+void ConsoleRenderer::showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) {
     std::cout << "Génération: " << generation 
               << " | Cellules vivantes: " << livingCells
               << " | " << (isPaused ? "EN PAUSE" : "EN COURS")
@@ -96,10 +97,12 @@ bool FileRenderer::initialize() {
     mkdir(outputDirectory.c_str(), 0755);
     active = true;
     generationCount = 0;
+    writer.start();
     return true;
 }
 
 void FileRenderer::shutdown() {
+    writer.close();
     active = false;
 }
 
@@ -111,34 +114,18 @@ void FileRenderer::render(const Grid& grid) {
     filename << outputDirectory << "/generation_" 
              << std::setfill('0') << std::setw(6) << generationCount << ".txt";
 
-    // Sauvegarder la grille
-    std::ofstream file(filename.str());
-    if (!file.is_open()) {
-        std::cerr << "Erreur : Impossible de créer le fichier " << filename.str() << std::endl;
-        return;
-    }
+    // Capturer la grille ; le format de l'énoncé est écrit en arrière-plan
+    writer.submit(filename.str(), grid);
+    generationCount++;
+}
 
-    // Format de l'énoncé : "lignes colonnes" (hauteur largeur)
-    file << grid.getHeight() << " " << grid.getWidth() << std::endl;
-    
-    for (int y = 0; y < grid.getHeight(); ++y) {
-        for (int x = 0; x < grid.getWidth(); ++x) {
-            const Cell& cell = grid.getCell(x, y);
-            int value = 0;
-            if (cell.isObstacle()) {
-                value = cell.isAlive() ? 3 : 2;
-            } else {
-                value = cell.isAlive() ? 1 : 0;
-            }
-            file << value;
-            if (x < grid.getWidth() - 1) {
-                file << " ";
-            }
-        }
-        file << std::endl;
-    }
+void FileRenderer::renderGeneration(const BitGrid& grid) {
+    if (!active) return;
 
-    file.close();
+    std::ostringstream filename;
+    filename << outputDirectory << "/generation_" 
+             << std::setfill('0') << std::setw(6) << grid.getGeneration() << ".txt";
+    writer.submit(filename.str(), grid);
     generationCount++;
 }
 
@@ -154,7 +141,7 @@ void FileRenderer::showMessage(const std::string& message) {
     std::cout << "[FileRenderer] " << message << std::endl;
 }
 
-void FileRenderer::showStats(int generation, int livingCells, bool isPaused) {
+void FileRenderer::showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) {
     (void)generation;
     (void)livingCells;
     (void)isPaused;
@@ -172,6 +159,66 @@ void FileRenderer::resetGenerationCount() {
     generationCount = 0;
 }
 
+// ============================================================
+// Implémentation de ArchiveRenderer
+// ============================================================
+
+ArchiveRenderer::ArchiveRenderer(const std::string& filename)
+    : archiveFilename(filename), active(false) {
+}
+
+bool ArchiveRenderer::initialize() {
+    active = writer.open(archiveFilename);
+    return active;
+}
+
+void ArchiveRenderer::shutdown() {
+    if (active) {
+        writer.close();
+    }
+    active = false;
+}
+
+void ArchiveRenderer::render(const Grid& grid) {
+    if (!active) return;
+    if (!writer.append(grid)) {
+        active = false;
+    }
+}
+
+void ArchiveRenderer::renderGeneration(const BitGrid& grid) {
+    if (!active) return;
+    if (!writer.append(grid, grid.getGeneration())) {
+        active = false;
+    }
+}
+
+void ArchiveRenderer::update(float deltaTime) {
+    (void)deltaTime;
+}
+
+bool ArchiveRenderer::isActive() const {
+    return active;
+}
+
+void ArchiveRenderer::showMessage(const std::string& message) {
+    std::cout << "[ArchiveRenderer] " << message << std::endl;
+}
+
+void ArchiveRenderer::showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) {
+    (void)generation;
+    (void)livingCells;
+    (void)isPaused;
+}
+
+std::int64_t ArchiveRenderer::getFrameCount() const {
+    return writer.getFrameCount();
+}
+
+std::uint64_t ArchiveRenderer::getBytesWritten() const {
+    return writer.getBytesWritten();
+}
+
 // ============================================================
 // Implémentation de NullRenderer
 // ============================================================
@@ -242,7 +289,7 @@ void CompositeRenderer::showMessage(const std::string& message) {
     }
 }
 
-void CompositeRenderer::showStats(int generation, int livingCells, bool isPaused) {
+void CompositeRenderer::showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) {
     for (auto& renderer : renderers) {
         renderer->showStats(generation, livingCells, isPaused);
     }
@@ -4,9 +4,13 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cstdint>
+#include "AsyncGridWriter.hpp"
+#include "GenerationArchive.hpp"
 
 // Déclarations anticipées
 class Grid;
+class BitGrid;
 class GameOfLife;
 
 /**
@@ -65,7 +69,7 @@ public:
      * @param livingCells Nombre de cellules vivantes
      * @param isPaused État de pause
      */
-    virtual void showStats(int generation, int livingCells, bool isPaused) = 0;
+    virtual void showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) = 0;
 };
 
 /**
@@ -92,7 +96,7 @@ public:
     void update(float deltaTime) override;
     bool isActive() const override;
     void showMessage(const std::string& message) override;
-    void showStats(int generation, int livingCells, bool isPaused) override;
+    void showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) override;
 
     /**
      * @brief Active ou désactive le mode verbose
@@ -105,13 +109,16 @@ public:
  * @class FileRenderer
  * @brief Renderer pour la sauvegarde dans des fichiers
  * 
- * Sauvegarde chaque génération dans un fichier séparé.
+ * Sauvegarde chaque génération dans un fichier séparé. Les générations sont
+ * écrites par un thread d'arrière-plan (AsyncGridWriter) entre initialize()
+ * et shutdown(), qui attend la fin des écritures.
  */
 class FileRenderer : public IRenderer {
 private:
     std::string outputDirectory;
-    int generationCount;
+    std::int64_t generationCount;
     bool active;
+    AsyncGridWriter writer;  // Écriture en arrière-plan, file bornée
 
 public:
     /**
@@ -126,7 +133,17 @@ public:
     void update(float deltaTime) override;
     bool isActive() const override;
     void showMessage(const std::string& message) override;
-    void showStats(int generation, int livingCells, bool isPaused) override;
+    void showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) override;
+
+    /**
+     * @brief Sauvegarde une génération de grille compacte sous son numéro
+     *
+     * Le fichier est nommé d'après grid.getGeneration() : utilisé quand
+     * toutes les générations ne sont pas écrites (OutputPolicy).
+     *
+     * @param grid Grille à sauvegarder
+     */
+    void renderGeneration(const BitGrid& grid);
 
     /**
      * @brief Obtient le répertoire de sortie
@@ -146,6 +163,53 @@ public:
     void resetGenerationCount();
 };
 
+/**
+ * @class ArchiveRenderer
+ * @brief Renderer qui ajoute chaque génération à une archive .gola
+ * 
+ * Remplace les fichiers séparés de FileRenderer par un seul fichier
+ * (GenerationArchive) ; l'index est écrit par shutdown().
+ */
+class ArchiveRenderer : public IRenderer {
+private:
+    std::string archiveFilename;
+    bool active;
+    GenerationArchiveWriter writer;
+
+public:
+    /**
+     * @brief Constructeur
+     * @param filename Fichier d'archive à créer
+     */
+    explicit ArchiveRenderer(const std::string& filename);
+
+    bool initialize() override;
+    void shutdown() override;
+    void render(const Grid& grid) override;
+    void update(float deltaTime) override;
+    bool isActive() const override;
+    void showMessage(const std::string& message) override;
+    void showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) override;
+
+    /**
+     * @brief Archive une génération de grille compacte sous son numéro
+     * @param grid Grille à archiver (numéro : grid.getGeneration())
+     */
+    void renderGeneration(const BitGrid& grid);
+
+    /**
+     * @brief Obtient le nombre de générations archivées
+     * @return Nombre de générations
+     */
+    std::int64_t getFrameCount() const;
+
+    /**
+     * @brief Obtient la taille de l'archive
+     * @return Octets écrits
+     */
+    std::uint64_t getBytesWritten() const;
+};
+
 /**
  * @class NullRenderer
  * @brief Renderer qui ne fait rien (Pattern Null Object)
@@ -160,7 +224,7 @@ public:
     void update(float /*deltaTime*/) override {}
     bool isActive() const override { return true; }
     void showMessage(const std::string& /*message*/) override {}
-    void showStats(int /*generation*/, int /*livingCells*/, bool /*isPaused*/) override {}
+    void showStats(std::int64_t /*generation*/, std::int64_t /*livingCells*/, bool /*isPaused*/) override {}
 };
 
 /**
@@ -197,7 +261,7 @@ public:
     void update(float deltaTime) override;
     bool isActive() const override;
     void showMessage(const std::string& message) override;
-    void showStats(int generation, int livingCells, bool isPaused) override;
+    void showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) override;
 };
 
 #endif // RENDERER_HPP
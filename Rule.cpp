@@ -1,6 +1,33 @@
 #include "Rule.hpp"
 #include "CellState.hpp"
 #include <algorithm>
+#include <cctype>
+
+// ============================================================
+// Implémentation de Rule (masques pour les moteurs bit à bit)
+// ============================================================
+
+std::uint16_t Rule::getBirthMask() const {
+    DeadCellState dead;
+    std::uint16_t mask = 0;
+    for (int n = 0; n <= 8; ++n) {
+        if (computeNextState(dead, n)->isAlive()) {
+            mask |= static_cast<std::uint16_t>(1u << n);
+        }
+    }
+    return mask;
+}
+
+std::uint16_t Rule::getSurvivalMask() const {
+    AliveCellState alive;
+    std::uint16_t mask = 0;
+    for (int n = 0; n <= 8; ++n) {
+        if (computeNextState(alive, n)->isAlive()) {
+            mask |= static_cast<std::uint16_t>(1u << n);
+        }
+    }
+    return mask;
+}
 
 // ============================================================
 // Implémentation de ClassicRule
@@ -219,24 +246,98 @@ std::unique_ptr<Rule> RuleFactory::create(RuleType type) {
     }
 }
 
+namespace {
+
+/**
+ * @brief Orthographes acceptées pour une règle prédéfinie (la première est le nom court)
+ */
+struct RuleName {
+    const char* spellings[3];
+    RuleFactory::RuleType type;
+};
+
+// Dans l'ordre de RuleFactory::getAvailableRules
+const RuleName RULE_NAMES[] = {
+    {{"classic", "Classic", "CLASSIC"}, RuleFactory::RuleType::CLASSIC},
+    {{"highlife", "HighLife", "HIGHLIFE"}, RuleFactory::RuleType::HIGHLIFE},
+    {{"dayandnight", "DayAndNight", "DAY_AND_NIGHT"}, RuleFactory::RuleType::DAY_AND_NIGHT},
+    {{"seeds", "Seeds", "SEEDS"}, RuleFactory::RuleType::SEEDS},
+    {{"maze", "Maze", "MAZE"}, RuleFactory::RuleType::MAZE}
+};
+
+} // namespace
+
 std::unique_ptr<Rule> RuleFactory::createByName(const std::string& name) {
-    if (name == "classic" || name == "Classic" || name == "CLASSIC") {
-        return std::make_unique<ClassicRule>();
+    for (const RuleName& rule : RULE_NAMES) {
+        for (const char* spelling : rule.spellings) {
+            if (name == spelling) {
+                return create(rule.type);
+            }
+        }
     }
-    if (name == "highlife" || name == "HighLife" || name == "HIGHLIFE") {
-        return std::make_unique<HighLifeRule>();
+    // Par défaut, retourner les règles classiques
+    return std::make_unique<ClassicRule>();
+}
+
+std::vector<std::string> RuleFactory::getRuleNames() {
+    std::vector<std::string> names;
+    for (const RuleName& rule : RULE_NAMES) {
+        names.push_back(rule.spellings[0]);
     }
-    if (name == "dayandnight" || name == "DayAndNight" || name == "DAY_AND_NIGHT") {
-        return std::make_unique<DayAndNightRule>();
+    return names;
+}
+
+std::unique_ptr<Rule> RuleFactory::createFromString(const std::string& notation) {
+    // "B<chiffres>/S<chiffres>", chaque chiffre de 0 à 8 au plus une fois
+    std::vector<int> conditions[2];
+    const char letters[2] = {'B', 'S'};
+    size_t pos = 0;
+    for (int part = 0; part < 2; ++part) {
+        if (part == 1) {
+            if (pos >= notation.size() || notation[pos] != '/') return nullptr;
+            ++pos;
+        }
+        if (pos >= notation.size() || std::toupper(static_cast<unsigned char>(notation[pos])) != letters[part]) {
+            return nullptr;
+        }
+        ++pos;
+        while (pos < notation.size() && notation[pos] >= '0' && notation[pos] <= '8') {
+            int count = notation[pos++] - '0';
+            if (CustomRule::contains(count, conditions[part])) return nullptr;
+            conditions[part].push_back(count);
+        }
     }
-    if (name == "seeds" || name == "Seeds" || name == "SEEDS") {
-        return std::make_unique<SeedsRule>();
+    if (pos != notation.size()) return nullptr;
+
+    std::unique_ptr<Rule> custom = std::make_unique<CustomRule>(
+        conditions[0], conditions[1], notation, "Règle " + notation);
+    for (RuleType type : {RuleType::CLASSIC, RuleType::HIGHLIFE, RuleType::DAY_AND_NIGHT,
+                          RuleType::SEEDS, RuleType::MAZE}) {
+        std::unique_ptr<Rule> predefined = create(type);
+        if (predefined->getBirthMask() == custom->getBirthMask() &&
+            predefined->getSurvivalMask() == custom->getSurvivalMask()) {
+            return predefined;
+        }
     }
-    if (name == "maze" || name == "Maze" || name == "MAZE") {
-        return std::make_unique<MazeRule>();
+    return custom;
+}
+
+std::string RuleFactory::toNotation(const Rule& rule) {
+    return toNotation(rule.getBirthMask(), rule.getSurvivalMask());
+}
+
+std::string RuleFactory::toNotation(std::uint16_t birthMask, std::uint16_t survivalMask) {
+    const std::uint16_t masks[2] = {birthMask, survivalMask};
+    std::string notation;
+    for (int part = 0; part < 2; ++part) {
+        notation += part == 0 ? "B" : "/S";
+        for (int count = 0; count <= 8; ++count) {
+            if (masks[part] & (1u << count)) {
+                notation += static_cast<char>('0' + count);
+            }
+        }
     }
-    // Par défaut, retourner les règles classiques
-    return std::make_unique<ClassicRule>();
+    return notation;
 }
 
 std::vector<std::pair<std::string, std::string>> RuleFactory::getAvailableRules() {
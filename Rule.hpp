@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <cstdint>
 
 // Déclaration anticipée
 class CellState;
@@ -50,6 +51,22 @@ public:
      * @return Pointeur unique vers une copie de la règle
      */
     virtual std::unique_ptr<Rule> clone() const = 0;
+
+    /**
+     * @brief Obtient le masque de naissance de la règle
+     *
+     * Le masque est déduit de computeNextState() : les moteurs bit à bit
+     * (BitGrid) appliquent ainsi n'importe quelle règle, y compris personnalisée.
+     *
+     * @return Bit n à 1 si une cellule morte avec n voisins devient vivante
+     */
+    std::uint16_t getBirthMask() const;
+
+    /**
+     * @brief Obtient le masque de survie de la règle
+     * @return Bit n à 1 si une cellule vivante avec n voisins reste vivante
+     */
+    std::uint16_t getSurvivalMask() const;
 };
 
 /**
@@ -256,11 +273,43 @@ public:
      */
     static std::unique_ptr<Rule> createByName(const std::string& name);
 
+    /**
+     * @brief Crée une règle depuis sa notation B/S (ex: "B36/S23")
+     *
+     * Une notation identique à celle d'une règle prédéfinie renvoie cette
+     * règle ; sinon une CustomRule nommée par sa notation.
+     *
+     * @param notation Notation B/S (B et S insensibles à la casse)
+     * @return Règle créée, nullptr si la notation est invalide
+     */
+    static std::unique_ptr<Rule> createFromString(const std::string& notation);
+
+    /**
+     * @brief Obtient la notation B/S d'une règle (déduite de ses masques)
+     * @param rule Règle
+     * @return Notation, ex: "B3/S23"
+     */
+    static std::string toNotation(const Rule& rule);
+
+    /**
+     * @brief Obtient la notation B/S de masques naissance/survie
+     * @param birthMask Bit n : naissance avec n voisins
+     * @param survivalMask Bit n : survie avec n voisins
+     * @return Notation, ex: "B3/S23"
+     */
+    static std::string toNotation(std::uint16_t birthMask, std::uint16_t survivalMask);
+
     /**
      * @brief Obtient la liste des règles disponibles
      * @return Vecteur de paires (nom, description)
      */
     static std::vector<std::pair<std::string, std::string>> getAvailableRules();
+
+    /**
+     * @brief Obtient les noms courts acceptés par createByName
+     * @return Noms ("classic", "highlife"...), dans l'ordre de getAvailableRules
+     */
+    static std::vector<std::string> getRuleNames();
 };
 
 #endif // RULE_HPP
@@ -8,7 +8,8 @@ SFMLRenderer::SFMLRenderer(int width, int height, float cellSize, const std::str
       aliveColor(sf::Color::White), deadColor(sf::Color(30, 30, 30)),
       obstacleAliveColor(sf::Color(255, 100, 100)), obstacleDeadColor(sf::Color(100, 50, 50)),
       gridColor(sf::Color(60, 60, 60)), backgroundColor(sf::Color::Black),
-      showGrid(true), displayStats(true), messageTimer(0.0f),
+      heatColor(sf::Color(255, 90, 0)),
+      showGrid(true), displayStats(true), heatMap(nullptr), messageTimer(0.0f),
       offsetX(0.0f), offsetY(0.0f), gridWidth(0), gridHeight(0) {
 }
 
@@ -73,6 +74,11 @@ void SFMLRenderer::render(const Grid& grid) {
         }
     }
     
+    // Superposer la carte d'activité si demandée
+    if (heatMap && heatMap->getWidth() == gridWidth && heatMap->getHeight() == gridHeight) {
+        drawHeatMap();
+    }
+    
     // Dessiner la grille si activée
     if (showGrid && cellSize >= 3.0f) {
         drawGridLines();
@@ -98,7 +104,7 @@ void SFMLRenderer::showMessage(const std::string& message) {
     std::cout << "[INFO] " << message << std::endl;
 }
 
-void SFMLRenderer::showStats(int generation, int livingCells, bool isPaused) {
+void SFMLRenderer::showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) {
     if (!fontLoaded) return;
     
     std::string stats = "Generation: " + std::to_string(generation) +
@@ -219,6 +225,10 @@ void SFMLRenderer::setShowGrid(bool show) {
     showGrid = show;
 }
 
+void SFMLRenderer::setHeatMap(const HeatMap* map) {
+    heatMap = map;
+}
+
 void SFMLRenderer::setShowStatsDisplay(bool show) {
     displayStats = show;
 }
@@ -326,6 +336,27 @@ void SFMLRenderer::drawCell(int x, int y, const Cell& cell) {
     window->draw(rect);
 }
 
+void SFMLRenderer::drawHeatMap() {
+    if (!window) return;
+    
+    // Opacité proportionnelle à l'activité (échelle logarithmique)
+    const std::uint16_t max = heatMap->getMax();
+    if (max == 0) return;
+    
+    sf::RectangleShape rect(sf::Vector2f(cellSize - 1.0f, cellSize - 1.0f));
+    sf::Color color = heatColor;
+    for (int y = 0; y < gridHeight; ++y) {
+        for (int x = 0; x < gridWidth; ++x) {
+            std::uint8_t level = HeatMap::level(heatMap->get(x, y), max);
+            if (level == 0) continue;
+            color.a = static_cast<sf::Uint8>(level * 3 / 4);
+            rect.setPosition(offsetX + x * cellSize, offsetY + y * cellSize);
+            rect.setFillColor(color);
+            window->draw(rect);
+        }
+    }
+}
+
 void SFMLRenderer::drawGridLines() {
     if (!window) return;
     
@@ -7,6 +7,7 @@
 #include <functional>
 #include "Renderer.hpp"
 #include "Grid.hpp"
+#include "HeatMap.hpp"
 
 /**
  * @class SFMLRenderer
@@ -46,10 +47,12 @@ private:
     sf::Color obstacleDeadColor;
     sf::Color gridColor;
     sf::Color backgroundColor;
+    sf::Color heatColor;
     
     // Affichage
     bool showGrid;
     bool displayStats;
+    const HeatMap* heatMap;  // Carte d'activité superposée (nullptr = aucune)
     
     // Textes d'affichage
     sf::Text statsText;
@@ -102,7 +105,7 @@ public:
     void update(float deltaTime) override;
     bool isActive() const override;
     void showMessage(const std::string& message) override;
-    void showStats(int generation, int livingCells, bool isPaused) override;
+    void showStats(std::int64_t generation, std::int64_t livingCells, bool isPaused) override;
 
     // ============================================================
     // Gestion des événements
@@ -190,6 +193,16 @@ public:
      */
     void setGridColor(const sf::Color& color);
 
+    /**
+     * @brief Superpose une carte d'activité aux cellules
+     *
+     * La carte est lue à chaque rendu : elle doit rester valide tant
+     * qu'elle est affichée.
+     *
+     * @param map Carte (mêmes dimensions que la grille), nullptr pour masquer
+     */
+    void setHeatMap(const HeatMap* map);
+
     /**
      * @brief Active ou désactive l'affichage de la grille
      * @param show true pour afficher
@@ -275,6 +288,11 @@ private:
      */
     void drawCell(int x, int y, const Cell& cell);
 
+    /**
+     * @brief Dessine la carte d'activité par-dessus les cellules
+     */
+    void drawHeatMap();
+
     /**
      * @brief Dessine les lignes de la grille
      */
@@ -0,0 +1,221 @@
+#include "SoupSearch.hpp"
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include "PatternRegistry.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// ============================================================
+// Statistiques
+// ============================================================
+
+int SoupStatistics::bucketOf(std::int64_t generation) {
+    int bucket = 0;
+    for (std::uint64_t value = static_cast<std::uint64_t>(generation) + 1; value > 1; value >>= 1) {
+        ++bucket;
+    }
+    return std::min(bucket, HISTOGRAM_BUCKETS - 1);
+}
+
+void SoupStatistics::add(std::uint64_t seed, const LifespanResult& result) {
+    ++soups;
+    totalPopulation += result.finalPopulation;
+    if (result.settled) {
+        ++settled;
+        escaped += result.escaped ? 1 : 0;
+        totalSettleGeneration += result.settleGeneration;
+        lifespanHistogram[bucketOf(result.settleGeneration)]++;
+        if (result.settleGeneration > longestSettle) {
+            longestSettle = result.settleGeneration;
+            longestSeed = seed;
+        }
+    }
+    for (const CensusEntry& entry : result.census) {
+        CensusEntry& total = census[entry.type.code];
+        if (total.count == 0) {
+            total.type = entry.type;
+        }
+        total.count += entry.count;
+        if (SoupSearch::isRare(entry.type) && rareHits.size() < SoupSearch::MAX_RARE_HITS) {
+            rareHits.push_back({entry.type, seed});
+        }
+    }
+}
+
+void SoupStatistics::merge(const SoupStatistics& other) {
+    soups += other.soups;
+    settled += other.settled;
+    escaped += other.escaped;
+    totalSettleGeneration += other.totalSettleGeneration;
+    totalPopulation += other.totalPopulation;
+    if (other.longestSettle > longestSettle ||
+        (other.longestSettle == longestSettle && other.longestSeed < longestSeed)) {
+        longestSettle = other.longestSettle;
+        longestSeed = other.longestSeed;
+    }
+    for (int k = 0; k < HISTOGRAM_BUCKETS; ++k) {
+        lifespanHistogram[k] += other.lifespanHistogram[k];
+    }
+    for (const auto& item : other.census) {
+        CensusEntry& total = census[item.first];
+        if (total.count == 0) {
+            total.type = item.second.type;
+        }
+        total.count += item.second.count;
+    }
+    for (const RareObjectHit& hit : other.rareHits) {
+        if (rareHits.size() >= SoupSearch::MAX_RARE_HITS) break;
+        rareHits.push_back(hit);
+    }
+}
+
+// ============================================================
+// Recherche
+// ============================================================
+
+SoupSearch::SoupSearch(std::int64_t width, std::int64_t height, double density, std::int64_t maxGenerations)
+    : width(std::max<std::int64_t>(1, width)), height(std::max<std::int64_t>(1, height)),
+      density(density), meter(maxGenerations) {
+}
+
+PatternBitmap SoupSearch::makeSoup(std::uint64_t seed) const {
+    BitGrid soup(width, height);
+    soup.randomize(density, seed);
+
+    PatternBitmap pattern;
+    pattern.name = "soupe_" + std::to_string(seed);
+    pattern.width = width;
+    pattern.height = height;
+    pattern.wordsPerRow = (width + 63) / 64;
+    pattern.words.resize(static_cast<size_t>(pattern.wordsPerRow * height));
+    for (std::int64_t y = 0; y < height; ++y) {
+        std::copy(soup.row(y), soup.row(y) + pattern.wordsPerRow, pattern.words.begin() + y * pattern.wordsPerRow);
+    }
+    return pattern;
+}
+
+SoupStatistics SoupSearch::run(std::uint64_t baseSeed, std::int64_t count, std::ostream* progress) const {
+    count = std::max<std::int64_t>(0, count);
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 4;  // Valeur par défaut
+    const std::int64_t workers = std::max<std::int64_t>(1, std::min<std::int64_t>(cores, count));
+    std::vector<SoupStatistics> workerStats(static_cast<size_t>(workers));
+    std::atomic<std::int64_t> next(0);
+    std::atomic<std::int64_t> done(0);
+
+    // Affichage en direct : lit le compteur sans bloquer les threads de calcul
+    std::mutex mutex;
+    std::condition_variable finishedSignal;
+    bool finished = false;
+    const auto start = std::chrono::steady_clock::now();
+    auto report = [&]() {
+        const std::int64_t measured = done.load(std::memory_order_relaxed);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        *progress << "\r  " << measured << "/" << count << " soupes ("
+                  << std::fixed << std::setprecision(1) << (seconds > 0 ? measured / seconds : 0.0)
+                  << " soupes/s)" << std::defaultfloat << std::flush;
+    };
+    std::thread reporter;
+    if (progress) {
+        reporter = std::thread([&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!finishedSignal.wait_for(lock, std::chrono::milliseconds(500), [&] { return finished; })) {
+                report();
+            }
+        });
+    }
+
+    // Une soupe lente n'occupe qu'un thread : les autres continuent avec les graines suivantes
+    Grid::runOnWorkers(workers, [&](std::int64_t firstWorker, std::int64_t) {
+        SoupStatistics& stats = workerStats[firstWorker];
+        for (std::int64_t i = next++; i < count; i = next++) {
+            const std::uint64_t seed = baseSeed + static_cast<std::uint64_t>(i);
+            stats.add(seed, meter.measure(makeSoup(seed), false));
+            done.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    if (progress) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished = true;
+        }
+        finishedSignal.notify_one();
+        reporter.join();
+        report();
+        *progress << std::endl;
+    }
+
+    // Chaque thread a vu ses graines dans l'ordre croissant et garde ses premiers objets
+    // rares : les MAX_RARE_HITS premiers toutes graines confondues sont parmi eux
+    SoupStatistics total;
+    std::vector<RareObjectHit> hits;
+    for (const SoupStatistics& stats : workerStats) {
+        total.merge(stats);
+        hits.insert(hits.end(), stats.rareHits.begin(), stats.rareHits.end());
+    }
+    std::stable_sort(hits.begin(), hits.end(), [](const RareObjectHit& a, const RareObjectHit& b) {
+        return a.seed < b.seed;
+    });
+    if (hits.size() > MAX_RARE_HITS) {
+        hits.resize(MAX_RARE_HITS);
+    }
+    total.rareHits = hits;
+    return total;
+}
+
+bool SoupSearch::isRare(const ObjectClass& type) {
+    return type.name.empty() && type.kind != ObjectKind::OTHER;
+}
+
+void SoupSearch::print(std::ostream& out, const SoupStatistics& stats, double seconds) {
+    out << "Soupes : " << stats.soups << " (" << std::fixed << std::setprecision(1)
+        << (seconds > 0 ? stats.soups / seconds : 0.0) << " soupes/s), stabilisées : " << stats.settled;
+    if (stats.escaped > 0) {
+        out << " (dont " << stats.escaped << " avec vaisseaux en vol)";
+    }
+    out << "\n";
+    if (stats.settled > 0) {
+        out << "Durée de vie moyenne : "
+            << static_cast<double>(stats.totalSettleGeneration) / stats.settled << " générations\n";
+        out << "Plus longue : " << stats.longestSettle << " générations (graine " << stats.longestSeed << ")\n";
+    }
+    if (stats.soups > 0) {
+        out << "Population finale moyenne : " << static_cast<double>(stats.totalPopulation) / stats.soups << "\n";
+    }
+    out << std::defaultfloat;
+
+    out << "Durées de vie :\n";
+    for (int k = 0; k < SoupStatistics::HISTOGRAM_BUCKETS; ++k) {
+        if (stats.lifespanHistogram[k] == 0) continue;
+        std::int64_t low = (std::int64_t(1) << k) - 1;
+        std::int64_t high = (std::int64_t(1) << (k + 1)) - 2;
+        out << "  " << std::setw(7) << low << " - " << std::setw(7) << high
+            << " : " << stats.lifespanHistogram[k] << "\n";
+    }
+
+    std::vector<CensusEntry> census;
+    census.reserve(stats.census.size());
+    for (const auto& item : stats.census) {
+        census.push_back(item.second);
+    }
+    std::stable_sort(census.begin(), census.end(), [](const CensusEntry& a, const CensusEntry& b) {
+        return a.count > b.count;
+    });
+    ObjectCensus::print(out, census);
+
+    if (!stats.rareHits.empty()) {
+        out << "Objets rares :\n";
+        for (const RareObjectHit& hit : stats.rareHits) {
+            out << "  " << std::left << std::setw(24) << hit.type.code << std::right
+                << ObjectCensus::kindName(hit.type.kind) << ", graine " << hit.seed << "\n";
+        }
+    }
+}
@@ -0,0 +1,135 @@
+#ifndef SOUPSEARCH_HPP
+#define SOUPSEARCH_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+#include "LifespanMeter.hpp"
+
+/**
+ * @brief Objet rare trouvé dans une soupe
+ */
+struct RareObjectHit {
+    ObjectClass type;      // Classification de l'objet
+    std::uint64_t seed;    // Graine de la soupe (pour la rejouer)
+};
+
+/**
+ * @brief Statistiques agrégées d'une recherche de soupes
+ *
+ * Chaque thread remplit ses propres statistiques, fusionnées à la fin avec
+ * merge() : aucun état n'est partagé pendant la recherche.
+ */
+struct SoupStatistics {
+    /**
+     * @brief Nombre de tranches de l'histogramme des durées de vie
+     */
+    static const int HISTOGRAM_BUCKETS = 24;
+
+    std::int64_t soups = 0;              // Soupes mesurées
+    std::int64_t settled = 0;            // Soupes stabilisées avant la limite
+    std::int64_t escaped = 0;            // Dont celles où ne restent que des vaisseaux en vol
+    std::int64_t totalSettleGeneration = 0;  // Somme des générations de stabilisation
+    std::int64_t totalPopulation = 0;    // Somme des populations finales
+    std::int64_t longestSettle = -1;     // Plus longue durée de vie
+    std::uint64_t longestSeed = 0;       // Graine de la soupe la plus longue
+    std::vector<std::int64_t> lifespanHistogram = std::vector<std::int64_t>(HISTOGRAM_BUCKETS, 0);
+    std::map<std::string, CensusEntry> census;  // Objets par code
+    std::vector<RareObjectHit> rareHits; // Objets rares, dans l'ordre des graines
+
+    /**
+     * @brief Ajoute le résultat d'une soupe
+     * @param seed Graine de la soupe
+     * @param result Mesure de la soupe
+     */
+    void add(std::uint64_t seed, const LifespanResult& result);
+
+    /**
+     * @brief Fusionne les statistiques d'un autre thread
+     * @param other Statistiques à ajouter
+     */
+    void merge(const SoupStatistics& other);
+
+    /**
+     * @brief Tranche de l'histogramme d'une durée de vie
+     * @param generation Génération de stabilisation
+     * @return k tel que 2^k <= generation + 1 < 2^(k+1)
+     */
+    static int bucketOf(std::int64_t generation);
+};
+
+/**
+ * @class SoupSearch
+ * @brief Recherche de soupes aléatoires répartie sur tous les cœurs
+ *
+ * La soupe i est une grille <largeur>x<hauteur> tirée avec la graine
+ * baseSeed + i (même tirage que BitGrid::randomize), mesurée jusqu'à sa
+ * stabilisation par LifespanMeter. Les durées de vie varient beaucoup d'une
+ * soupe à l'autre : chaque thread prend la graine suivante à un compteur
+ * partagé et garde ses propres statistiques. Les objets rares sont remis
+ * dans l'ordre des graines à la fusion : le rapport ne dépend pas du
+ * nombre de cœurs.
+ */
+class SoupSearch {
+public:
+    /**
+     * @brief Nombre maximal de générations par soupe par défaut
+     */
+    static const std::int64_t DEFAULT_MAX_GENERATIONS = 20000;
+
+    /**
+     * @brief Nombre maximal d'objets rares conservés dans le rapport
+     */
+    static const size_t MAX_RARE_HITS = 100;
+
+    /**
+     * @brief Constructeur
+     * @param width Largeur des soupes
+     * @param height Hauteur des soupes
+     * @param density Densité des cellules vivantes (0.0 à 1.0)
+     * @param maxGenerations Limite de générations par soupe
+     */
+    SoupSearch(std::int64_t width, std::int64_t height, double density,
+               std::int64_t maxGenerations = DEFAULT_MAX_GENERATIONS);
+
+    /**
+     * @brief Tire la soupe d'une graine
+     * @param seed Graine
+     * @return Motif de la soupe
+     */
+    PatternBitmap makeSoup(std::uint64_t seed) const;
+
+    /**
+     * @brief Mesure count soupes à partir de baseSeed
+     * @param baseSeed Graine de la première soupe
+     * @param count Nombre de soupes
+     * @param progress Flux de l'avancement en direct (nullptr pour aucun)
+     * @return Statistiques agrégées
+     */
+    SoupStatistics run(std::uint64_t baseSeed, std::int64_t count, std::ostream* progress = nullptr) const;
+
+    /**
+     * @brief Vérifie si un objet est rare (ni courant, ni inclassable)
+     * @param type Classification de l'objet
+     * @return true si l'objet n'a pas de nom connu
+     */
+    static bool isRare(const ObjectClass& type);
+
+    /**
+     * @brief Affiche le rapport d'une recherche
+     * @param out Flux de sortie
+     * @param stats Statistiques agrégées
+     * @param seconds Durée de la recherche
+     */
+    static void print(std::ostream& out, const SoupStatistics& stats, double seconds);
+
+private:
+    std::int64_t width;
+    std::int64_t height;
+    double density;
+    LifespanMeter meter;
+};
+
+#endif // SOUPSEARCH_HPP
@@ -0,0 +1,77 @@
+#include "StabilizationDetector.hpp"
+#include <algorithm>
+
+StabilizationDetector::StabilizationDetector(int maxPeriod, std::int64_t window)
+    : maxPeriod(std::max(1, maxPeriod)), window(std::max<std::int64_t>(1, window)),
+      hashes(static_cast<size_t>(std::max(1, maxPeriod) + 1), 0), observed(0), period(0),
+      streak(0), streakStart(0), settledGeneration(-1) {
+}
+
+void StabilizationDetector::setWindow(std::int64_t newWindow) {
+    window = std::max<std::int64_t>(1, newWindow);
+}
+
+std::int64_t StabilizationDetector::getWindow() const {
+    return window;
+}
+
+std::uint64_t StabilizationDetector::hashAt(std::int64_t age) const {
+    const std::int64_t size = static_cast<std::int64_t>(hashes.size());
+    return hashes[static_cast<size_t>((observed - 1 - age) % size)];
+}
+
+bool StabilizationDetector::observe(std::uint64_t hash, std::int64_t generation) {
+    hashes[static_cast<size_t>(observed % static_cast<std::int64_t>(hashes.size()))] = hash;
+    ++observed;
+
+    if (period > 0 && hashAt(period) == hash) {
+        ++streak;
+    } else {
+        // Plus petite période qui explique l'empreinte courante
+        period = 0;
+        streak = 0;
+        const std::int64_t limit = std::min<std::int64_t>(maxPeriod, observed - 1);
+        for (int p = 1; p <= limit; ++p) {
+            if (hashAt(p) == hash) {
+                period = p;
+                streak = 1;
+                streakStart = generation;
+                break;
+            }
+        }
+        settledGeneration = -1;
+    }
+
+    if (period > 0 && streak >= window && settledGeneration < 0) {
+        // L'état de streakStart est celui de streakStart - période : le cycle a commencé là
+        settledGeneration = streakStart - period;
+    }
+    return isSettled();
+}
+
+void StabilizationDetector::reset() {
+    observed = 0;
+    period = 0;
+    streak = 0;
+    streakStart = 0;
+    settledGeneration = -1;
+}
+
+bool StabilizationDetector::isSettled() const {
+    return settledGeneration >= 0;
+}
+
+int StabilizationDetector::getPeriod() const {
+    return period;
+}
+
+std::int64_t StabilizationDetector::getSettledGeneration() const {
+    return settledGeneration;
+}
+
+std::int64_t StabilizationDetector::getRemaining() const {
+    if (period == 0 || isSettled()) {
+        return 0;
+    }
+    return window - streak;
+}
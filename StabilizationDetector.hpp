@@ -0,0 +1,102 @@
+#ifndef STABILIZATIONDETECTOR_HPP
+#define STABILIZATIONDETECTOR_HPP
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class StabilizationDetector
+ * @brief Détecte qu'une grille est devenue stable ou périodique, en générations
+ *
+ * Reçoit l'empreinte de la grille à chaque génération et cherche la plus
+ * petite période p telle que l'empreinte courante soit celle d'il y a p
+ * générations. La stabilisation est confirmée lorsque la même période se
+ * répète pendant une fenêtre de générations (protection contre les collisions
+ * d'empreintes) ; le résultat ne dépend donc ni du temps réel ni de la vitesse
+ * d'affichage.
+ */
+class StabilizationDetector {
+public:
+    /**
+     * @brief Période maximale recherchée par défaut
+     */
+    static const int DEFAULT_MAX_PERIOD = 64;
+
+    /**
+     * @brief Fenêtre de confirmation par défaut (en générations)
+     */
+    static const std::int64_t DEFAULT_WINDOW = 100;
+
+    /**
+     * @brief Constructeur
+     * @param maxPeriod Période maximale recherchée
+     * @param window Nombre de générations pendant lesquelles la période doit se répéter
+     */
+    explicit StabilizationDetector(int maxPeriod = DEFAULT_MAX_PERIOD, std::int64_t window = DEFAULT_WINDOW);
+
+    /**
+     * @brief Définit la fenêtre de confirmation
+     * @param window Nombre de générations (au moins 1)
+     */
+    void setWindow(std::int64_t window);
+
+    /**
+     * @brief Obtient la fenêtre de confirmation
+     * @return Nombre de générations
+     */
+    std::int64_t getWindow() const;
+
+    /**
+     * @brief Enregistre l'empreinte d'une nouvelle génération
+     * @param hash Empreinte de la grille
+     * @param generation Numéro de la génération
+     * @return true si la grille est (désormais) stabilisée
+     */
+    bool observe(std::uint64_t hash, std::int64_t generation);
+
+    /**
+     * @brief Oublie les générations observées
+     */
+    void reset();
+
+    /**
+     * @brief Vérifie si la stabilisation est confirmée
+     * @return true si stable ou périodique depuis au moins la fenêtre
+     */
+    bool isSettled() const;
+
+    /**
+     * @brief Obtient la période en cours de confirmation (ou confirmée)
+     * @return Période (1 = stable), 0 si aucune répétition
+     */
+    int getPeriod() const;
+
+    /**
+     * @brief Obtient la première génération de l'état périodique
+     * @return Génération, -1 si la stabilisation n'est pas confirmée
+     */
+    std::int64_t getSettledGeneration() const;
+
+    /**
+     * @brief Obtient le nombre de générations restant avant confirmation
+     * @return Générations restantes, 0 si aucune période ou déjà confirmée
+     */
+    std::int64_t getRemaining() const;
+
+private:
+    int maxPeriod;
+    std::int64_t window;
+    std::vector<std::uint64_t> hashes;  // Tampon circulaire des dernières empreintes
+    std::int64_t observed;              // Nombre d'empreintes reçues
+    int period;                         // Période courante (0 = aucune)
+    std::int64_t streak;                // Générations consécutives confirmant la période
+    std::int64_t streakStart;           // Génération où la répétition a commencé
+    std::int64_t settledGeneration;     // -1 tant que non confirmée
+
+    /**
+     * @brief Empreinte reçue il y a age générations (0 = la dernière)
+     */
+    std::uint64_t hashAt(std::int64_t age) const;
+};
+
+#endif // STABILIZATIONDETECTOR_HPP
@@ -0,0 +1,152 @@
+#include "StatisticsSink.hpp"
+#include "FileHandler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+const char StatisticsSink::MAGIC[8] = {'G', 'O', 'L', 'S', 'T', 'A', 'T', '1'};
+
+StatisticsSink::StatisticsSink()
+    : format(Format::CSV), every(1), closing(false), failed(false) {
+}
+
+StatisticsSink::~StatisticsSink() {
+    close();
+}
+
+StatisticsSink::Format StatisticsSink::formatFor(const std::string& filename) {
+    std::string ext = DirectoryManager::getExtension(filename);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".csv" ? Format::CSV : Format::BINARY;
+}
+
+bool StatisticsSink::open(const std::string& filename, std::int64_t interval) {
+    close();
+    format = formatFor(filename);
+    every = std::max<std::int64_t>(1, interval);
+    file.open(filename, format == Format::CSV ? std::ios::out : std::ios::out | std::ios::binary);
+    if (!file) {
+        std::cerr << "Erreur : Impossible de créer le fichier " << filename << std::endl;
+        return false;
+    }
+    if (format == Format::CSV) {
+        file << "generation,population,births,deaths\n";
+    } else {
+        file.write(MAGIC, sizeof(MAGIC));
+    }
+
+    batch.clear();
+    batch.reserve(BATCH_RECORDS);
+    closing = false;
+    failed = false;
+    writer = std::thread(&StatisticsSink::writeLoop, this);
+    return true;
+}
+
+bool StatisticsSink::isOpen() const {
+    return writer.joinable();
+}
+
+bool StatisticsSink::wants(std::int64_t generation) const {
+    return generation % every == 0;
+}
+
+void StatisticsSink::record(const GenerationRecord& record) {
+    batch.push_back(record);
+    if (batch.size() >= BATCH_RECORDS) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push_back(std::move(batch));
+        }
+        ready.notify_one();
+        batch = std::vector<GenerationRecord>();
+        batch.reserve(BATCH_RECORDS);
+    }
+}
+
+bool StatisticsSink::close() {
+    if (!writer.joinable()) {
+        return !failed;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!batch.empty()) {
+            queue.push_back(std::move(batch));
+            batch = std::vector<GenerationRecord>();
+        }
+        closing = true;
+    }
+    ready.notify_one();
+    writer.join();
+    file.close();
+    if (failed) {
+        std::cerr << "Erreur : Écriture incomplète de la série de statistiques" << std::endl;
+    }
+    return !failed;
+}
+
+void StatisticsSink::writeLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        ready.wait(lock, [this] { return closing || !queue.empty(); });
+        if (queue.empty()) {
+            break;  // closing et plus rien à écrire
+        }
+        std::vector<GenerationRecord> records = std::move(queue.front());
+        queue.pop_front();
+
+        // L'écriture se fait sans verrou : la simulation continue de remplir son lot
+        lock.unlock();
+        writeBatch(records);
+        lock.lock();
+    }
+    file.flush();
+    failed = failed || !file;
+}
+
+void StatisticsSink::writeBatch(const std::vector<GenerationRecord>& records) {
+    if (format == Format::CSV) {
+        std::string text;
+        text.reserve(records.size() * 32);
+        for (const GenerationRecord& r : records) {
+            text += std::to_string(r.generation);
+            text += ',';
+            text += std::to_string(r.population);
+            text += ',';
+            text += std::to_string(r.births);
+            text += ',';
+            text += std::to_string(r.deaths);
+            text += '\n';
+        }
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    } else {
+        std::vector<std::int64_t> values;
+        values.reserve(records.size() * 4);
+        for (const GenerationRecord& r : records) {
+            values.push_back(r.generation);
+            values.push_back(r.population);
+            values.push_back(r.births);
+            values.push_back(r.deaths);
+        }
+        file.write(reinterpret_cast<const char*>(values.data()),
+                   static_cast<std::streamsize>(values.size() * sizeof(std::int64_t)));
+    }
+    if (!file) {
+        failed = true;
+    }
+}
+
+bool StatisticsSink::readBinary(const std::string& filename, std::vector<GenerationRecord>& records) {
+    std::ifstream in(filename, std::ios::binary);
+    char magic[sizeof(MAGIC)];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        std::cerr << "Erreur : " << filename << " n'est pas une série de statistiques binaire" << std::endl;
+        return false;
+    }
+    records.clear();
+    std::int64_t values[4];
+    while (in.read(reinterpret_cast<char*>(values), sizeof(values))) {
+        records.push_back({values[0], values[1], values[2], values[3]});
+    }
+    return true;
+}
@@ -0,0 +1,138 @@
+#ifndef STATISTICSSINK_HPP
+#define STATISTICSSINK_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Statistiques d'une génération
+ */
+struct GenerationRecord {
+    std::int64_t generation;   // Numéro de génération
+    std::int64_t population;   // Cellules vivantes
+    std::int64_t births;       // Cellules nées à cette génération
+    std::int64_t deaths;       // Cellules mortes à cette génération
+};
+
+/**
+ * @class StatisticsSink
+ * @brief Série temporelle population / naissances / morts, écrite en arrière-plan
+ *
+ * Les enregistrements sont accumulés par lots de BATCH_RECORDS ; chaque lot
+ * plein est confié à un thread d'écriture, si bien que la simulation ne
+ * touche jamais au disque. Le format dépend de l'extension du fichier :
+ * ".csv" pour du texte, sinon binaire (en-tête MAGIC puis quatre entiers de
+ * 64 bits par enregistrement, dans l'ordre de la machine).
+ */
+class StatisticsSink {
+public:
+    /**
+     * @brief Format du fichier
+     */
+    enum class Format {
+        CSV,
+        BINARY
+    };
+
+    /**
+     * @brief Enregistrements par lot confié au thread d'écriture
+     */
+    static const size_t BATCH_RECORDS = 4096;
+
+    /**
+     * @brief En-tête des fichiers binaires
+     */
+    static const char MAGIC[8];
+
+    /**
+     * @brief Constructeur (aucun fichier ouvert)
+     */
+    StatisticsSink();
+
+    /**
+     * @brief Destructeur : écrit les enregistrements restants
+     */
+    ~StatisticsSink();
+
+    StatisticsSink(const StatisticsSink&) = delete;
+    StatisticsSink& operator=(const StatisticsSink&) = delete;
+
+    /**
+     * @brief Ouvre le fichier et démarre le thread d'écriture
+     * @param filename Fichier de sortie (.csv ou binaire)
+     * @param every Intervalle d'enregistrement en générations
+     * @return true si le fichier a pu être créé
+     */
+    bool open(const std::string& filename, std::int64_t every = 1);
+
+    /**
+     * @brief Vérifie si un fichier est ouvert
+     * @return true si ouvert
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Indique si une génération doit être enregistrée
+     * @param generation Numéro de génération
+     * @return true si generation est un multiple de l'intervalle
+     */
+    bool wants(std::int64_t generation) const;
+
+    /**
+     * @brief Ajoute un enregistrement (sans attendre l'écriture)
+     * @param record Statistiques de la génération
+     */
+    void record(const GenerationRecord& record);
+
+    /**
+     * @brief Écrit les enregistrements restants, arrête le thread et ferme le fichier
+     * @return false si une écriture a échoué
+     */
+    bool close();
+
+    /**
+     * @brief Détermine le format d'après l'extension
+     * @param filename Nom du fichier
+     * @return CSV pour ".csv", BINARY sinon
+     */
+    static Format formatFor(const std::string& filename);
+
+    /**
+     * @brief Relit un fichier binaire
+     * @param filename Fichier à lire
+     * @param records Sortie : enregistrements
+     * @return false si le fichier est absent ou n'est pas une série binaire
+     */
+    static bool readBinary(const std::string& filename, std::vector<GenerationRecord>& records);
+
+private:
+    std::ofstream file;
+    Format format;
+    std::int64_t every;
+    std::vector<GenerationRecord> batch;               // Lot en cours (thread de simulation)
+    std::deque<std::vector<GenerationRecord>> queue;   // Lots à écrire
+    std::mutex mutex;
+    std::condition_variable ready;
+    bool closing;
+    bool failed;
+    std::thread writer;
+
+    /**
+     * @brief Boucle du thread d'écriture
+     */
+    void writeLoop();
+
+    /**
+     * @brief Écrit un lot dans le fichier
+     * @param records Enregistrements à écrire
+     */
+    void writeBatch(const std::vector<GenerationRecord>& records);
+};
+
+#endif // STATISTICSSINK_HPP
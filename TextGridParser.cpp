@@ -0,0 +1,412 @@
+#include "TextGridParser.hpp"
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include "MappedFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <thread>
+
+namespace {
+
+const std::int64_t WORD_BITS = 64;
+
+/**
+ * @brief Taille nominale d'une tranche de lecture parallèle
+ */
+const std::uint64_t CHUNK_BYTES = 1024 * 1024;
+
+inline bool isSpace(char c) {
+    return static_cast<unsigned char>(c) <= ' ';
+}
+
+inline bool isDigit(char c) {
+    return static_cast<unsigned>(c - '0') <= 9u;
+}
+
+/**
+ * @brief Lit un entier signé ([+-]chiffres), comme operator>> sur un entier
+ * @param p Position courante, avancée après le jeton
+ * @param end Fin des données
+ * @param limit Valeur absolue maximale acceptée
+ * @param value Sortie : valeur lue
+ * @return false si le jeton n'est pas un entier ou dépasse limit
+ */
+bool readInteger(const char*& p, const char* end, std::int64_t limit, std::int64_t& value) {
+    const bool negative = *p == '-';
+    if (*p == '-' || *p == '+') {
+        ++p;
+    }
+    if (p == end || !isDigit(*p)) {
+        return false;
+    }
+    std::int64_t v = *p++ - '0';
+    while (p < end && isDigit(*p)) {
+        v = v * 10 + (*p++ - '0');
+        if (v > limit + 1) {
+            return false;
+        }
+    }
+    if (v > limit + (negative ? 1 : 0)) {
+        return false;
+    }
+    value = negative ? -v : v;
+    return true;
+}
+
+/**
+ * @brief Résultat de la lecture d'une suite de jetons
+ */
+struct Scan {
+    std::int64_t tokens;   // Jetons lus
+    bool invalid;          // Arrêt sur un jeton qui n'est pas un entier
+};
+
+/**
+ * @brief Lit au plus maxTokens valeurs de cellules et les confie à sink
+ */
+template <class Sink>
+Scan scanCells(const char* p, const char* end, std::int64_t maxTokens, Sink& sink) {
+    const std::int64_t INT_LIMIT = std::numeric_limits<int>::max();
+    Scan scan = {0, false};
+    while (scan.tokens < maxTokens) {
+        while (p < end && isSpace(*p)) ++p;
+        if (p == end) break;
+
+        std::int64_t value;
+        if (isDigit(*p) && (p + 1 == end || isSpace(p[1]))) {
+            value = *p++ - '0';  // Cas courant : un chiffre isolé
+        } else if (!readInteger(p, end, INT_LIMIT, value)) {
+            scan.invalid = true;
+            break;
+        }
+        sink.put(value);
+        ++scan.tokens;
+    }
+    return scan;
+}
+
+/**
+ * @brief Ne fait que compter (première passe parallèle)
+ */
+struct CountSink {
+    void put(std::int64_t) {}
+};
+
+/**
+ * @brief Range les valeurs dans les lignes de bits à partir d'une cellule donnée
+ *
+ * Les bits d'un mot sont accumulés puis écrits d'un coup. Seuls le premier
+ * et le dernier mot d'une tranche peuvent être partagés avec une tranche
+ * voisine : ils sont écrits par un OU atomique, les autres directement.
+ */
+class BitSink {
+public:
+    BitSink(std::uint64_t* alive, std::uint64_t* obstacles, std::int64_t width, std::int64_t wordsPerRow,
+            std::int64_t firstCell, std::int64_t endCell)
+        : alive(alive), obstacles(obstacles), width(width), wordsPerRow(wordsPerRow),
+          x(firstCell % width), bit(x % WORD_BITS),
+          rowStart((firstCell / width) * wordsPerRow), word(rowStart + x / WORD_BITS),
+          firstWord(word), lastWord(wordOf(endCell - 1)), aliveBits(0), obstacleBits(0), anyObstacle(false) {
+    }
+
+    void put(std::int64_t value) {
+        // 0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant ; autre valeur = morte
+        const std::uint64_t code = static_cast<std::uint64_t>(value) < 4 ? static_cast<std::uint64_t>(value) : 0;
+        aliveBits |= (code & 1) << bit;
+        obstacleBits |= (code >> 1) << bit;
+        ++bit;
+        if (++x == width) {
+            flush();
+            x = 0;
+            bit = 0;
+            rowStart += wordsPerRow;
+            word = rowStart;
+        } else if (bit == WORD_BITS) {
+            flush();
+            bit = 0;
+            ++word;
+        }
+    }
+
+    /**
+     * @brief Écrit le mot en cours (fin de tranche)
+     */
+    void finish() {
+        if (bit > 0) {
+            flush();
+        }
+    }
+
+    bool hasObstacles() const {
+        return anyObstacle;
+    }
+
+private:
+    std::uint64_t* alive;
+    std::uint64_t* obstacles;
+    std::int64_t width;
+    std::int64_t wordsPerRow;
+    std::int64_t x;
+    std::int64_t bit;
+    std::int64_t rowStart;
+    std::int64_t word;
+    std::int64_t firstWord;
+    std::int64_t lastWord;
+    std::uint64_t aliveBits;
+    std::uint64_t obstacleBits;
+    bool anyObstacle;
+
+    std::int64_t wordOf(std::int64_t cell) const {
+        return (cell / width) * wordsPerRow + (cell % width) / WORD_BITS;
+    }
+
+    static void store(std::uint64_t* target, std::uint64_t bits, bool shared) {
+        if (shared) {
+            __atomic_fetch_or(target, bits, __ATOMIC_RELAXED);
+        } else {
+            *target = bits;
+        }
+    }
+
+    void flush() {
+        const bool shared = word == firstWord || word == lastWord;
+        if (aliveBits != 0) {
+            store(alive + word, aliveBits, shared);
+        }
+        if (obstacleBits != 0) {
+            store(obstacles + word, obstacleBits, shared);
+            anyObstacle = true;
+        }
+        aliveBits = 0;
+        obstacleBits = 0;
+    }
+};
+
+/**
+ * @brief Bilan d'une tranche parallèle
+ */
+struct Chunk {
+    const char* begin;
+    const char* end;
+    std::int64_t tokens;      // Passe 1 : jetons de la tranche
+    bool invalid;             // Passe 1 : jeton invalide après tokens jetons
+    bool obstacles;           // Passe 2 : obstacle rencontré
+};
+
+} // namespace
+
+TextGridParser::TextGridParser()
+    : width(0), height(0), wordsPerRow(0),
+      parallelMode(std::thread::hardware_concurrency() > 1) {  // Deux passes : inutile sur un seul cœur
+}
+
+void TextGridParser::setParallelMode(bool parallel) {
+    parallelMode = parallel;
+}
+
+bool TextGridParser::parse(const std::string& filename) {
+    MappedFile file;
+    if (!file.open(filename, MappedFile::Mode::READ_ONLY)) {
+        return false;  // Message déjà affiché par MappedFile
+    }
+    file.advise(0, file.size(), MappedFile::Advice::SEQUENTIAL);
+    return parse(reinterpret_cast<const char*>(file.data()), file.size());
+}
+
+bool TextGridParser::parse(const char* data, std::uint64_t size) {
+    width = height = wordsPerRow = 0;
+    alive.clear();
+    obstacles.clear();
+
+    // Format de l'énoncé : "lignes colonnes" (hauteur largeur)
+    const char* p = data;
+    const char* end = data + size;
+    const std::int64_t DIMENSION_LIMIT = std::numeric_limits<std::int64_t>::max() / 16;
+    std::int64_t h = 0, w = 0;
+    for (std::int64_t* dimension : {&h, &w}) {
+        while (p < end && isSpace(*p)) ++p;
+        if (p == end || !readInteger(p, end, DIMENSION_LIMIT, *dimension)) {
+            std::cerr << "Erreur : Format de fichier invalide (dimensions)" << std::endl;
+            return false;
+        }
+    }
+    if (w <= 0 || h <= 0) {
+        std::cerr << "Erreur : Dimensions invalides (" << w << "x" << h << ")" << std::endl;
+        return false;
+    }
+
+    // Au moins un octet par cellule : écarte les en-têtes absurdes avant d'allouer
+    const std::int64_t remaining = end - p;
+    if (w > remaining || h > remaining / w) {
+        std::cerr << "Erreur : Données insuffisantes pour une grille " << w << "x" << h << std::endl;
+        return false;
+    }
+    const std::int64_t cells = w * h;
+    const std::int64_t words = (w + WORD_BITS - 1) / WORD_BITS;
+    try {
+        alive.assign(static_cast<size_t>(words * h), 0);
+        obstacles.assign(static_cast<size_t>(words * h), 0);
+    } catch (const std::bad_alloc&) {
+        alive.clear();
+        obstacles.clear();
+        std::cerr << "Erreur : Mémoire insuffisante pour une grille " << w << "x" << h << std::endl;
+        return false;
+    }
+
+    std::int64_t parsed = 0;
+    bool invalid = false;
+    bool anyObstacle = false;
+    if (!parallelMode || static_cast<std::uint64_t>(remaining) < PARALLEL_BYTES) {
+        BitSink sink(alive.data(), obstacles.data(), w, words, 0, cells);
+        Scan scan = scanCells(p, end, cells, sink);
+        sink.finish();
+        parsed = scan.tokens;
+        invalid = scan.invalid;
+        anyObstacle = sink.hasObstacles();
+    } else {
+        // Tranches coupées sur un blanc : aucun jeton n'est partagé
+        const std::int64_t chunkCount = static_cast<std::int64_t>((remaining + CHUNK_BYTES - 1) / CHUNK_BYTES);
+        std::vector<Chunk> chunks(static_cast<size_t>(chunkCount));
+        const char* begin = p;
+        for (std::int64_t i = 0; i < chunkCount; ++i) {
+            const char* cut = (i == chunkCount - 1) ? end : p + static_cast<std::int64_t>((i + 1) * CHUNK_BYTES);
+            cut = std::max(cut, begin);
+            while (cut < end && !isSpace(*cut)) ++cut;
+            chunks[i] = {begin, cut, 0, false, false};
+            begin = cut;
+        }
+
+        // Passe 1 : nombre de jetons de chaque tranche
+        Grid::runOnWorkers(chunkCount, [&chunks](std::int64_t first, std::int64_t last) {
+            CountSink counter;
+            for (std::int64_t i = first; i < last; ++i) {
+                Scan scan = scanCells(chunks[i].begin, chunks[i].end,
+                                      std::numeric_limits<std::int64_t>::max(), counter);
+                chunks[i].tokens = scan.tokens;
+                chunks[i].invalid = scan.invalid;
+            }
+        });
+
+        // Cellule de départ de chaque tranche ; les jetons au-delà de la grille sont ignorés
+        std::vector<std::int64_t> starts(static_cast<size_t>(chunkCount), cells);
+        for (std::int64_t i = 0; i < chunkCount && parsed < cells; ++i) {
+            starts[i] = parsed;
+            parsed = std::min(cells, parsed + chunks[i].tokens);
+            if (chunks[i].invalid && parsed < cells) {
+                invalid = true;
+                break;
+            }
+        }
+
+        // Passe 2 : écriture des bits
+        if (!invalid && parsed == cells) {
+            std::uint64_t* aliveWords = alive.data();
+            std::uint64_t* obstacleWords = obstacles.data();
+            Grid::runOnWorkers(chunkCount, [&](std::int64_t first, std::int64_t last) {
+                for (std::int64_t i = first; i < last; ++i) {
+                    if (starts[i] >= cells) continue;
+                    const std::int64_t count = std::min(chunks[i].tokens, cells - starts[i]);
+                    if (count == 0) continue;
+                    BitSink sink(aliveWords, obstacleWords, w, words, starts[i], starts[i] + count);
+                    scanCells(chunks[i].begin, chunks[i].end, count, sink);
+                    sink.finish();
+                    chunks[i].obstacles = sink.hasObstacles();
+                }
+            });
+            for (const Chunk& chunk : chunks) {
+                anyObstacle = anyObstacle || chunk.obstacles;
+            }
+        }
+    }
+
+    if (invalid || parsed < cells) {
+        std::cerr << "Erreur : Données insuffisantes à la ligne " << parsed / w << std::endl;
+        alive.clear();
+        obstacles.clear();
+        return false;
+    }
+    if (!anyObstacle) {
+        std::vector<std::uint64_t>().swap(obstacles);
+    }
+    width = w;
+    height = h;
+    wordsPerRow = words;
+    return true;
+}
+
+std::int64_t TextGridParser::getWidth() const {
+    return width;
+}
+
+std::int64_t TextGridParser::getHeight() const {
+    return height;
+}
+
+std::int64_t TextGridParser::getWordsPerRow() const {
+    return wordsPerRow;
+}
+
+bool TextGridParser::hasObstacles() const {
+    return !obstacles.empty();
+}
+
+const std::uint64_t* TextGridParser::aliveRow(std::int64_t y) const {
+    return alive.data() + y * wordsPerRow;
+}
+
+const std::uint64_t* TextGridParser::obstacleRow(std::int64_t y) const {
+    return obstacles.empty() ? nullptr : obstacles.data() + y * wordsPerRow;
+}
+
+bool TextGridParser::toGrid(Grid& grid) const {
+    if (width <= 0 || height <= 0 || !grid.resize(width, height)) {
+        return false;
+    }
+
+    // Les cellules neuves sont mortes et sans obstacle : seuls les bits posés comptent
+    Grid::runOnWorkers(height, [this, &grid](std::int64_t startRow, std::int64_t endRow) {
+        for (std::int64_t y = startRow; y < endRow; ++y) {
+            const std::uint64_t* aliveWords = aliveRow(y);
+            const std::uint64_t* obstacleWords = obstacleRow(y);
+            for (std::int64_t i = 0; i < wordsPerRow; ++i) {
+                const std::uint64_t a = aliveWords[i];
+                const std::uint64_t o = obstacleWords ? obstacleWords[i] : 0;
+                for (std::uint64_t bits = a | o; bits != 0; bits &= bits - 1) {
+                    const int b = __builtin_ctzll(bits);
+                    Cell& cell = grid.getCell(i * WORD_BITS + b, y);
+                    cell.setAlive(((a >> b) & 1) != 0);
+                    cell.setObstacle(((o >> b) & 1) != 0);
+                }
+            }
+        }
+    });
+    return true;
+}
+
+std::unique_ptr<BitGrid> TextGridParser::toBitGrid() const {
+    if (width <= 0 || height <= 0) {
+        return nullptr;
+    }
+    std::unique_ptr<BitGrid> bits;
+    try {
+        bits.reset(new BitGrid(width, height));
+    } catch (const std::exception&) {
+        std::cerr << "Erreur : Mémoire insuffisante pour une grille " << width << "x" << height << std::endl;
+        return nullptr;
+    }
+
+    for (std::int64_t y = 0; y < height; ++y) {
+        std::memcpy(bits->row(y), aliveRow(y), static_cast<size_t>(wordsPerRow) * sizeof(std::uint64_t));
+        const std::uint64_t* obstacleWords = obstacleRow(y);
+        if (!obstacleWords) continue;
+        for (std::int64_t i = 0; i < wordsPerRow; ++i) {
+            for (std::uint64_t o = obstacleWords[i]; o != 0; o &= o - 1) {
+                bits->setObstacle(i * WORD_BITS + __builtin_ctzll(o), y, true);
+            }
+        }
+    }
+    return bits;
+}
@@ -0,0 +1,109 @@
+#ifndef TEXTGRIDPARSER_HPP
+#define TEXTGRIDPARSER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Déclarations anticipées
+class Grid;
+class BitGrid;
+
+/**
+ * @class TextGridParser
+ * @brief Lecture rapide des grilles texte ("hauteur largeur" puis une valeur par cellule)
+ *
+ * Le fichier est projeté en mémoire et découpé en jetons par un analyseur
+ * écrit à la main (pas de flux formatés ni de locale), directement vers des
+ * lignes de bits au format de BitGrid. Au-delà de PARALLEL_BYTES, les
+ * données sont découpées en tranches aux frontières des jetons et lues en
+ * parallèle : une première passe compte les jetons de chaque tranche, ce
+ * qui donne la cellule de départ de la suivante, puis une seconde passe
+ * écrit les bits. Valeurs : 0 mort, 1 vivant, 2 obstacle mort, 3 obstacle
+ * vivant (toute autre valeur entière = cellule morte).
+ */
+class TextGridParser {
+public:
+    /**
+     * @brief Taille des données au-delà de laquelle la lecture est parallèle
+     */
+    static const std::uint64_t PARALLEL_BYTES = 4ULL * 1024 * 1024;
+
+    /**
+     * @brief Constructeur (lecture parallèle si la machine a plusieurs cœurs)
+     */
+    TextGridParser();
+
+    /**
+     * @brief Active ou désactive la lecture parallèle des gros fichiers
+     * @param parallel true pour découper en tranches au-delà de PARALLEL_BYTES
+     */
+    void setParallelMode(bool parallel);
+
+    /**
+     * @brief Lit un fichier texte
+     * @param filename Fichier à lire
+     * @return false si le fichier est absent ou mal formé (message sur std::cerr)
+     */
+    bool parse(const std::string& filename);
+
+    /**
+     * @brief Lit une grille texte déjà en mémoire
+     * @param data Début du texte
+     * @param size Taille en octets
+     * @return false si le texte est mal formé
+     */
+    bool parse(const char* data, std::uint64_t size);
+
+    std::int64_t getWidth() const;
+    std::int64_t getHeight() const;
+    std::int64_t getWordsPerRow() const;
+
+    /**
+     * @brief Vérifie si le fichier contient des obstacles (valeurs 2 ou 3)
+     * @return true si au moins un obstacle
+     */
+    bool hasObstacles() const;
+
+    /**
+     * @brief Accède à une ligne de cellules vivantes
+     * @param y Numéro de ligne
+     * @return Mots de la ligne (bit x % 64 du mot x / 64)
+     */
+    const std::uint64_t* aliveRow(std::int64_t y) const;
+
+    /**
+     * @brief Accède à une ligne d'obstacles
+     * @param y Numéro de ligne
+     * @return Mots de la ligne, nullptr sans obstacles
+     */
+    const std::uint64_t* obstacleRow(std::int64_t y) const;
+
+    /**
+     * @brief Copie la grille lue dans une Grid (redimensionnée)
+     *
+     * Seules les cellules vivantes ou obstacles sont modifiées, ligne par
+     * ligne en parallèle.
+     *
+     * @param grid Grille destination
+     * @return false si la grille ne peut pas être allouée
+     */
+    bool toGrid(Grid& grid) const;
+
+    /**
+     * @brief Crée une BitGrid à partir de la grille lue (copie des lignes)
+     * @return Grille, nullptr si elle ne peut pas être allouée
+     */
+    std::unique_ptr<BitGrid> toBitGrid() const;
+
+private:
+    std::int64_t width;
+    std::int64_t height;
+    std::int64_t wordsPerRow;
+    std::vector<std::uint64_t> alive;
+    std::vector<std::uint64_t> obstacles;  // Vide sans obstacles
+    bool parallelMode;
+};
+
+#endif // TEXTGRIDPARSER_HPP
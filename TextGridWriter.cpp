@@ -0,0 +1,195 @@
+#include "TextGridWriter.hpp"
+#include "BitGrid.hpp"
+#include "Cell.hpp"
+#include "Grid.hpp"
+#include "GridView.hpp"
+#include "GridSnapshot.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+const std::int64_t WORD_BITS = 64;
+
+/**
+ * @brief 16 caractères par octet de cellules : chiffre puis espace, 8 fois
+ */
+struct ByteTables {
+    char digits[256][16];     // "b0 b1 ... b7 " avec bi = '0' + bit i
+    char obstacles[256][16];  // 2 sur les positions des obstacles, 0 ailleurs
+
+    ByteTables() {
+        for (int b = 0; b < 256; ++b) {
+            for (int i = 0; i < 8; ++i) {
+                const int bit = (b >> i) & 1;
+                digits[b][2 * i] = static_cast<char>('0' + bit);
+                digits[b][2 * i + 1] = ' ';
+                obstacles[b][2 * i] = static_cast<char>(2 * bit);
+                obstacles[b][2 * i + 1] = 0;
+            }
+        }
+    }
+};
+
+const ByteTables& tables() {
+    static const ByteTables instance;
+    return instance;
+}
+
+} // namespace
+
+TextGridWriter::TextGridWriter()
+    : used(0) {
+}
+
+bool TextGridWriter::open(std::ofstream& file, const std::string& filename) {
+    file.open(filename);
+    if (!file.is_open()) {
+        std::cerr << "Erreur : Impossible de créer le fichier " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void TextGridWriter::appendHeader(std::int64_t height, std::int64_t width) {
+    // Format de l'énoncé : "lignes colonnes" (hauteur largeur)
+    const std::string header = std::to_string(height) + " " + std::to_string(width) + "\n";
+    if (buffer.size() < used + header.size()) {
+        buffer.resize(used + header.size());
+    }
+    std::memcpy(buffer.data() + used, header.data(), header.size());
+    used += header.size();
+}
+
+void TextGridWriter::appendRow(const std::uint64_t* alive, const std::uint64_t* obstacles, std::int64_t width) {
+    // Chaque octet produit 16 caractères : on écrit jusqu'à 15 octets de trop,
+    // recouverts ensuite par la ligne suivante
+    const std::int64_t bytes = (width + 7) / 8;
+    const std::size_t needed = used + static_cast<std::size_t>(bytes) * 16 + 1;
+    if (buffer.size() < needed) {
+        buffer.resize(needed);
+    }
+
+    const ByteTables& t = tables();
+    char* out = buffer.data() + used;
+    for (std::int64_t k = 0; k < bytes; ++k) {
+        const int shift = static_cast<int>(8 * (k % 8));
+        const unsigned a = static_cast<unsigned>(alive[k / 8] >> shift) & 0xFFu;
+        std::uint64_t chars[2];
+        std::memcpy(chars, t.digits[a], 16);
+        if (obstacles) {
+            // Addition octet par octet sans retenue : '0' + vivant + 2 * obstacle
+            const unsigned o = static_cast<unsigned>(obstacles[k / 8] >> shift) & 0xFFu;
+            std::uint64_t extra[2];
+            std::memcpy(extra, t.obstacles[o], 16);
+            chars[0] += extra[0];
+            chars[1] += extra[1];
+        }
+        std::memcpy(out + 16 * k, chars, 16);
+    }
+
+    // Dernière valeur suivie d'un saut de ligne au lieu d'une espace
+    used += static_cast<std::size_t>(2 * width);
+    if (width > 0) {
+        buffer[used - 1] = '\n';
+    } else {
+        buffer[used++] = '\n';
+    }
+}
+
+bool TextGridWriter::flush(std::ofstream& file) {
+    file.write(buffer.data(), static_cast<std::streamsize>(used));
+    used = 0;
+    return static_cast<bool>(file);
+}
+
+bool TextGridWriter::appendView(const GridView& view, std::ofstream* file) {
+    const std::int64_t width = view.getWidth();
+    const std::int64_t words = (width + WORD_BITS - 1) / WORD_BITS;
+    aliveWords.assign(static_cast<std::size_t>(words), 0);
+    obstacleWords.assign(static_cast<std::size_t>(words), 0);
+
+    for (std::int64_t y = 0; y < view.getHeight(); ++y) {
+        // Regrouper la ligne en mots de 64 cellules, comme BitGrid
+        bool anyObstacle = false;
+        for (std::int64_t i = 0; i < words; ++i) {
+            std::uint64_t a = 0;
+            std::uint64_t o = 0;
+            const std::int64_t end = std::min(width, (i + 1) * WORD_BITS);
+            for (std::int64_t x = i * WORD_BITS; x < end; ++x) {
+                const Cell& cell = view.at(x, y);
+                a |= static_cast<std::uint64_t>(cell.isAlive()) << (x % WORD_BITS);
+                o |= static_cast<std::uint64_t>(cell.isObstacle()) << (x % WORD_BITS);
+            }
+            aliveWords[i] = a;
+            obstacleWords[i] = o;
+            anyObstacle = anyObstacle || o != 0;
+        }
+        appendRow(aliveWords.data(), anyObstacle ? obstacleWords.data() : nullptr, width);
+        if (file && used >= FLUSH_BYTES && !flush(*file)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TextGridWriter::write(const std::string& filename, const Grid& grid) {
+    return write(filename, GridView(grid));
+}
+
+bool TextGridWriter::write(const std::string& filename, const GridView& view) {
+    std::ofstream file;
+    if (!open(file, filename)) {
+        return false;
+    }
+    used = 0;
+    appendHeader(view.getHeight(), view.getWidth());
+    if (!appendView(view, &file) || !flush(file)) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+template <class AliveRow, class ObstacleRow>
+bool TextGridWriter::writeRows(const std::string& filename, std::int64_t height, std::int64_t width,
+                               AliveRow aliveRow, ObstacleRow obstacleRow) {
+    std::ofstream file;
+    if (!open(file, filename)) {
+        return false;
+    }
+    used = 0;
+    appendHeader(height, width);
+    for (std::int64_t y = 0; y < height; ++y) {
+        appendRow(aliveRow(y), obstacleRow(y), width);
+        if (used >= FLUSH_BYTES && !flush(file)) {
+            break;
+        }
+    }
+    if (!flush(file)) {
+        std::cerr << "Erreur : Écriture incomplète de " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool TextGridWriter::write(const std::string& filename, const BitGrid& grid) {
+    return writeRows(filename, grid.getHeight(), grid.getWidth(),
+                     [&grid](std::int64_t y) { return grid.row(y); },
+                     [&grid](std::int64_t y) { return grid.obstacleRow(y); });
+}
+
+bool TextGridWriter::write(const std::string& filename, const GridSnapshot& snapshot) {
+    return writeRows(filename, snapshot.getHeight(), snapshot.getWidth(),
+                     [&snapshot](std::int64_t y) { return snapshot.aliveRow(y); },
+                     [&snapshot](std::int64_t y) { return snapshot.obstacleRow(y); });
+}
+
+std::string TextGridWriter::format(const GridView& view) {
+    used = 0;
+    appendHeader(view.getHeight(), view.getWidth());
+    appendView(view, nullptr);
+    return std::string(buffer.data(), used);
+}
@@ -0,0 +1,129 @@
+#ifndef TEXTGRIDWRITER_HPP
+#define TEXTGRIDWRITER_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Déclarations anticipées
+class Grid;
+class GridView;
+class BitGrid;
+class GridSnapshot;
+
+/**
+ * @class TextGridWriter
+ * @brief Écriture rapide des grilles texte ("hauteur largeur" puis une valeur par cellule)
+ *
+ * Une génération entière est formatée dans un tampon réutilisé d'un appel à
+ * l'autre, puis écrite en un seul write. Les lignes sont d'abord regroupées
+ * en mots de 64 cellules ; chaque octet (8 cellules) est converti en 16
+ * caractères ("c c c c c c c c ") par une table précalculée, les obstacles
+ * ajoutant 2 aux chiffres concernés. Le résultat est identique octet pour
+ * octet à l'ancienne écriture par operator<< et std::endl.
+ */
+class TextGridWriter {
+public:
+    /**
+     * @brief Taille du tampon au-delà de laquelle il est vidé avant la fin
+     *
+     * Seules les très grandes grilles (plus de 32 millions de cellules)
+     * demandent plusieurs écritures.
+     */
+    static const std::size_t FLUSH_BYTES = 64 * 1024 * 1024;
+
+    TextGridWriter();
+
+    /**
+     * @brief Écrit une grille complète
+     * @param filename Fichier de sortie
+     * @param grid Grille à écrire
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const Grid& grid);
+
+    /**
+     * @brief Écrit une vue (région ou grille entière)
+     * @param filename Fichier de sortie
+     * @param view Vue à écrire
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const GridView& view);
+
+    /**
+     * @brief Écrit une grille compacte directement depuis ses lignes de bits
+     * @param filename Fichier de sortie
+     * @param grid Grille à écrire
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const BitGrid& grid);
+
+    /**
+     * @brief Écrit une génération capturée (voir AsyncGridWriter)
+     * @param filename Fichier de sortie
+     * @param snapshot Génération à écrire
+     * @return true si l'écriture a réussi
+     */
+    bool write(const std::string& filename, const GridSnapshot& snapshot);
+
+    /**
+     * @brief Formate une vue en mémoire, sans l'écrire
+     * @param view Vue à formater
+     * @return Texte du fichier
+     */
+    std::string format(const GridView& view);
+
+private:
+    std::vector<char> buffer;               // Tampon réutilisé
+    std::size_t used;                       // Octets valides du tampon
+    std::vector<std::uint64_t> aliveWords;  // Ligne en cours (Grid, GridView)
+    std::vector<std::uint64_t> obstacleWords;
+
+    /**
+     * @brief Écrit "hauteur largeur" dans le tampon
+     */
+    void appendHeader(std::int64_t height, std::int64_t width);
+
+    /**
+     * @brief Formate une ligne de cellules dans le tampon
+     * @param alive Mots des cellules vivantes
+     * @param obstacles Mots des obstacles (nullptr sans obstacles)
+     * @param width Nombre de cellules de la ligne
+     */
+    void appendRow(const std::uint64_t* alive, const std::uint64_t* obstacles, std::int64_t width);
+
+    /**
+     * @brief Formate les lignes d'une vue dans le tampon, en vidant au besoin
+     * @param view Vue à formater
+     * @param file Fichier de sortie (nullptr : tout garder en mémoire)
+     * @return false si une écriture a échoué
+     */
+    bool appendView(const GridView& view, std::ofstream* file);
+
+    /**
+     * @brief Écrit des lignes déjà regroupées en mots de 64 cellules
+     * @param filename Fichier de sortie
+     * @param height Nombre de lignes
+     * @param width Cellules par ligne
+     * @param aliveRow Mots des cellules vivantes de la ligne y
+     * @param obstacleRow Mots des obstacles de la ligne y (nullptr sans obstacles)
+     * @return true si l'écriture a réussi
+     */
+    template <class AliveRow, class ObstacleRow>
+    bool writeRows(const std::string& filename, std::int64_t height, std::int64_t width,
+                   AliveRow aliveRow, ObstacleRow obstacleRow);
+
+    /**
+     * @brief Écrit le tampon dans le fichier et le vide
+     * @return false si l'écriture a échoué
+     */
+    bool flush(std::ofstream& file);
+
+    /**
+     * @brief Ouvre le fichier de sortie (message d'erreur en cas d'échec)
+     */
+    static bool open(std::ofstream& file, const std::string& filename);
+};
+
+#endif // TEXTGRIDWRITER_HPP
@@ -21,6 +21,34 @@
 #include "Rule.hpp"
 #include "FileHandler.hpp"
 #include "GameOfLife.hpp"
+#include "CounterRNG.hpp"
+#include "BitGrid.hpp"
+#include "NumaTopology.hpp"
+#include "GridView.hpp"
+#include "PatternRegistry.hpp"
+#include "ObjectCensus.hpp"
+#include "EscapeDetector.hpp"
+#include "StabilizationDetector.hpp"
+#include "LifespanMeter.hpp"
+#include "SoupSearch.hpp"
+#include "ParameterSweep.hpp"
+#include "StatisticsSink.hpp"
+#include "HeatMap.hpp"
+#include "TextGridParser.hpp"
+#include "TextGridWriter.hpp"
+#include "RLEGridParser.hpp"
+#include "RLEGridWriter.hpp"
+#include "MacrocellTree.hpp"
+#include "AsyncGridWriter.hpp"
+#include "GenerationArchive.hpp"
+#include "OutputPolicy.hpp"
+#include <chrono>
+#include <map>
+#include <algorithm>
+#include <fstream>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
 
 /**
  * @brief Couleurs pour l'affichage dans le terminal
@@ -431,6 +459,22 @@ public:
             afficherResultat("resize(10, 10) change la hauteur à 10",
                 grille.getHeight() == 10);
         }
+        
+        // Test 10: Dimensions 64 bits et grilles trop grandes
+        {
+            const std::int64_t enorme = 3000000000LL;  // Dépasse INT32_MAX
+            afficherResultat("estimateMemoryBytes() ne déborde pas sur 64 bits", 
+                Grid::estimateMemoryBytes(enorme, enorme) > static_cast<std::uint64_t>(enorme) * enorme);
+            
+            std::string erreur;
+            afficherResultat("checkAllocation() refuse une grille trop grande", 
+                !Grid::checkAllocation(enorme, enorme, erreur) && erreur.find("Mo") != std::string::npos,
+                erreur);
+            
+            Grid grille(4, 3);
+            afficherResultat("resize() échoue proprement et conserve la grille", 
+                !grille.resize(enorme, enorme) && grille.getWidth() == 4 && grille.getHeight() == 3);
+        }
     }
     
     // =========================================================================
@@ -599,6 +643,19 @@ public:
             
             std::remove("test_obstacles_temp.txt");
         }
+        
+        // Test 5: Dimensions RLE au-delà de 32 bits refusées proprement
+        {
+            {
+                std::ofstream fichier("test_rle_enorme_temp.rle");
+                fichier << "x = 5000000000, y = 5000000000" << std::endl << "o!" << std::endl;
+            }
+            Grid grille(3, 3);
+            auto handler = FileHandlerFactory::createRLE();
+            afficherResultat("RLE de 5e9 x 5e9 refusé sans débordement", 
+                !handler->load("test_rle_enorme_temp.rle", grille) && grille.getWidth() == 3);
+            std::remove("test_rle_enorme_temp.rle");
+        }
     }
     
     // =========================================================================
@@ -723,6 +780,1878 @@ public:
             afficherResultat("Planeur garde 5 cellules après 4 générations", 
                 grille.countLivingCells() == 5);
         }
+        
+        // Test 5: Catalogue des motifs compilés
+        {
+            PatternRegistry& catalogue = PatternRegistry::get();
+            const PatternBitmap* canon = catalogue.find("glider_gun");
+            afficherResultat("PatternRegistry trouve le canon de Gosper (36x9, 36 cellules)", 
+                canon && canon->width == 36 && canon->height == 9 && canon->countLivingCells() == 36);
+            afficherResultat("PatternRegistry ignore un motif inconnu", 
+                catalogue.find("inexistant") == nullptr);
+            
+            Grid grille(20, 20);
+            grille.placePattern("pulsar", 3, 3);
+            afficherResultat("Pulsar placé avec 48 cellules vivantes", 
+                grille.countLivingCells() == 48);
+        }
+        
+        // Test 6: Chargement paresseux depuis un répertoire RLE
+        {
+            PatternRegistry& catalogue = PatternRegistry::get();
+            std::string ancien = catalogue.getDirectory();
+            DirectoryManager::createDirectory("test_motifs_tmp");
+            {
+                std::ofstream fichier("test_motifs_tmp/croix_test.rle");
+                fichier << "x = 3, y = 3\nbo$3o$bo!\n";
+            }
+            catalogue.setDirectory("test_motifs_tmp");
+            auto noms = catalogue.getNames();
+            bool liste = std::find(noms.begin(), noms.end(), "croix_test") != noms.end();
+            Grid grille(10, 10);
+            grille.placePattern("croix_test", 2, 2);
+            afficherResultat("Motif RLE du répertoire listé et chargé à la demande", 
+                liste && grille.countLivingCells() == 5 && grille.getCell(3, 3).isAlive());
+            catalogue.setDirectory(ancien);
+            std::remove("test_motifs_tmp/croix_test.rle");
+            rmdir("test_motifs_tmp");
+        }
+        
+        // Test 7: Pose par mots entiers sur BitGrid (centaines de canons)
+        {
+            const PatternBitmap* canon = PatternRegistry::get().find("glider_gun");
+            Grid grille(1000, 500);
+            BitGrid compacte(1000, 500);
+            auto debut = std::chrono::steady_clock::now();
+            for (int i = 0; i < 400; ++i) {
+                compacte.stamp(*canon, (i * 97) % 1000, (i * 41) % 500);
+            }
+            double micro = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - debut).count();
+            for (int i = 0; i < 400; ++i) {
+                grille.placePattern("glider_gun", (i * 97) % 1000, (i * 41) % 500);
+            }
+            Grid copie(1, 1);
+            compacte.toGrid(copie);
+            afficherResultat("BitGrid::stamp() identique à Grid::placePattern()", 
+                copie.isEqual(grille), "400 canons en " + std::to_string(static_cast<int>(micro)) + " µs");
+        }
+        
+        // Test 8: Les 8 orientations (groupe D4)
+        {
+            PatternRegistry& catalogue = PatternRegistry::get();
+            const PatternBitmap* base = catalogue.find("r_pentomino");
+            const PatternBitmap* quart = catalogue.find("r_pentomino", PatternTransform::ROTATE_90);
+            PatternBitmap quatreQuarts = quart->transformed(PatternTransform::ROTATE_90)
+                .transformed(PatternTransform::ROTATE_90).transformed(PatternTransform::ROTATE_90);
+            afficherResultat("Quatre quarts de tour redonnent le motif d'origine", 
+                quatreQuarts.words == base->words);
+            
+            const PatternBitmap* diehard = catalogue.find("diehard", PatternTransform::ROTATE_270);
+            afficherResultat("Rotation d'un quart de tour échange largeur et hauteur", 
+                diehard->width == 3 && diehard->height == 8 && diehard->countLivingCells() == 7);
+            afficherResultat("Orientation calculée une seule fois (cache)", 
+                catalogue.find("r_pentomino", PatternTransform::ROTATE_90) == quart);
+            
+            PatternBitmap miroir = base->transformed(PatternTransform::FLIP_X);
+            PatternBitmap transpose = base->transformed(PatternTransform::TRANSPOSE)
+                .transformed(PatternTransform::ROTATE_90);
+            afficherResultat("Transposée puis quart de tour = miroir gauche/droite", 
+                transpose.words == miroir.words);
+        }
+        
+        // Test 9: Pose groupée, séquentielle et parallèle
+        {
+            std::vector<PatternPlacement> poses;
+            for (int i = 0; i < 300; ++i) {
+                poses.push_back({i % 2 ? "glider" : "lwss", static_cast<PatternTransform>(i % 8),
+                                 (i * 53) % 600, (i * 29) % 400});
+            }
+            poses.push_back({"inexistant", PatternTransform::IDENTITY, 0, 0});
+            
+            Grid grille(600, 400);
+            grille.setToricMode(true);
+            for (const PatternPlacement& pose : poses) {
+                grille.placePattern(pose.pattern, pose.x, pose.y, pose.transform);
+            }
+            
+            Grid groupee(600, 400);
+            groupee.setToricMode(true);
+            std::int64_t inconnus = groupee.placePatterns(poses, true);
+            afficherResultat("Grid::placePatterns() parallèle = poses une à une", 
+                inconnus == 1 && groupee.isEqual(grille));
+            
+            BitGrid compacte(600, 400);
+            compacte.setToricMode(true);
+            compacte.stampAll(poses, true);
+            Grid copie(1, 1);
+            compacte.toGrid(copie);
+            afficherResultat("BitGrid::stampAll() parallèle = poses une à une", 
+                copie.isEqual(grille));
+        }
+        
+        // Test 10: Un motif enregistré n'est jamais remplacé
+        {
+            PatternRegistry& catalogue = PatternRegistry::get();
+            const PatternBitmap* planeur = catalogue.find("glider");
+            const PatternBitmap* tourne = catalogue.find("glider", PatternTransform::ROTATE_90);
+            PatternBitmap remplacant = *catalogue.find("blinker");
+            remplacant.name = "glider";
+            afficherResultat("PatternRegistry::add() refuse un nom existant, pointeurs inchangés", 
+                catalogue.add(remplacant) == nullptr && catalogue.find("glider") == planeur &&
+                catalogue.find("glider", PatternTransform::ROTATE_90) == tourne &&
+                planeur->countLivingCells() == 5);
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DE L'ALÉATOIRE REPRODUCTIBLE (CounterRNG)
+    // =========================================================================
+    
+    void testerAleatoire() {
+        afficherSection("TESTS : Soupes Aléatoires (CounterRNG)");
+        
+        // Test 1: Le générateur est une fonction pure de (graine, compteur)
+        {
+            afficherResultat("CounterRNG::at() est déterministe", 
+                CounterRNG::at(42, 7) == CounterRNG::at(42, 7));
+            afficherResultat("CounterRNG::at() dépend de la graine", 
+                CounterRNG::at(42, 7) != CounterRNG::at(43, 7));
+        }
+        
+        // Test 2: Densités extrêmes
+        {
+            afficherResultat("Densité 0 donne un mot vide", 
+                CounterRNG::bernoulliWord(1, 0, CounterRNG::quantizeProbability(0.0)) == 0);
+            afficherResultat("Densité 1 donne un mot plein", 
+                CounterRNG::bernoulliWord(1, 0, CounterRNG::quantizeProbability(1.0)) == ~0ULL);
+        }
+        
+        // Test 3: Même graine => même grille
+        {
+            Grid a(130, 40), b(130, 40);
+            a.randomize(0.3, 12345);
+            b.randomize(0.3, 12345);
+            afficherResultat("randomize() avec la même graine donne la même grille", 
+                a.isEqual(b));
+            b.randomize(0.3, 12346);
+            afficherResultat("randomize() avec une autre graine donne une autre grille", 
+                !a.isEqual(b));
+        }
+        
+        // Test 4: La densité est respectée
+        {
+            Grid grille(200, 200);
+            grille.randomize(0.3, 7);
+            double densite = grille.countLivingCells() / 40000.0;
+            afficherResultat("randomize(0.3) donne une densité proche de 0.3", 
+                densite > 0.28 && densite < 0.32, "Densité: " + std::to_string(densite));
+        }
+        
+        // Test 5: Les obstacles ne sont pas modifiés
+        {
+            Grid grille(10, 10);
+            grille.getCell(3, 3).setObstacle(true);
+            grille.randomize(1.0, 1);
+            afficherResultat("randomize() ne touche pas aux obstacles", 
+                !grille.getCell(3, 3).isAlive() && grille.getCell(4, 4).isAlive());
+        }
+        
+        // Test 6: GameOfLife rejoue une soupe à partir de sa graine
+        {
+            GameOfLife jeu(50, 50, 0.1f);
+            jeu.setSoupParameters(0.4, 99);
+            jeu.randomize();
+            Grid premiere(jeu.getGrid());
+            jeu.randomize();
+            afficherResultat("GameOfLife::randomize() passe à la graine suivante", 
+                jeu.getLastSoupSeed() == 100 && !jeu.getGrid().isEqual(premiere));
+            jeu.setSoupParameters(0.4, 99);
+            jeu.randomize();
+            afficherResultat("GameOfLife rejoue la soupe de graine 99", 
+                jeu.getGrid().isEqual(premiere));
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DE LA GRILLE COMPACTE (BitGrid)
+    // =========================================================================
+    
+    /**
+     * @brief Fait évoluer une Grid et une BitGrid en parallèle et les compare
+     * @return true si les deux grilles restent identiques à chaque génération
+     */
+    bool evoluerEtComparer(Grid& grille, BitGrid& compacte, int generations) {
+        Grid copie(1, 1);
+        for (int i = 0; i < generations; ++i) {
+            grille.computeNextGeneration();
+            grille.update();
+            compacte.step();
+            compacte.toGrid(copie);
+            if (!copie.isEqual(grille)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    void testerBitGrid() {
+        afficherSection("TESTS : Grille Compacte (BitGrid)");
+        
+        // Test 1: Accès aux cellules et bits de remplissage
+        {
+            BitGrid compacte(70, 3);
+            compacte.setAlive(69, 2, true);
+            compacte.setAlive(0, 0, true);
+            afficherResultat("BitGrid : 2 mots par ligne pour 70 colonnes", 
+                compacte.getWordsPerRow() == 2);
+            afficherResultat("BitGrid::setAlive() / isAlive()", 
+                compacte.isAlive(69, 2) && compacte.isAlive(0, 0) && !compacte.isAlive(68, 2));
+            afficherResultat("BitGrid::countLivingCells() (popcount)", 
+                compacte.countLivingCells() == 2);
+        }
+        
+        // Test 2: Planeur et clignotant identiques à Grid (bords fixes et torique)
+        for (int torique = 0; torique <= 1; ++torique) {
+            Grid grille(70, 20);
+            grille.setToricMode(torique == 1);
+            grille.placePattern("glider", 60, 14);
+            grille.placePattern("blinker", 10, 5);
+            BitGrid compacte(1, 1);
+            compacte.fromGrid(grille);
+            compacte.setParallelMode(false);
+            afficherResultat(std::string("BitGrid suit Grid (planeur, ") + (torique ? "torique)" : "bords fixes)"), 
+                evoluerEtComparer(grille, compacte, 60));
+        }
+        
+        // Test 3: Soupe avec obstacles et règle HighLife
+        {
+            Grid grille(130, 67);
+            grille.setToricMode(true);
+            grille.setRule(RuleFactory::create(RuleFactory::RuleType::HIGHLIFE));
+            for (int i = 0; i < 40; ++i) {
+                grille.getCell((i * 37) % 130, (i * 11) % 67).setObstacle(true);
+            }
+            grille.getCell(5, 5).setObstacle(true);
+            grille.getCell(5, 5).setAlive(true);
+            grille.randomize(0.35, 2024);
+            BitGrid compacte(1, 1);
+            compacte.fromGrid(grille);
+            afficherResultat("BitGrid suit Grid (soupe, obstacles, HighLife)", 
+                evoluerEtComparer(grille, compacte, 30));
+        }
+        
+        // Test 4: Même soupe que Grid pour une graine donnée
+        {
+            Grid grille(100, 30);
+            grille.randomize(0.3, 77);
+            BitGrid compacte(100, 30);
+            compacte.randomize(0.3, 77);
+            Grid copie(1, 1);
+            compacte.toGrid(copie);
+            afficherResultat("BitGrid::randomize() tire la même soupe que Grid", 
+                copie.isEqual(grille));
+        }
+        
+        // Test 5: Grille projetée : création, évolution, reprise
+        {
+            const std::string chemin = "test_bitgrid_tmp.golmap";
+            std::remove(chemin.c_str());
+            
+            BitGrid reference(200, 150);
+            reference.setToricMode(true);
+            reference.randomize(0.3, 5);
+            {
+                auto projetee = BitGrid::createMapped(chemin, 200, 150);
+                bool cree = projetee != nullptr;
+                afficherResultat("BitGrid::createMapped() crée le fichier", cree);
+                if (cree) {
+                    projetee->setToricMode(true);
+                    projetee->randomize(0.3, 5);
+                    projetee->step(10);
+                    projetee->sync();
+                }
+            }
+            reference.step(10);
+            
+            auto reprise = BitGrid::openMapped(chemin);
+            bool ok = reprise && reprise->getGeneration() == 10 && reprise->isToricMode();
+            afficherResultat("BitGrid::openMapped() reprend à la génération 10", ok);
+            if (ok) {
+                afficherResultat("Grille projetée identique à la grille en mémoire", 
+                    reprise->isEqual(reference));
+                reprise->step(5);
+                reference.step(5);
+                afficherResultat("Grille projetée : l'évolution continue après reprise", 
+                    reprise->isEqual(reference) && reprise->getGeneration() == 15);
+            }
+            reprise.reset();
+            std::remove(chemin.c_str());
+        }
+        
+        // Test 6: Topologie NUMA et répartition des threads
+        {
+            std::vector<int> cpus = NumaTopology::parseCpuList("0-3,8,10-11");
+            afficherResultat("NumaTopology::parseCpuList(\"0-3,8,10-11\")", 
+                cpus.size() == 7 && cpus[4] == 8 && cpus[6] == 11);
+            const NumaTopology& topologie = NumaTopology::get();
+            int dernier = topologie.nodeForWorker(15, 16);
+            afficherResultat("NumaTopology : chaque thread reçoit un nœud existant", 
+                topologie.nodeForWorker(0, 16) == 0 && dernier >= 0 && dernier < topologie.getNodeCount());
+        }
+        
+        // Test 7: Grandes grilles construites par les threads de calcul
+        {
+            Grid grille(400, 300);
+            grille.randomize(0.3, 8);
+            grille.setParallelMode(true);
+            Grid copie(grille);
+            grille.computeNextGeneration();
+            grille.update();
+            copie.setParallelMode(false);
+            copie.computeNextGeneration();
+            copie.update();
+            afficherResultat("Grid parallèle (threads fixés par nœud) = Grid séquentielle", 
+                grille.isEqual(copie));
+            
+            BitGrid compacte(1000, 700);
+            compacte.randomize(0.3, 8);
+            compacte.step();
+            std::int64_t lignes = 0;
+            for (const WorkerTiming& mesure : compacte.getLastStepTimings()) {
+                lignes += mesure.rows;
+            }
+            afficherResultat("BitGrid : les mesures par thread couvrent toutes les lignes", 
+                lignes == 700);
+        }
+        
+        // Test 8: Affectation d'une grille sans obstacles sur une grille qui en a
+        {
+            BitGrid cible(10, 10);
+            cible.setObstacle(3, 3, true);
+            cible.setAlive(3, 3, true);
+            cible.setAlive(6, 5, true);
+            cible.setAlive(6, 6, true);
+            cible.setAlive(6, 7, true);
+            cible.setHeatMapEnabled(true);
+            cible.step();
+            BitGrid source(10, 10);
+            cible = source;
+            cible.step();
+            afficherResultat("Affectation : obstacles et carte d'activité de la cible effacés", 
+                !cible.hasObstacles() && !cible.isObstacle(3, 3) && !cible.isAlive(3, 3) &&
+                cible.getHeatMap() && cible.getHeatMap()->getMax() == 0);
+        }
+        
+        // Test 9: Recopie mot par mot dans une grille projetée (import --from)
+        {
+            const std::string chemin = "test_bitgrid_tmp.golmap";
+            std::remove(chemin.c_str());
+            BitGrid source(130, 40);
+            source.randomize(0.3, 9);
+            source.setObstacle(129, 39, true);
+            source.setToricMode(true);
+            bool ok = false;
+            {
+                auto projetee = BitGrid::createMapped(chemin, 130, 40, true);
+                ok = projetee && projetee->copyCells(source) && projetee->isEqual(source) &&
+                     projetee->isObstacle(129, 39) && projetee->isToricMode();
+            }
+            BitGrid autreTaille(10, 10);
+            afficherResultat("BitGrid::copyCells() remplit la grille projetée, dimensions vérifiées", 
+                ok && !autreTaille.copyCells(source));
+            std::remove(chemin.c_str());
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DES VUES (GridView)
+    // =========================================================================
+    
+    void testerVues() {
+        afficherSection("TESTS : Vues sur une Région (GridView)");
+        
+        // Test 1: Étendue bornée à la grille et accès aux cellules
+        {
+            Grid grille(20, 10);
+            grille.getCell(12, 4).setAlive(true);
+            GridView vue(grille, 10, 3, 50, 50);
+            afficherResultat("GridView borne l'étendue à la grille", 
+                vue.getWidth() == 10 && vue.getHeight() == 7);
+            afficherResultat("GridView::at() référence la grille parente", 
+                vue.at(2, 1).isAlive() && &vue.at(2, 1) == &grille.getCell(12, 4));
+        }
+        
+        // Test 2: Comptage, empreinte et comparaison indépendants de la position
+        {
+            Grid grille(60, 40);
+            grille.placePattern("glider", 5, 5);
+            grille.placePattern("glider", 40, 20);
+            GridView a(grille, 5, 5, 3, 3);
+            GridView b(grille, 40, 20, 3, 3);
+            afficherResultat("GridView::countLivingCells() sur une région", 
+                a.countLivingCells() == 5 && GridView(grille).countLivingCells() == 10);
+            afficherResultat("GridView::hash() identique pour le même motif", 
+                a.hash() == b.hash() && a.hash() != GridView(grille, 0, 0, 3, 3).hash());
+            afficherResultat("GridView::isEqual() compare deux régions", 
+                a.isEqual(b) && !a.isEqual(GridView(grille, 6, 5, 3, 3)));
+        }
+        
+        // Test 3: Copie de région (blit), y compris avec chevauchement
+        {
+            Grid grille(30, 30);
+            grille.placePattern("glider", 0, 0);
+            GridView source(grille, 0, 0, 3, 3);
+            afficherResultat("GridView::blitTo() copie une région", 
+                source.blitTo(GridView(grille, 20, 20, 3, 3)) && 
+                GridView(grille, 20, 20, 3, 3).isEqual(source));
+            
+            Grid reference(grille);
+            GridView(grille, 0, 0, 4, 4).blitTo(GridView(grille, 1, 1, 4, 4));
+            afficherResultat("GridView::blitTo() gère les régions qui se chevauchent", 
+                GridView(grille, 1, 1, 3, 3).isEqual(GridView(reference, 0, 0, 3, 3)));
+            
+            const Grid& constante = grille;
+            afficherResultat("GridView en lecture seule refuse d'être modifiée", 
+                !source.blitTo(GridView(constante, 5, 5, 3, 3)));
+        }
+        
+        // Test 4: Sous-vue avec pas (vignette)
+        {
+            Grid grille(16, 16);
+            for (int i = 0; i < 16; i += 2) {
+                grille.getCell(i, i).setAlive(true);
+            }
+            GridView vignette = GridView(grille).subView(0, 0, 100, 100, 2, 2);
+            afficherResultat("GridView::subView() avec un pas de 2", 
+                vignette.getWidth() == 8 && vignette.getStrideX() == 2 && vignette.countLivingCells() == 8);
+        }
+        
+        // Test 5: Sauvegarde directe d'une vue
+        {
+            Grid grille(50, 50);
+            grille.placePattern("glider", 30, 30);
+            GridView vue(grille, 30, 30, 3, 3);
+            bool rle = vue.saveToFile("test_vue_tmp.rle");
+            bool txt = vue.saveToFile("test_vue_tmp.txt");
+            Grid relueRle(1, 1), relueTxt(1, 1);
+            rle = rle && relueRle.loadFromFile("test_vue_tmp.rle");
+            txt = txt && relueTxt.loadFromFile("test_vue_tmp.txt");
+            afficherResultat("Vue sauvegardée et rechargée (RLE)", 
+                rle && GridView(relueRle).isEqual(vue));
+            afficherResultat("Vue sauvegardée et rechargée (texte)", 
+                txt && relueTxt.getWidth() == 3 && GridView(relueTxt).isEqual(vue));
+            std::remove("test_vue_tmp.rle");
+            std::remove("test_vue_tmp.txt");
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DU RECENSEMENT (ObjectCensus)
+    // =========================================================================
+    
+    void testerRecensement() {
+        afficherSection("TESTS : Découpage en Objets et Recensement");
+        
+        // Test 1: 8-connexité
+        {
+            BitGrid grille(20, 10);
+            grille.setAlive(2, 2, true);
+            grille.setAlive(3, 3, true);   // Diagonale : même objet
+            grille.setAlive(10, 2, true);
+            grille.setAlive(12, 2, true);  // Une case d'écart : deux objets
+            std::vector<DetectedObject> objets = ObjectCensus::findObjects(grille, false);
+            afficherResultat("Cellules en diagonale dans le même objet", 
+                objets.size() == 3 && objets[0].x == 2 && objets[0].shape.width == 2 &&
+                objets[0].shape.countLivingCells() == 2);
+        }
+        
+        // Test 2: Classification des objets usuels
+        {
+            Grid grille(80, 40);
+            grille.placePattern("block", 2, 2);
+            grille.placePattern("glider", 20, 2);
+            grille.placePattern("blinker", 40, 2);
+            grille.placePattern("beacon", 60, 2);  // Phase en deux morceaux
+            grille.placePattern("glider", 20, 20, PatternTransform::ROTATE_90);
+            ObjectCensus recensement;
+            std::vector<CensusEntry> resultat = recensement.take(grille, false);
+            
+            std::map<std::string, const CensusEntry*> parNom;
+            for (const CensusEntry& entree : resultat) {
+                parNom[entree.type.name] = &entree;
+            }
+            afficherResultat("Bloc reconnu comme objet stable", 
+                parNom.count("block") && parNom["block"]->type.kind == ObjectKind::STILL_LIFE &&
+                parNom["block"]->type.code.compare(0, 4, "xs4_") == 0);
+            afficherResultat("Planeurs reconnus quelle que soit l'orientation", 
+                parNom.count("glider") && parNom["glider"]->count == 2 &&
+                parNom["glider"]->type.kind == ObjectKind::SPACESHIP && parNom["glider"]->type.period == 4);
+            afficherResultat("Clignotant reconnu comme oscillateur de période 2", 
+                parNom.count("blinker") && parNom["blinker"]->type.code.compare(0, 4, "xp2_") == 0);
+            afficherResultat("Balise en deux morceaux comptée comme un seul objet", 
+                parNom.count("beacon") && parNom["beacon"]->count == 1 && resultat.size() == 4);
+        }
+        
+        // Test 3: Code indépendant de la phase observée (certaines phases sont en deux morceaux)
+        {
+            ObjectCensus recensement;
+            BitGrid grille(40, 40);
+            grille.stamp(*PatternRegistry::get().find("lwss"), 5, 5);
+            std::vector<CensusEntry> avant = recensement.take(grille, false);
+            grille.step(3);
+            std::vector<CensusEntry> apres = recensement.take(grille, false);
+            afficherResultat("Même code pour toutes les phases d'un vaisseau", 
+                avant.size() == 1 && apres.size() == 1 && avant[0].type.code == apres[0].type.code &&
+                avant[0].type.name == "lwss");
+        }
+        
+        // Test 4: Étiquetage parallèle identique à l'étiquetage séquentiel
+        {
+            BitGrid grille(1500, 1000);
+            grille.randomize(0.35, 7);
+            grille.setParallelMode(true);
+            grille.step(150);
+            std::vector<DetectedObject> sequentiel = ObjectCensus::findObjects(grille, false);
+            auto debut = std::chrono::steady_clock::now();
+            std::vector<DetectedObject> parallele = ObjectCensus::findObjects(grille, true);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - debut).count();
+            
+            bool identiques = sequentiel.size() == parallele.size();
+            std::int64_t population = 0;
+            for (size_t i = 0; identiques && i < parallele.size(); ++i) {
+                identiques = parallele[i].x == sequentiel[i].x && parallele[i].y == sequentiel[i].y &&
+                             parallele[i].shape.words == sequentiel[i].shape.words;
+                population += parallele[i].shape.countLivingCells();
+            }
+            afficherResultat("Étiquetage parallèle = séquentiel", 
+                identiques && population == grille.countLivingCells(),
+                std::to_string(parallele.size()) + " objets en " + std::to_string(static_cast<int>(ms)) + " ms");
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DU RETRAIT DES VAISSEAUX (EscapeDetector)
+    // =========================================================================
+    
+    void testerEchappements() {
+        afficherSection("TESTS : Retrait des Vaisseaux qui s'Échappent");
+        
+        // Test 1: Planeur qui s'éloigne / planeur qui revient
+        {
+            BitGrid grille(100, 100);
+            grille.stamp(*PatternRegistry::get().find("block"), 10, 10);
+            grille.stamp(*PatternRegistry::get().find("glider"), 40, 40);
+            grille.stamp(*PatternRegistry::get().find("glider", PatternTransform::ROTATE_180), 60, 20);
+            EscapeDetector detecteur;
+            std::int64_t retires = detecteur.removeEscaping(grille, 0, false);
+            afficherResultat("Planeur qui s'éloigne retiré, planeur qui s'approche conservé", 
+                retires == 1 && grille.countLivingCells() == 4 + 5 && !grille.isAlive(41, 40));
+            afficherResultat("Vaisseau retiré enregistré avec son type", 
+                detecteur.getEscaped().size() == 1 && detecteur.getEscaped()[0].type.name == "glider" &&
+                detecteur.getEscaped()[0].x == 40 && detecteur.getCensus().front().count == 1);
+        }
+        
+        // Test 2: Deux vaisseaux face à face ne sont pas retirés
+        {
+            BitGrid grille(100, 100);
+            grille.stamp(*PatternRegistry::get().find("glider"), 10, 10);
+            grille.stamp(*PatternRegistry::get().find("glider", PatternTransform::ROTATE_180), 60, 60);
+            EscapeDetector detecteur;
+            afficherResultat("Vaisseaux sur une trajectoire de collision conservés", 
+                detecteur.removeEscaping(grille, 0, false) == 0 && grille.countLivingCells() == 10);
+            afficherResultat("Vaisseaux face à face : pas un état final en vol", 
+                !detecteur.remainingShipsLeave());
+            
+            // Deux planeurs qui s'écartent, encore dans la marge : conservés, état final en vol
+            BitGrid ecart(100, 100);
+            ecart.stamp(*PatternRegistry::get().find("block"), 10, 80);
+            ecart.stamp(*PatternRegistry::get().find("glider"), 50, 50);
+            ecart.stamp(*PatternRegistry::get().find("glider", PatternTransform::ROTATE_180), 50, 44);
+            EscapeDetector proche(20);
+            afficherResultat("Planeurs qui s'écartent dans la marge : état final en vol, période 4", 
+                proche.removeEscaping(ecart, 0, false) == 0 && proche.remainingShipsLeave() &&
+                proche.getRemainingPeriod() == 4);
+        }
+        
+        // Test 3: Deux planeurs qui se suivent en diagonale, à une cellule d'écart
+        {
+            BitGrid grille(100, 100);
+            grille.stamp(*PatternRegistry::get().find("block"), 10, 10);
+            grille.stamp(*PatternRegistry::get().find("glider"), 40, 40);
+            grille.stamp(*PatternRegistry::get().find("glider"), 44, 44);
+            EscapeDetector detecteur;
+            afficherResultat("Planeurs en file retirés ensemble", 
+                detecteur.removeEscaping(grille, 0, false) == 2 && grille.countLivingCells() == 4 &&
+                detecteur.getEscaped().size() == 2);
+        }
+        
+        // Test 4: Le jeu se stabilise une fois le planeur retiré
+        {
+            GameOfLife jeu(120, 120);
+            jeu.getGrid().placePattern("blinker", 10, 10);
+            jeu.getGrid().placePattern("glider", 50, 50);
+            jeu.setEscapeRemoval(true);
+            for (int i = 0; i < GameOfLife::ESCAPE_CHECK_INTERVAL; ++i) {
+                jeu.step();
+            }
+            jeu.step();
+            jeu.step();
+            afficherResultat("GameOfLife retire le planeur et détecte le cycle", 
+                jeu.getEscapedShips().size() == 1 && jeu.getGrid().countLivingCells() == 3 &&
+                jeu.getDetectedCycleLength() > 0);
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DE LA DÉTECTION DE STABILISATION (StabilizationDetector)
+    // =========================================================================
+    
+    void testerStabilisation() {
+        afficherSection("TESTS : Détection de Stabilisation");
+        
+        // Test 1: Période et génération de stabilisation sur une suite d'empreintes
+        {
+            StabilizationDetector detecteur(8, 4);
+            const std::uint64_t empreintes[] = {11, 22, 33, 44, 55, 44, 55, 44, 55, 44, 55};
+            bool stable = false;
+            std::int64_t arret = -1;
+            for (std::int64_t g = 0; g < 11 && !stable; ++g) {
+                stable = detecteur.observe(empreintes[g], g);
+                arret = g;
+            }
+            afficherResultat("Cycle de période 2 confirmé après la fenêtre", 
+                stable && detecteur.getPeriod() == 2 && arret == 8);
+            afficherResultat("Génération de stabilisation = début du cycle", 
+                detecteur.getSettledGeneration() == 3);
+        }
+        
+        // Test 2: Une répétition isolée n'est pas confirmée
+        {
+            StabilizationDetector detecteur(8, 3);
+            const std::uint64_t empreintes[] = {1, 2, 1, 3, 4, 5};
+            bool stable = false;
+            for (std::int64_t g = 0; g < 6; ++g) {
+                stable = detecteur.observe(empreintes[g], g) || stable;
+            }
+            afficherResultat("Répétition isolée ignorée", !stable && detecteur.getPeriod() == 0);
+        }
+        
+        // Test 3: BitGrid et Grid ont la même empreinte
+        {
+            Grid grille(70, 20);
+            grille.placePattern("glider", 60, 5);
+            BitGrid compacte(70, 20);
+            compacte.fromGrid(grille);
+            afficherResultat("BitGrid::hash identique à GridView::hash", 
+                compacte.hash() == GridView(grille).hash());
+        }
+        
+        // Test 4: Arrêt compté en générations, indépendamment du temps réel
+        {
+            GameOfLife jeu(30, 30);
+            jeu.getGrid().placePattern("blinker", 10, 10);
+            jeu.resetStagnationTimer();
+            jeu.setStabilizationWindow(10);
+            int pas = 0;
+            while (!jeu.getHasStoppedEvolving() && pas < 100) {
+                jeu.step();
+                ++pas;
+            }
+            afficherResultat("GameOfLife s'arrête après la fenêtre de générations", 
+                jeu.getHasStoppedEvolving() && pas == 11 && jeu.getSettledGeneration() == 0 &&
+                jeu.getDetectedCycleLength() == 2 && jeu.getIsPaused());
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DE LA DURÉE DE VIE DES MATHUSALEMS (LifespanMeter)
+    // =========================================================================
+    
+    void testerDureeDeVie() {
+        afficherSection("TESTS : Durée de Vie des Mathusalems");
+        
+        LifespanMeter mesure(5000);
+        
+        // Test 1: R-pentomino (valeurs de référence : génération 1103, 116 cellules, 6 planeurs)
+        {
+            LifespanResult resultat = mesure.measure(*PatternRegistry::get().find("r_pentomino"));
+            std::int64_t planeurs = 0;
+            for (const CensusEntry& entree : resultat.census) {
+                if (entree.type.name == "glider") planeurs = entree.count;
+            }
+            afficherResultat("R-pentomino stabilisé à la génération 1103", 
+                resultat.settled && resultat.settleGeneration == 1103 && resultat.period == 2);
+            afficherResultat("R-pentomino : population finale 116 dont 6 planeurs", 
+                resultat.finalPopulation == 116 && planeurs == 6);
+        }
+        
+        // Test 2: Diehard disparaît à la génération 130
+        {
+            LifespanResult resultat = mesure.measure(*PatternRegistry::get().find("diehard"));
+            afficherResultat("Diehard s'éteint à la génération 130", 
+                resultat.settled && resultat.settleGeneration == 130 && resultat.finalPopulation == 0 &&
+                resultat.census.empty());
+        }
+        
+        // Test 3: Limite de générations et mesure de plusieurs motifs
+        {
+            LifespanMeter courte(100);
+            std::vector<PatternBitmap> motifs;
+            motifs.push_back(*PatternRegistry::get().find("r_pentomino"));
+            motifs.push_back(*PatternRegistry::get().find("blinker"));
+            std::vector<LifespanResult> resultats = courte.measureAll(motifs);
+            afficherResultat("Limite atteinte : motif non stabilisé", 
+                resultats.size() == 2 && !resultats[0].settled && resultats[0].settleGeneration == -1 &&
+                resultats[0].generations == 100);
+            afficherResultat("Résultats dans l'ordre des motifs", 
+                resultats[1].name == "blinker" && resultats[1].settled && resultats[1].settleGeneration == 0 &&
+                resultats[1].period == 2);
+        }
+        
+        // Test 4: Univers plafonné ; soupe aux planeurs en file (graine 803) mesurée sans s'étendre
+        {
+            LifespanResult plafonne = LifespanMeter(5000, 200).measure(*PatternRegistry::get().find("r_pentomino"));
+            afficherResultat("Univers plafonné : mesure arrêtée, non stabilisée", 
+                !plafonne.settled && plafonne.capped && plafonne.width <= 200 && plafonne.generations < 5000);
+            LifespanResult soupe = LifespanMeter(20000).measure(SoupSearch(16, 16, 0.3, 20000).makeSoup(803));
+            afficherResultat("Soupe 803 stabilisée dans un univers borné", 
+                soupe.settled && !soupe.capped && soupe.width <= LifespanMeter::MAX_UNIVERSE_SIZE);
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DE LA RECHERCHE DE SOUPES (SoupSearch)
+    // =========================================================================
+    
+    void testerRechercheSoupes() {
+        afficherSection("TESTS : Recherche de Soupes");
+        
+        SoupSearch recherche(16, 16, 0.5, 2000);
+        
+        // Test 1: Une graine donne toujours la même soupe
+        {
+            PatternBitmap a = recherche.makeSoup(42);
+            PatternBitmap b = recherche.makeSoup(42);
+            PatternBitmap c = recherche.makeSoup(43);
+            afficherResultat("Soupe reproductible à partir de sa graine", 
+                a.words == b.words && a.words != c.words && a.countLivingCells() > 0);
+        }
+        
+        // Test 2: Le découpage en tranches ne change pas le résultat
+        {
+            SoupStatistics ensemble = recherche.run(1, 6);
+            SoupStatistics parties = recherche.run(1, 3);
+            parties.merge(recherche.run(4, 3));
+            bool memeRecensement = ensemble.census.size() == parties.census.size();
+            for (const auto& entree : ensemble.census) {
+                memeRecensement = memeRecensement && parties.census.count(entree.first) == 1 &&
+                                  parties.census[entree.first].count == entree.second.count;
+            }
+            afficherResultat("Statistiques identiques quel que soit le découpage", 
+                ensemble.soups == 6 && parties.soups == 6 && ensemble.settled == parties.settled &&
+                ensemble.totalSettleGeneration == parties.totalSettleGeneration && memeRecensement);
+            
+            std::int64_t histogramme = 0;
+            for (std::int64_t nombre : ensemble.lifespanHistogram) histogramme += nombre;
+            afficherResultat("Histogramme des durées de vie complet", histogramme == ensemble.settled);
+        }
+        
+        // Test 3: Tranches de l'histogramme (puissances de deux)
+        {
+            afficherResultat("Tranches de durée de vie", 
+                SoupStatistics::bucketOf(0) == 0 && SoupStatistics::bucketOf(1) == 1 &&
+                SoupStatistics::bucketOf(2) == 1 && SoupStatistics::bucketOf(3) == 2 &&
+                SoupStatistics::bucketOf(1103) == 10);
+        }
+    }
+    
+    // =========================================================================
+    // TESTS DU BALAYAGE DE PARAMÈTRES (ParameterSweep)
+    // =========================================================================
+    
+    void testerBalayage() {
+        afficherSection("TESTS : Balayage de Paramètres");
+        
+        // Test 1: Décodage des plages
+        {
+            std::vector<double> densites;
+            std::vector<std::string> regles;
+            std::vector<std::pair<std::int64_t, std::int64_t>> tailles;
+            bool ok = ParameterSweep::parseDensities("0.1:0.5:0.1", densites) &&
+                      ParameterSweep::parseRules("all", regles) &&
+                      ParameterSweep::parseSizes("32x32:128x128", tailles);
+            afficherResultat("Plages de densités, règles et tailles décodées", 
+                ok && densites.size() == 5 && regles.size() == RuleFactory::getAvailableRules().size() &&
+                tailles.size() == 3 && tailles.back().first == 128);
+            afficherResultat("Règle inconnue refusée", !ParameterSweep::parseRules("classic,inconnue", regles));
+            bool notation = ParameterSweep::parseRules("maze,B36/S23", regles) && regles.size() == 2;
+            std::unique_ptr<Rule> regle = ParameterSweep::createRule("B36/S23");
+            afficherResultat("Notation B/S acceptée comme règle du balayage", 
+                notation && regle && regle->getBirthMask() == HighLifeRule().getBirthMask());
+        }
+        
+        // Test 2: Calculs triés par coût, graines fixées par la position dans le produit
+        {
+            ParameterSweep balayage(500);
+            std::vector<std::pair<std::int64_t, std::int64_t>> tailles = {{32, 32}, {256, 64}};
+            std::vector<SweepJob> calculs = balayage.plan({0.3, 0.5}, {"classic", "highlife"}, tailles, 2, 100);
+            bool trie = true;
+            bool graines = true;
+            for (size_t i = 0; i < calculs.size(); ++i) {
+                if (i > 0) trie = trie && calculs[i - 1].estimatedCost >= calculs[i].estimatedCost;
+                graines = graines && calculs[i].seed == 100 + static_cast<std::uint64_t>(calculs[i].index);
+            }
+            afficherResultat("Produit cartésien trié du plus coûteux au moins coûteux", 
+                calculs.size() == 16 && trie && calculs.front().width == 256);
+            afficherResultat("Graine propre à chaque combinaison", graines);
+        }
+        
+        // Test 3: Exécution parallèle reproductible et CSV complet
+        {
+            ParameterSweep balayage(500);
+            std::vector<std::pair<std::int64_t, std::int64_t>> tailles = {{48, 48}};
+            std::vector<SweepJob> calculs = balayage.plan({0.2, 0.4}, {"classic", "maze"}, tailles, 1, 7);
+            std::ostringstream csv;
+            std::vector<SweepResult> resultats = balayage.run(calculs, csv);
+            SweepResult seul = balayage.runJob(calculs[1]);
+            std::int64_t lignes = 0;
+            for (char c : csv.str()) {
+                if (c == '\n') ++lignes;
+            }
+            afficherResultat("Une ligne CSV par calcul (plus l'en-tête)", 
+                resultats.size() == 4 && lignes == 5);
+            afficherResultat("Résultat identique en parallèle et seul", 
+                resultats[1].finalPopulation == seul.finalPopulation &&
+                resultats[1].generations == seul.generations &&
+                resultats[1].settleGeneration == seul.settleGeneration);
+        }
+    }
+    
+    // =========================================================================
+    // TESTS : SÉRIE TEMPORELLE DES STATISTIQUES
+    // =========================================================================
+    
+    /**
+     * @brief Teste l'écriture en arrière-plan de la série population / naissances / morts
+     */
+    void testerStatistiques() {
+        afficherSection("TESTS : Série Temporelle des Statistiques");
+        
+        // Test 1: Naissances et morts d'un clignotant
+        {
+            BitGrid grille(8, 8);
+            grille.setAlive(2, 3, true);
+            grille.setAlive(3, 3, true);
+            grille.setAlive(4, 3, true);
+            grille.step();
+            std::int64_t naissances = 0;
+            std::int64_t morts = 0;
+            grille.countChanges(naissances, morts);
+            afficherResultat("Clignotant : 2 naissances et 2 morts par génération", 
+                naissances == 2 && morts == 2 && grille.countLivingCells() == 3);
+        }
+        
+        // Test 2: Aller-retour binaire sur plusieurs lots
+        {
+            const std::int64_t total = static_cast<std::int64_t>(StatisticsSink::BATCH_RECORDS) * 2 + 17;
+            StatisticsSink sortie;
+            bool ouvert = sortie.open("test_statistiques_temp.bin");
+            for (std::int64_t g = 0; g < total; ++g) {
+                sortie.record({g, g * 3, g % 5, g % 7});
+            }
+            bool ecrit = sortie.close();
+            std::vector<GenerationRecord> relus;
+            bool relu = StatisticsSink::readBinary("test_statistiques_temp.bin", relus);
+            bool identique = relus.size() == static_cast<size_t>(total);
+            for (size_t i = 0; identique && i < relus.size(); ++i) {
+                const std::int64_t g = static_cast<std::int64_t>(i);
+                identique = relus[i].generation == g && relus[i].population == g * 3 &&
+                            relus[i].births == g % 5 && relus[i].deaths == g % 7;
+            }
+            afficherResultat("Série binaire relue à l'identique, dans l'ordre", 
+                ouvert && ecrit && relu && identique);
+            std::remove("test_statistiques_temp.bin");
+        }
+        
+        // Test 3: CSV avec intervalle d'enregistrement
+        {
+            StatisticsSink sortie;
+            bool ouvert = sortie.open("test_statistiques_temp.csv", 10);
+            for (std::int64_t g = 0; g <= 100; ++g) {
+                if (sortie.wants(g)) sortie.record({g, 1, 0, 0});
+            }
+            sortie.close();
+            std::ifstream fichier("test_statistiques_temp.csv");
+            std::string entete;
+            std::getline(fichier, entete);
+            std::int64_t lignes = 0;
+            std::string ligne;
+            std::string derniere;
+            while (std::getline(fichier, ligne)) {
+                ++lignes;
+                derniere = ligne;
+            }
+            afficherResultat("CSV : en-tête puis une ligne toutes les 10 générations", 
+                ouvert && entete == "generation,population,births,deaths" &&
+                lignes == 11 && derniere == "100,1,0,0");
+            std::remove("test_statistiques_temp.csv");
+        }
+    }
+    
+    // =========================================================================
+    // TESTS : CARTE D'ACTIVITÉ
+    // =========================================================================
+    
+    /**
+     * @brief Teste le cumul des changements d'état dans le noyau et dans Grid
+     */
+    void testerCarteActivite() {
+        afficherSection("TESTS : Carte d'Activité");
+        
+        // Test 1: Clignotant : seules les 4 cellules qui alternent s'allument
+        {
+            BitGrid grille(8, 8);
+            grille.setParallelMode(false);
+            grille.setAlive(2, 3, true);
+            grille.setAlive(3, 3, true);
+            grille.setAlive(4, 3, true);
+            grille.setHeatMapEnabled(true);
+            grille.step(10);
+            const HeatMap& carte = *grille.getHeatMap();
+            afficherResultat("Clignotant : 10 changements aux extrémités, 0 au centre", 
+                carte.get(2, 3) == 10 && carte.get(3, 2) == 10 && carte.get(3, 4) == 10 &&
+                carte.get(3, 3) == 0 && carte.getMax() == 10);
+        }
+        
+        // Test 2: Même carte pour BitGrid (par mots, en parallèle) et Grid (par cellule)
+        {
+            Grid grille(130, 90);
+            grille.randomize(0.35, 21);
+            grille.setParallelMode(false);
+            BitGrid compacte(130, 90);
+            compacte.fromGrid(grille);
+            compacte.setParallelMode(true);
+            compacte.setHeatMapEnabled(true);
+            HeatMap reference(130, 90);
+            for (int g = 0; g < 40; ++g) {
+                Grid avant(grille);
+                grille.computeNextGeneration();
+                grille.update();
+                reference.accumulate(avant, grille);
+                compacte.step();
+            }
+            bool identique = true;
+            for (std::int64_t y = 0; y < 90 && identique; ++y) {
+                for (std::int64_t x = 0; x < 130 && identique; ++x) {
+                    identique = compacte.getHeatMap()->get(x, y) == reference.get(x, y);
+                }
+            }
+            afficherResultat("Carte identique entre BitGrid et Grid", identique && reference.getMax() > 0);
+        }
+        
+        // Test 3: Tuiles : somme des changements de chaque tuile 8x8, calcul parallèle
+        {
+            BitGrid grille(300, 260);
+            grille.randomize(0.4, 5);
+            grille.setParallelMode(false);
+            BitGrid tuiles(grille);
+            tuiles.setParallelMode(true);
+            grille.setHeatMapEnabled(true);
+            tuiles.setHeatMapEnabled(true, HeatMap::Resolution::TILE);
+            grille.step(30);
+            tuiles.step(30);
+            const HeatMap& carte = *tuiles.getHeatMap();
+            bool sommes = carte.getColumns() == 38 && carte.getRows() == 33;
+            for (std::int64_t ty = 0; ty < carte.getRows() && sommes; ++ty) {
+                for (std::int64_t tx = 0; tx < carte.getColumns() && sommes; ++tx) {
+                    unsigned total = 0;
+                    for (std::int64_t y = ty * 8; y < std::min<std::int64_t>(260, ty * 8 + 8); ++y) {
+                        for (std::int64_t x = tx * 8; x < std::min<std::int64_t>(300, tx * 8 + 8); ++x) {
+                            total += grille.getHeatMap()->get(x, y);
+                        }
+                    }
+                    sommes = carte.get(tx * 8, ty * 8) == total;
+                }
+            }
+            afficherResultat("Tuile = somme des compteurs de ses cellules", sommes && carte.getMax() > 0);
+        }
+        
+        // Test 4: Saturation des compteurs
+        {
+            BitGrid grille(8, 8);
+            grille.setParallelMode(false);
+            grille.setAlive(2, 3, true);
+            grille.setAlive(3, 3, true);
+            grille.setAlive(4, 3, true);
+            grille.setHeatMapEnabled(true);
+            grille.step(static_cast<std::int64_t>(HeatMap::MAX_COUNT) + 100);
+            afficherResultat("Compteur bloqué à MAX_COUNT", 
+                grille.getHeatMap()->get(2, 3) == HeatMap::MAX_COUNT);
+        }
+        
+        // Test 5: Export PGM
+        {
+            HeatMap carte(5, 3);
+            Grid avant(5, 3);
+            Grid apres(5, 3);
+            apres.getCell(1, 1).setAlive(true);
+            carte.accumulate(avant, apres);
+            bool ecrit = carte.savePGM("test_carte_temp.pgm");
+            std::ifstream fichier("test_carte_temp.pgm", std::ios::binary);
+            std::string contenu((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+            const std::string entete = "P5\n5 3\n255\n";
+            afficherResultat("PGM : en-tête, une valeur par cellule, maximum à 255", 
+                ecrit && contenu.size() == entete.size() + 15 && contenu.compare(0, entete.size(), entete) == 0 &&
+                static_cast<unsigned char>(contenu[entete.size() + 6]) == 255 && contenu[entete.size()] == 0);
+            std::remove("test_carte_temp.pgm");
+        }
+    }
+    
+    // =========================================================================
+    // TESTS : LECTURE RAPIDE DES GRILLES TEXTE
+    // =========================================================================
+    
+    /**
+     * @brief Teste l'analyseur de grilles texte (série et parallèle)
+     */
+    void testerLectureTexte() {
+        afficherSection("TESTS : Lecture Rapide des Grilles Texte");
+        
+        // Valeur attendue de la cellule (x, y) dans les grilles générées
+        auto valeur = [](std::int64_t x, std::int64_t y) {
+            return static_cast<int>(CounterRNG::mix(static_cast<std::uint64_t>(y * 7919 + x)) % 5);
+        };
+        
+        // Test 1: Blancs variés, signes et zéros en tête, valeurs hors 0..3 mortes
+        {
+            std::ofstream fichier("test_lecture_temp.txt");
+            fichier << "  3\t70\r\n";
+            for (std::int64_t y = 0; y < 3; ++y) {
+                for (std::int64_t x = 0; x < 70; ++x) {
+                    int v = valeur(x, y);
+                    fichier << (x % 9 == 4 && v != 4 ? "+0" : "") << (v == 4 ? -7 : v) << (x % 3 == 0 ? "\t " : " ");
+                }
+                fichier << "\r\n";
+            }
+            fichier.close();
+            TextGridParser lecteur;
+            Grid grille(1, 1);
+            bool lu = lecteur.parse("test_lecture_temp.txt") && lecteur.toGrid(grille);
+            bool identique = lu && grille.getWidth() == 70 && grille.getHeight() == 3 && lecteur.hasObstacles();
+            for (std::int64_t y = 0; y < 3 && identique; ++y) {
+                for (std::int64_t x = 0; x < 70 && identique; ++x) {
+                    int v = valeur(x, y);
+                    identique = grille.getCell(x, y).isAlive() == (v == 1 || v == 3) &&
+                                grille.getCell(x, y).isObstacle() == (v == 2 || v == 3);
+                }
+            }
+            afficherResultat("Grille texte lue cellule par cellule", identique);
+            std::remove("test_lecture_temp.txt");
+        }
+        
+        // Test 2: Grand fichier découpé en tranches parallèles
+        {
+            const std::int64_t largeur = 1501;
+            const std::int64_t hauteur = 1600;
+            std::string texte = std::to_string(hauteur) + " " + std::to_string(largeur) + "\n";
+            texte.reserve(static_cast<size_t>(largeur * hauteur * 2 + 64));
+            for (std::int64_t y = 0; y < hauteur; ++y) {
+                for (std::int64_t x = 0; x < largeur; ++x) {
+                    texte += static_cast<char>('0' + valeur(x, y) % 4);
+                    texte += (x == largeur - 1) ? '\n' : ' ';
+                }
+            }
+            texte += "1 1 1\n";  // Jetons en trop : ignorés
+            TextGridParser lecteur;
+            lecteur.setParallelMode(true);
+            bool lu = texte.size() > TextGridParser::PARALLEL_BYTES && lecteur.parse(texte.data(), texte.size());
+            std::unique_ptr<BitGrid> compacte = lu ? lecteur.toBitGrid() : nullptr;
+            bool identique = compacte && compacte->getWidth() == largeur && compacte->hasObstacles();
+            for (std::int64_t y = 0; y < hauteur && identique; ++y) {
+                for (std::int64_t x = 0; x < largeur && identique; ++x) {
+                    int v = valeur(x, y) % 4;
+                    identique = compacte->isAlive(x, y) == (v == 1 || v == 3) &&
+                                compacte->isObstacle(x, y) == (v == 2 || v == 3);
+                }
+            }
+            afficherResultat("Lecture parallèle identique à la grille écrite", identique);
+        }
+        
+        // Test 3: Données manquantes ou jeton invalide refusés
+        {
+            const std::string courtes = "2 3\n1 0 1\n0 1\n";
+            const std::string invalides = "2 3\n1 0 1\n0 x 1\n";
+            const std::string entete = "2 trois\n1 0 1\n0 1 1\n";
+            TextGridParser lecteur;
+            afficherResultat("Données insuffisantes ou invalides refusées", 
+                !lecteur.parse(courtes.data(), courtes.size()) &&
+                !lecteur.parse(invalides.data(), invalides.size()) &&
+                !lecteur.parse(entete.data(), entete.size()));
+        }
+        
+        // Test 4: loadBitGrid équivalent à load puis fromGrid
+        {
+            Grid grille(90, 40);
+            grille.randomize(0.3, 8);
+            StandardFileHandler gestionnaire;
+            gestionnaire.save("test_lecture_temp.txt", grille);
+            std::unique_ptr<BitGrid> compacte = gestionnaire.loadBitGrid("test_lecture_temp.txt");
+            Grid relue(1, 1);
+            bool lu = compacte && gestionnaire.load("test_lecture_temp.txt", relue);
+            bool identique = lu && relue.getWidth() == 90 && relue.getHeight() == 40 && !compacte->hasObstacles();
+            for (std::int64_t y = 0; y < 40 && identique; ++y) {
+                for (std::int64_t x = 0; x < 90 && identique; ++x) {
+                    identique = compacte->isAlive(x, y) == grille.getCell(x, y).isAlive() &&
+                                relue.getCell(x, y).isAlive() == grille.getCell(x, y).isAlive();
+                }
+            }
+            afficherResultat("loadBitGrid et load relisent la grille sauvegardée", identique);
+            std::remove("test_lecture_temp.txt");
+        }
+    }
+    
+    // =========================================================================
+    // TESTS : ÉCRITURE DES GRILLES TEXTE
+    // =========================================================================
+    
+    /**
+     * @brief Teste l'écriture en un bloc contre l'ancienne écriture par operator<<
+     */
+    void testerEcritureTexte() {
+        afficherSection("TESTS : Écriture des Grilles Texte");
+        
+        // Ancienne écriture, cellule par cellule
+        auto reference = [](const GridView& vue) {
+            std::ostringstream texte;
+            texte << vue.getHeight() << " " << vue.getWidth() << std::endl;
+            for (std::int64_t y = 0; y < vue.getHeight(); ++y) {
+                for (std::int64_t x = 0; x < vue.getWidth(); ++x) {
+                    const Cell& cellule = vue.at(x, y);
+                    texte << (cellule.isObstacle() ? 2 : 0) + (cellule.isAlive() ? 1 : 0);
+                    if (x < vue.getWidth() - 1) {
+                        texte << " ";
+                    }
+                }
+                texte << std::endl;
+            }
+            return texte.str();
+        };
+        
+        Grid grille(77, 9);
+        grille.randomize(0.4, 12);
+        grille.getCell(5, 2).setObstacle(true);
+        grille.getCell(76, 8).setObstacle(true);
+        grille.getCell(64, 0).setObstacle(true);
+        
+        // Test 1: Grille et vue échantillonnée identiques octet pour octet
+        {
+            TextGridWriter ecrivain;
+            GridView vue(grille, 3, 1, 30, 4, 2, 2);
+            afficherResultat("Texte identique à l'ancienne écriture (grille et vue)", 
+                ecrivain.format(GridView(grille)) == reference(GridView(grille)) &&
+                ecrivain.format(vue) == reference(vue));
+        }
+        
+        // Test 2: Tampon réutilisé pour une grille plus petite
+        {
+            TextGridWriter ecrivain;
+            Grid petite(1, 3);
+            petite.getCell(0, 1).setAlive(true);
+            ecrivain.format(GridView(grille));
+            afficherResultat("Tampon réutilisé sans reste de la grille précédente", 
+                ecrivain.format(GridView(petite)) == "3 1\n0\n1\n0\n");
+        }
+        
+        // Test 3: BitGrid écrite depuis ses lignes de bits = même fichier
+        {
+            BitGrid compacte(1, 1);
+            compacte.fromGrid(grille);
+            TextGridWriter ecrivain;
+            bool ecrit = ecrivain.write("test_ecriture_temp.txt", compacte);
+            std::ifstream fichier("test_ecriture_temp.txt", std::ios::binary);
+            std::string contenu((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+            afficherResultat("BitGrid écrite comme la grille d'origine", 
+                ecrit && contenu == reference(GridView(grille)));
+            std::remove("test_ecriture_temp.txt");
+        }
+    }
+    
+    // =========================================================================
+    // TESTS : ÉCRITURE EN ARRIÈRE-PLAN
+    // =========================================================================
+    
+    /**
+     * @brief Teste la file bornée d'écriture des générations
+     */
+    void testerEcritureAsynchrone() {
+        afficherSection("TESTS : Écriture en Arrière-Plan");
+        
+        auto lire = [](const std::string& nom) {
+            std::ifstream fichier(nom, std::ios::binary);
+            return std::string((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+        };
+        
+        // Test 1: File de 2 places, 2 threads : chaque fichier = écriture directe
+        {
+            Grid grille(70, 40);
+            grille.randomize(0.35, 4);
+            grille.getCell(3, 3).setObstacle(true);
+            AsyncGridWriter ecrivain;
+            ecrivain.start(2, 2);
+            std::vector<std::string> attendus;
+            TextGridWriter direct;
+            for (int g = 0; g < 12; ++g) {
+                attendus.push_back(direct.format(GridView(grille)));
+                ecrivain.submit("test_async_temp_" + std::to_string(g) + ".txt", grille);
+                grille.computeNextGeneration();
+                grille.update();
+            }
+            bool ferme = ecrivain.close();
+            bool identique = ecrivain.getWrittenCount() == 12;
+            for (int g = 0; g < 12; ++g) {
+                const std::string nom = "test_async_temp_" + std::to_string(g) + ".txt";
+                identique = identique && lire(nom) == attendus[g];
+                std::remove(nom.c_str());
+            }
+            afficherResultat("Générations écrites telles qu'au moment de submit", ferme && identique);
+        }
+        
+        // Test 2: BitGrid, et écriture directe quand aucun thread n'est démarré
+        {
+            BitGrid compacte(90, 20);
+            compacte.randomize(0.4, 9);
+            AsyncGridWriter direct;
+            direct.submit("test_async_temp_a.txt", compacte);
+            AsyncGridWriter fond;
+            fond.start();
+            fond.submit("test_async_temp_b.txt", compacte);
+            compacte.step();
+            fond.close();
+            Grid grille(1, 1);
+            compacte.toGrid(grille);
+            const std::string a = lire("test_async_temp_a.txt");
+            afficherResultat("BitGrid capturée avant l'étape suivante", 
+                !direct.isRunning() && direct.getWrittenCount() == 1 && !a.empty() &&
+                a == lire("test_async_temp_b.txt") && a != TextGridWriter().format(GridView(grille)));
+            std::remove("test_async_temp_a.txt");
+            std::remove("test_async_temp_b.txt");
+        }
+    }
+    
+    // =========================================================================
+    // TESTS : ARCHIVE DES GÉNÉRATIONS
+    // =========================================================================
+    
+    /**
+     * @brief Teste l'archive .gola (deltas XOR, index, extraction)
+     */
+    void testerArchiveGenerations() {
+        afficherSection("TESTS : Archive des Générations");
+        
+        auto lire = [](const std::string& nom) {
+            std::ifstream fichier(nom, std::ios::binary);
+            return std::string((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+        };
+        
+        // Test 1: Compression aller-retour, directe et combinée par XOR
+        {
+            std::vector<std::uint8_t> donnees(5000, 0);
+            for (size_t i = 0; i < donnees.size(); i += 37) donnees[i] = static_cast<std::uint8_t>(i | 1);
+            for (size_t i = 4000; i < 4100; ++i) donnees[i] = static_cast<std::uint8_t>(i * 7);
+            std::vector<std::uint8_t> code;
+            GenerationArchive::encode(donnees.data(), donnees.size(), code);
+            std::vector<std::uint8_t> sortie(donnees.size(), 0xAA);
+            const std::uint8_t* lecture = code.data();
+            bool direct = GenerationArchive::decode(lecture, code.data() + code.size(), sortie.data(), sortie.size(), false) &&
+                          lecture == code.data() + code.size() && sortie == donnees;
+            lecture = code.data();
+            bool combine = GenerationArchive::decode(lecture, code.data() + code.size(), sortie.data(), sortie.size(), true) &&
+                           std::all_of(sortie.begin(), sortie.end(), [](std::uint8_t o) { return o == 0; });
+            lecture = code.data();
+            bool tronque = !GenerationArchive::decode(lecture, code.data() + code.size() / 2, sortie.data(), sortie.size(), false);
+            afficherResultat("Plages nulles et littéraux : aller-retour, XOR, données tronquées", 
+                direct && combine && tronque && code.size() < donnees.size() / 2);
+        }
+        
+        // Générations de référence : soupe avec obstacle, images clés toutes les 16
+        Grid grille(100, 37);
+        grille.randomize(0.35, 12);
+        grille.getCell(50, 20).setObstacle(true);
+        std::vector<GridSnapshot> attendues(150);
+        GenerationArchiveWriter ecrivain;
+        bool ecrit = ecrivain.open("test_archive_temp.gola", 16);
+        for (size_t g = 0; g < attendues.size(); ++g) {
+            attendues[g].capture(grille);
+            ecrit = ecrit && ecrivain.append(grille);
+            grille.computeNextGeneration();
+            grille.update();
+        }
+        const std::uint64_t sansIndex = ecrivain.getBytesWritten();
+        ecrit = ecrit && ecrivain.close();
+        
+        auto identiques = [](const GridSnapshot& a, const GridSnapshot& b) {
+            if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight() ||
+                a.hasObstacles() != b.hasObstacles()) {
+                return false;
+            }
+            const size_t octets = static_cast<size_t>(a.getWordsPerRow() * a.getHeight()) * sizeof(std::uint64_t);
+            return std::memcmp(a.aliveRow(0), b.aliveRow(0), octets) == 0 &&
+                   (!a.hasObstacles() || std::memcmp(a.obstacleRow(0), b.obstacleRow(0), octets) == 0);
+        };
+        
+        // Test 2: Accès direct dans le désordre
+        {
+            GenerationArchiveReader lecteur;
+            bool ouvert = lecteur.open("test_archive_temp.gola");
+            bool identique = ouvert && lecteur.getGenerationCount() == 150 && lecteur.getWidth() == 100;
+            GridSnapshot relue;
+            for (std::int64_t g : {149, 3, 64, 65, 0, 47, 48, 149}) {
+                identique = identique && lecteur.read(g, relue) && identiques(relue, attendues[g]);
+            }
+            afficherResultat("Générations relues dans le désordre depuis les images clés", 
+                ecrit && identique && !lecteur.read(150, relue));
+        }
+        
+        // Test 3: Archive interrompue (sans index) relue en parcourant les trames
+        {
+            const std::string contenu = lire("test_archive_temp.gola");
+            std::ofstream("test_archive_temp.gola", std::ios::binary).write(contenu.data(),
+                static_cast<std::streamsize>(sansIndex));
+            GenerationArchiveReader lecteur;
+            GridSnapshot relue;
+            bool identique = lecteur.open("test_archive_temp.gola") && lecteur.getGenerationCount() == 150;
+            for (std::int64_t g = 0; g < 150 && identique; ++g) {
+                identique = lecteur.read(g, relue) && identiques(relue, attendues[g]);
+            }
+            afficherResultat("Archive sans index relue en entier", identique);
+        }
+        
+        // Test 4: Extraction identique aux fichiers du mode console
+        {
+            GenerationArchiveReader lecteur;
+            bool extrait = lecteur.open("test_archive_temp.gola") &&
+                           lecteur.extract("test_archive_tmp", 10, 12) == 3;
+            TextGridWriter direct;
+            bool identique = extrait;
+            for (int g = 10; g <= 12; ++g) {
+                char nom[64];
+                std::snprintf(nom, sizeof(nom), "test_archive_tmp/generation_%06d.txt", g);
+                direct.write("test_archive_temp.txt", attendues[g]);
+                identique = identique && lire(nom) == lire("test_archive_temp.txt");
+                std::remove(nom);
+            }
+            rmdir("test_archive_tmp");
+            afficherResultat("Extraction : fichiers generation_XXXXXX.txt identiques", 
+                identique && lecteur.extract("test_archive_tmp", 300, 400) == -1);
+            std::remove("test_archive_temp.txt");
+        }
+        std::remove("test_archive_temp.gola");
+    }
+    
+    // =========================================================================
+    // TESTS : POLITIQUES D'ÉCRITURE DU MODE CONSOLE
+    // =========================================================================
+    
+    /**
+     * @brief Teste le choix des générations écrites par le mode console
+     */
+    void testerPolitiqueEcriture() {
+        afficherSection("TESTS : Politiques d'Écriture");
+        
+        auto suite = [](const OutputPolicy& politique, std::int64_t derniere) {
+            std::vector<std::int64_t> ecrites;
+            if (politique.writesInitial()) ecrites.push_back(0);
+            for (std::int64_t g = 0; g < derniere; ) {
+                g = politique.next(g, derniere);
+                ecrites.push_back(g);
+            }
+            return ecrites;
+        };
+        
+        // Test 1: Générations choisies par chaque politique
+        {
+            std::vector<std::int64_t> logarithmique = suite(OutputPolicy::logSpaced(), 250);
+            afficherResultat("--every, --log-spaced, --final-only : générations choisies", 
+                suite(OutputPolicy::every(100), 250) == std::vector<std::int64_t>({0, 100, 200, 250}) &&
+                suite(OutputPolicy::finalOnly(), 250) == std::vector<std::int64_t>({250}) &&
+                logarithmique.size() == 22 && logarithmique[9] == 9 && logarithmique[10] == 10 &&
+                logarithmique[18] == 90 && logarithmique[19] == 100 && logarithmique[20] == 200 &&
+                logarithmique.back() == 250);
+        }
+        
+        auto lire = [](const std::string& nom) {
+            std::ifstream fichier(nom, std::ios::binary);
+            return std::string((std::istreambuf_iterator<char>(fichier)), std::istreambuf_iterator<char>());
+        };
+        auto nomGeneration = [](int g) {
+            char nom[64];
+            std::snprintf(nom, sizeof(nom), "test_politique_temp_out/generation_%06d.txt", g);
+            return std::string(nom);
+        };
+        auto vider = [&nomGeneration]() {
+            for (int g = 0; g <= 40; ++g) std::remove(nomGeneration(g).c_str());
+            rmdir("test_politique_temp_out");
+        };
+        
+        // Soupe avec obstacle, bords non toriques
+        {
+            Grid grille(30, 20);
+            grille.randomize(0.4, 21);
+            grille.getCell(4, 4).setObstacle(true);
+            grille.saveToFile("test_politique_temp.txt");
+        }
+        
+        // Test 2: --every : mêmes fichiers que l'écriture complète, sans les autres
+        {
+            std::map<int, std::string> complets;
+            {
+                GameOfLife jeu(10, 10);
+                jeu.runConsoleMode("test_politique_temp.txt", 23);
+                for (int g : {0, 7, 14, 21, 23}) complets[g] = lire(nomGeneration(g));
+                vider();
+            }
+            GameOfLife jeu(10, 10);
+            bool reussi = jeu.runConsoleMode("test_politique_temp.txt", 23, false, false, OutputPolicy::every(7));
+            bool identique = reussi && !complets[23].empty();
+            for (const auto& fichier : complets) {
+                identique = identique && lire(nomGeneration(fichier.first)) == fichier.second;
+            }
+            std::ifstream absent(nomGeneration(8));
+            afficherResultat("--every 7 : générations 0, 7, 14, 21 et finale identiques", 
+                identique && !absent.is_open());
+            vider();
+        }
+        
+        // Test 3: --on-change : un bloc stable n'est écrit qu'au départ et à la fin
+        {
+            std::ofstream("test_politique_temp.txt") << "4 4\n0 0 0 0\n0 1 1 0\n0 1 1 0\n0 0 0 0\n";
+            GameOfLife jeu(10, 10);
+            bool reussi = jeu.runConsoleMode("test_politique_temp.txt", 30, false, false, OutputPolicy::onChange());
+            std::ifstream milieu(nomGeneration(15));
+            afficherResultat("--on-change : grille stable écrite aux générations 0 et 30 seulement", 
+                reussi && !lire(nomGeneration(0)).empty() && lire(nomGeneration(0)) == lire(nomGeneration(30)) &&
+                !milieu.is_open());
+            vider();
+        }
+        std::remove("test_politique_temp.txt");
+    }
+    
+    // =========================================================================
+    // TESTS : FORMAT BINAIRE COMPACT
+    // =========================================================================
+    
+    /**
+     * @brief Teste le format .golb et la notation B/S des règles
+     */
+    void testerFormatBinaire() {
+        afficherSection("TESTS : Format Binaire Compact");
+        
+        // Compare deux BitGrid (cellules, obstacles, état de simulation)
+        auto identiques = [](const BitGrid& a, const BitGrid& b) {
+            if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight() ||
+                a.getGeneration() != b.getGeneration() || a.isToricMode() != b.isToricMode() ||
+                a.getBirthMask() != b.getBirthMask() || a.getSurvivalMask() != b.getSurvivalMask()) {
+                return false;
+            }
+            for (std::int64_t y = 0; y < a.getHeight(); ++y) {
+                for (std::int64_t x = 0; x < a.getWidth(); ++x) {
+                    if (a.isAlive(x, y) != b.isAlive(x, y) || a.isObstacle(x, y) != b.isObstacle(x, y)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+        
+        // Test 1: Notation B/S
+        {
+            std::unique_ptr<Rule> highlife = RuleFactory::createFromString("B36/S23");
+            std::unique_ptr<Rule> seeds = RuleFactory::createFromString("b2/s");
+            std::unique_ptr<Rule> perso = RuleFactory::createFromString("B37/S23");
+            afficherResultat("Notation B/S : règles prédéfinies, personnalisées, invalides", 
+                highlife && highlife->getName() == "HighLife" && seeds && seeds->getName() == "Seeds" &&
+                perso && RuleFactory::toNotation(*perso) == "B37/S23" &&
+                RuleFactory::toNotation(MazeRule()) == "B3/S12345" &&
+                !RuleFactory::createFromString("B9/S23") && !RuleFactory::createFromString("B33/S23") &&
+                !RuleFactory::createFromString("B3S23"));
+        }
+        
+        BitGrid grille(200, 70);
+        grille.randomize(0.4, 31);
+        grille.setObstacle(10, 10, true);
+        grille.setObstacle(199, 69, true);
+        grille.setRule(HighLifeRule());
+        grille.setToricMode(true);
+        grille.setGeneration(17);
+        BinaryFileHandler gestionnaire;
+        bool ecrit = gestionnaire.saveBitGrid("test_binaire_temp.golb", grille);
+        
+        // Test 2: Aller-retour BitGrid, taille exacte du fichier
+        {
+            std::unique_ptr<BitGrid> relue = gestionnaire.loadBitGrid("test_binaire_temp.golb");
+            std::ifstream fichier("test_binaire_temp.golb", std::ios::binary | std::ios::ate);
+            const std::int64_t taille = static_cast<std::int64_t>(fichier.tellg());
+            afficherResultat("BitGrid relue à l'identique (règle, génération, tore, obstacles)", 
+                ecrit && relue && identiques(grille, *relue) &&
+                taille == static_cast<std::int64_t>(BinaryFileHandler::HEADER_BYTES) + 2 * 4 * 70 * 8);
+        }
+        
+        // Test 3: La grille projetée évolue sans modifier le fichier
+        {
+            std::unique_ptr<BitGrid> projetee = gestionnaire.loadBitGrid("test_binaire_temp.golb");
+            BitGrid reference(grille);
+            bool evolue = projetee != nullptr;
+            if (evolue) {
+                projetee->step(5);
+                reference.step(5);
+                evolue = identiques(reference, *projetee);
+            }
+            std::unique_ptr<BitGrid> relue = gestionnaire.loadBitGrid("test_binaire_temp.golb");
+            afficherResultat("Grille projetée calculée en copie sur écriture", 
+                evolue && relue && identiques(grille, *relue));
+        }
+        
+        // Test 4: Grid via la factory, fichier invalide refusé
+        {
+            Grid source(1, 1);
+            grille.toGrid(source);
+            source.setRule(std::make_unique<HighLifeRule>());
+            auto parExtension = FileHandlerFactory::createForFile("test_binaire_temp.golb");
+            bool sauve = parExtension->save("test_binaire_temp.golb", source);
+            Grid relue(1, 1);
+            bool charge = parExtension->load("test_binaire_temp.golb", relue);
+            bool identique = charge && relue.getWidth() == 200 && relue.getRule().getName() == "HighLife" &&
+                             relue.isToricMode();
+            for (std::int64_t y = 0; y < 70 && identique; ++y) {
+                for (std::int64_t x = 0; x < 200 && identique; ++x) {
+                    identique = relue.getCell(x, y).isAlive() == source.getCell(x, y).isAlive() &&
+                                relue.getCell(x, y).isObstacle() == source.getCell(x, y).isObstacle();
+                }
+            }
+            // Une grille non torique relue dans une grille torique la rend non torique
+            source.setToricMode(false);
+            bool plane = parExtension->save("test_binaire_temp.golb", source) &&
+                         parExtension->load("test_binaire_temp.golb", relue) && !relue.isToricMode();
+            std::ofstream("test_binaire_temp.golb") << "3 3\n0 1 0\n0 1 0\n0 1 0\n";
+            afficherResultat("Grid sauvegardée et relue via .golb (mode torique compris), texte refusé", 
+                sauve && identique && plane && !parExtension->loadBitGrid("test_binaire_temp.golb"));
+        }
+        std::remove("test_binaire_temp.golb");
+    }
+    
+    /**
+     * @brief Teste la lecture et l'écriture RLE en flux
+     */
+    void testerRLEFlux() {
+        afficherSection("TESTS : RLE en Flux");
+        
+        // Test 1: Plages longues à cheval sur plusieurs mots, coupées au bord
+        {
+            const std::string rle = "#N Test\n#C commentaire\nx = 200, y = 4, rule = B3/S23\n"
+                                    "5b150o$\n2$63b2o\n300o!";
+            RLEGridParser parser;
+            bool lu = parser.parse(rle.data(), rle.size());
+            std::unique_ptr<BitGrid> bits = lu ? parser.toBitGrid() : nullptr;
+            Grid grille(1, 1);
+            lu = lu && bits && parser.toGrid(grille) && grille.getWidth() == 200 && grille.getHeight() == 4;
+            for (std::int64_t y = 0; y < 4 && lu; ++y) {
+                for (std::int64_t x = 0; x < 200 && lu; ++x) {
+                    const bool attendu = (y == 0 && x >= 5 && x < 155) || (y == 3 && x >= 63);
+                    lu = bits->isAlive(x, y) == attendu && grille.getCell(x, y).isAlive() == attendu;
+                }
+            }
+            afficherResultat("Plages posées par mots entiers, identiques en Grid et BitGrid", lu);
+        }
+        
+        // Test 2: Fins de ligne regroupées, cellules mortes finales omises
+        {
+            Grid grille(10, 10);
+            grille.getCell(1, 3).setAlive(true);
+            grille.getCell(2, 4).setAlive(true);
+            grille.getCell(0, 5).setAlive(true);
+            grille.getCell(1, 5).setAlive(true);
+            grille.getCell(2, 5).setAlive(true);
+            RLEGridWriter writer;
+            afficherResultat("Planeur encodé en \"3$bo$2bo$3o!\"", 
+                writer.format(GridView(grille)) ==
+                    "#C Generated by Game of Life\nx = 10, y = 10\n3$bo$2bo$3o!\n");
+        }
+        
+        // Test 3: Aller-retour BitGrid et Grid, lignes de 70 caractères au plus
+        {
+            BitGrid source(300, 150);
+            source.randomize(0.3, 47);
+            RLEFileHandler gestionnaire;
+            bool ecrit = gestionnaire.saveBitGrid("test_rle_flux_temp.rle", source);
+            std::unique_ptr<BitGrid> relue = gestionnaire.loadBitGrid("test_rle_flux_temp.rle");
+            Grid grille(1, 1);
+            bool identique = ecrit && relue && gestionnaire.load("test_rle_flux_temp.rle", grille) &&
+                             relue->getWidth() == 300 && relue->getHeight() == 150;
+            for (std::int64_t y = 0; y < 150 && identique; ++y) {
+                for (std::int64_t x = 0; x < 300 && identique; ++x) {
+                    identique = relue->isAlive(x, y) == source.isAlive(x, y) &&
+                                grille.getCell(x, y).isAlive() == source.isAlive(x, y);
+                }
+            }
+            std::ifstream fichier("test_rle_flux_temp.rle");
+            std::string ligne;
+            std::size_t longueur = 0;
+            while (std::getline(fichier, ligne)) {
+                longueur = std::max(longueur, ligne.size());
+            }
+            afficherResultat("Grille aléatoire relue à l'identique (BitGrid et Grid)", 
+                identique && longueur <= RLEGridWriter::LINE_LENGTH);
+            std::remove("test_rle_flux_temp.rle");
+        }
+    }
+    
+    /**
+     * @brief Teste l'encodage par bandes et le décodage par tranches en parallèle
+     */
+    void testerRLEParallele() {
+        afficherSection("TESTS : RLE en Parallèle");
+        
+        // Compare les cellules vivantes de deux BitGrid
+        auto memesCellules = [](const BitGrid& a, const BitGrid& b) {
+            if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight()) return false;
+            for (std::int64_t y = 0; y < a.getHeight(); ++y) {
+                for (std::int64_t x = 0; x < a.getWidth(); ++x) {
+                    if (a.isAlive(x, y) != b.isAlive(x, y)) return false;
+                }
+            }
+            return true;
+        };
+        
+        // Test 1: Bandes vides et fins de ligne fusionnées aux jonctions, même fichier en séquentiel
+        {
+            // 2000 colonnes : bandes de 524 lignes ; cellules seulement en bords de bandes
+            BitGrid source(2000, 3000);
+            for (std::int64_t y : {0, 523, 524, 1047, 2800, 2801}) {
+                source.setAlive(y % 2000, y, true);
+                source.setAlive(1999, y, true);
+            }
+            RLEGridWriter parallele;
+            parallele.setParallelMode(true);
+            RLEGridWriter sequentiel;
+            sequentiel.setParallelMode(false);
+            bool ecrit = parallele.write("test_rle_par_temp.rle", source) &&
+                         sequentiel.write("test_rle_seq_temp.rle", source);
+            std::ifstream a("test_rle_par_temp.rle"), b("test_rle_seq_temp.rle");
+            std::stringstream texteA, texteB;
+            texteA << a.rdbuf();
+            texteB << b.rdbuf();
+            RLEFileHandler gestionnaire;
+            std::unique_ptr<BitGrid> relue = gestionnaire.loadBitGrid("test_rle_par_temp.rle");
+            afficherResultat("Jonctions \"n$\" exactes, fichier indépendant du parallélisme", 
+                ecrit && texteA.str() == texteB.str() && texteA.str().find("$$") == std::string::npos &&
+                texteA.str().find("1753$") != std::string::npos && relue && memesCellules(source, *relue));
+            std::remove("test_rle_par_temp.rle");
+            std::remove("test_rle_seq_temp.rle");
+        }
+        
+        // Test 2: Décodage par tranches (au-delà de PARALLEL_BYTES) identique au décodage séquentiel
+        {
+            BitGrid source(3000, 3000);
+            source.randomize(0.3, 53);
+            RLEFileHandler gestionnaire;
+            bool ecrit = gestionnaire.saveBitGrid("test_rle_par_temp.rle", source);
+            std::ifstream fichier("test_rle_par_temp.rle", std::ios::binary | std::ios::ate);
+            const bool assezGros = static_cast<std::uint64_t>(fichier.tellg()) > RLEGridParser::PARALLEL_BYTES;
+            RLEGridParser parallele;
+            parallele.setParallelMode(true);
+            RLEGridParser sequentiel;
+            sequentiel.setParallelMode(false);
+            std::unique_ptr<BitGrid> a = parallele.parse("test_rle_par_temp.rle") ? parallele.toBitGrid() : nullptr;
+            std::unique_ptr<BitGrid> b = sequentiel.parse("test_rle_par_temp.rle") ? sequentiel.toBitGrid() : nullptr;
+            Grid grille(1, 1);
+            bool identique = ecrit && assezGros && a && b && memesCellules(source, *a) &&
+                             memesCellules(source, *b) && parallele.toGrid(grille);
+            for (std::int64_t y = 0; y < 3000 && identique; y += 7) {
+                for (std::int64_t x = 0; x < 3000 && identique; ++x) {
+                    identique = grille.getCell(x, y).isAlive() == source.isAlive(x, y);
+                }
+            }
+            afficherResultat("Grille de 3000x3000 relue à l'identique par tranches", identique);
+            std::remove("test_rle_par_temp.rle");
+        }
+    }
+    
+    /**
+     * @brief Teste le format Macrocell (arbre quaternaire à nœuds partagés)
+     */
+    void testerMacrocell() {
+        afficherSection("TESTS : Format Macrocell");
+        
+        // Test 1: Motif répété : quelques nœuds, relu à l'identique (règle, génération)
+        {
+            BitGrid source(1000, 700);
+            for (std::int64_t y = 0; y + 2 < 700; y += 16) {
+                for (std::int64_t x = 0; x + 2 < 1000; x += 16) {
+                    source.setAlive(x + 1, y, true);
+                    source.setAlive(x + 2, y + 1, true);
+                    source.setAlive(x, y + 2, true);
+                    source.setAlive(x + 1, y + 2, true);
+                    source.setAlive(x + 2, y + 2, true);
+                }
+            }
+            source.setRule(HighLifeRule());
+            source.setGeneration(42);
+            auto gestionnaire = FileHandlerFactory::createForFile("test_macrocell_temp.mc");
+            bool ecrit = gestionnaire->saveBitGrid("test_macrocell_temp.mc", source);
+            std::unique_ptr<BitGrid> relue = gestionnaire->loadBitGrid("test_macrocell_temp.mc");
+            MacrocellTree arbre;
+            arbre.build(source.getWidth(), source.getHeight(), source.row(0));
+            std::ifstream fichier("test_macrocell_temp.mc", std::ios::binary | std::ios::ate);
+            const std::int64_t taille = static_cast<std::int64_t>(fichier.tellg());
+            bool identique = ecrit && relue && relue->getWidth() == 1000 && relue->getHeight() == 700 &&
+                             relue->getGeneration() == 42 && relue->getBirthMask() == source.getBirthMask();
+            for (std::int64_t y = 0; y < 700 && identique; ++y) {
+                for (std::int64_t x = 0; x < 1000 && identique; ++x) {
+                    identique = relue->isAlive(x, y) == source.isAlive(x, y);
+                }
+            }
+            afficherResultat("Motif répété : moins de 100 nœuds et 2 Ko, relu à l'identique", 
+                identique && arbre.getNodeCount() < 100 && taille < 2000);
+            std::remove("test_macrocell_temp.mc");
+        }
+        
+        // Test 2: Fichier Golly sans dimensions : boîte englobante, chargement en Grid
+        {
+            {
+                std::ofstream fichier("test_macrocell_temp.mc");
+                fichier << "[M2] (golly 4.2)\n#R B3/S23\n#C planeur\n.*$..*$***$\n4 0 1 0 0\n5 0 0 2 0\n";
+            }
+            Grid grille(1, 1);
+            bool charge = FileHandlerFactory::createMacrocell()->load("test_macrocell_temp.mc", grille);
+            afficherResultat("Planeur Golly chargé dans sa boîte 3x3", 
+                charge && grille.getWidth() == 3 && grille.getHeight() == 3 &&
+                grille.getCell(1, 0).isAlive() && grille.getCell(2, 1).isAlive() &&
+                grille.getCell(0, 2).isAlive() && !grille.getCell(0, 0).isAlive());
+            std::remove("test_macrocell_temp.mc");
+        }
+        
+        // Test 3: Nœud qui référence un nœud pas encore lu, et multi-états, refusés
+        {
+            {
+                std::ofstream fichier("test_macrocell_temp.mc");
+                fichier << "[M2] (golly 4.2)\n.*$\n4 0 2 0 0\n";
+            }
+            MacrocellTree arbre;
+            bool avant = arbre.parse("test_macrocell_temp.mc");
+            {
+                std::ofstream fichier("test_macrocell_temp.mc");
+                fichier << "[M2] (golly 4.2)\n1 0 1 1 0\n";
+            }
+            bool etats = arbre.parse("test_macrocell_temp.mc");
+            afficherResultat("Fichiers Macrocell invalides refusés", !avant && !etats);
+            std::remove("test_macrocell_temp.mc");
+        }
+        
+        // Test 4: Extension .mc connue de la factory, quelle que soit la casse
+        {
+            std::vector<std::string> extensions = FileHandlerFactory::getSupportedExtensions();
+            afficherResultat("FileHandlerFactory liste .mc et reconnaît .MC", 
+                std::find(extensions.begin(), extensions.end(), ".mc") != extensions.end() &&
+                FileHandlerFactory::createForFile("motif.MC")->supportsFormat("motif.mc"));
+        }
+    }
+    
+    /**
+     * @brief Tests du format creux Life 1.06
+     */
+    void testerFormatCreux() {
+        afficherSection("TESTS : Format creux Life 1.06");
+        
+        // Test 1: Aller-retour .lif d'une grille compacte
+        {
+            BitGrid source(500, 300);
+            source.setAlive(0, 0, true);
+            source.setAlive(63, 1, true);
+            source.setAlive(64, 1, true);
+            source.setAlive(499, 299, true);
+            auto gestionnaire = FileHandlerFactory::createForFile("test_creux_temp.lif");
+            bool ecrit = gestionnaire->saveBitGrid("test_creux_temp.lif", source);
+            std::unique_ptr<BitGrid> relue = gestionnaire->loadBitGrid("test_creux_temp.lif");
+            afficherResultat("Aller-retour .lif : dimensions et 4 cellules conservées", 
+                ecrit && relue && relue->getWidth() == 500 && relue->getHeight() == 300 &&
+                relue->countLivingCells() == 4 && relue->isAlive(63, 1) && relue->isAlive(64, 1) &&
+                relue->isAlive(499, 299));
+            std::remove("test_creux_temp.lif");
+        }
+        
+        // Test 2: Sauvegarde .txt : format creux pour une grande grille presque vide seulement
+        {
+            Grid grande(300, 300);
+            grande.getCell(11, 10).setAlive(true);
+            grande.getCell(12, 11).setAlive(true);
+            grande.getCell(10, 12).setAlive(true);
+            grande.getCell(11, 12).setAlive(true);
+            grande.getCell(12, 12).setAlive(true);
+            auto gestionnaire = FileHandlerFactory::createStandard();
+            gestionnaire->save("test_creux_temp.txt", grande);
+            std::string entete;
+            {
+                std::ifstream fichier("test_creux_temp.txt");
+                std::getline(fichier, entete);
+            }
+            Grid relue(1, 1);
+            bool charge = gestionnaire->load("test_creux_temp.txt", relue);
+            bool identique = charge && relue.getWidth() == 300 && relue.getHeight() == 300;
+            for (int y = 0; y < 300 && identique; ++y) {
+                for (int x = 0; x < 300 && identique; ++x) {
+                    identique = relue.getCell(x, y).isAlive() == grande.getCell(x, y).isAlive();
+                }
+            }
+            Grid petite(10, 10);
+            petite.getCell(1, 1).setAlive(true);
+            gestionnaire->save("test_creux_temp.txt", petite);
+            std::string entetePetite;
+            {
+                std::ifstream fichier("test_creux_temp.txt");
+                std::getline(fichier, entetePetite);
+            }
+            afficherResultat("Grille 300x300 presque vide écrite en Life 1.06, 10x10 en dense", 
+                entete == "#Life 1.06" && identique && entetePetite == "10 10");
+            std::remove("test_creux_temp.txt");
+        }
+        
+        // Test 3: Sans dimensions : boîte englobante (coordonnées négatives, "#D" simple
+        // description) ; ligne invalide refusée
+        {
+            {
+                std::ofstream fichier("test_creux_temp.lif");
+                fichier << "#Life 1.06\n#D x = 50, y = 50\n#Size x = 50, y = 50 environ\n"
+                        << "0 -1\n1 0\n-1 1\n0 1\n1 1\n";
+            }
+            Grid grille(1, 1);
+            bool charge = FileHandlerFactory::createSparse()->load("test_creux_temp.lif", grille);
+            bool boite = charge && grille.getWidth() == 3 && grille.getHeight() == 3 &&
+                         grille.getCell(1, 0).isAlive() && grille.getCell(2, 1).isAlive() &&
+                         grille.getCell(0, 2).isAlive() && !grille.getCell(0, 0).isAlive();
+            {
+                std::ofstream fichier("test_creux_temp.lif");
+                fichier << "#Life 1.06\n0 0\n1 x\n";
+            }
+            bool invalide = FileHandlerFactory::createSparse()->loadBitGrid("test_creux_temp.lif") != nullptr;
+            std::vector<std::string> extensions = FileHandlerFactory::getSupportedExtensions();
+            bool listees = std::find(extensions.begin(), extensions.end(), ".lif") != extensions.end() &&
+                           std::find(extensions.begin(), extensions.end(), ".life") != extensions.end();
+            afficherResultat("Planeur sans dimensions chargé en 3x3, ligne invalide refusée, .lif listé", 
+                boite && !invalide && listees);
+            std::remove("test_creux_temp.lif");
+        }
+        
+        // Test 4: Obstacles perdus à l'écriture (avertissement), cellules vivantes gardées
+        {
+            BitGrid source(20, 20);
+            source.setAlive(4, 4, true);
+            source.setObstacle(10, 10, true);
+            bool ecrit = FileHandlerFactory::createSparse()->saveBitGrid("test_creux_temp.lif", source);
+            std::unique_ptr<BitGrid> relue = FileHandlerFactory::createSparse()->loadBitGrid("test_creux_temp.lif");
+            afficherResultat("Grille avec obstacles écrite en .lif sans ses obstacles", 
+                ecrit && relue && !relue->hasObstacles() && relue->isAlive(4, 4) && relue->countLivingCells() == 1);
+            std::remove("test_creux_temp.lif");
+        }
     }
     
     // =========================================================================
@@ -749,6 +2678,27 @@ public:
         testerFichiers();
         testerJeuDeLaVie();
         testerMotifs();
+        testerAleatoire();
+        testerBitGrid();
+        testerVues();
+        testerRecensement();
+        testerEchappements();
+        testerStabilisation();
+        testerDureeDeVie();
+        testerRechercheSoupes();
+        testerBalayage();
+        testerStatistiques();
+        testerCarteActivite();
+        testerLectureTexte();
+        testerEcritureTexte();
+        testerEcritureAsynchrone();
+        testerArchiveGenerations();
+        testerPolitiqueEcriture();
+        testerFormatBinaire();
+        testerRLEFlux();
+        testerRLEParallele();
+        testerMacrocell();
+        testerFormatCreux();
         
         // Afficher le résumé
         std::cout << std::endl;
@@ -9,12 +9,153 @@
  */
 
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 #include <cstdio>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <map>
+#include <algorithm>
+#include <fstream>
+
+#ifndef _WIN32
+#include <dirent.h>
+#endif
 
 #include "Application.hpp"
 #include "GameOfLife.hpp"
 #include "UnitTests.hpp"
+#include "CounterRNG.hpp"
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include "FileHandler.hpp"
+#include "NumaTopology.hpp"
+#include "ObjectCensus.hpp"
+#include "StabilizationDetector.hpp"
+#include "LifespanMeter.hpp"
+#include "SoupSearch.hpp"
+#include "ParameterSweep.hpp"
+#include "StatisticsSink.hpp"
+#include "HeatMap.hpp"
+#include "PatternRegistry.hpp"
+#include "GridView.hpp"
+#include "GenerationArchive.hpp"
+#include "OutputPolicy.hpp"
+
+// ============================================================
+// OPTIONS GLOBALES
+// ============================================================
+
+/**
+ * @brief Options de ligne de commande communes à tous les modes
+ */
+struct CommandLineOptions {
+    double density = 0.3;       // --density : densité des soupes aléatoires
+    std::uint64_t seed = 0;     // --seed : graine des soupes aléatoires
+    bool hasSeed = false;       // true si --seed a été fourni
+    bool untilStable = false;   // --until-stable : arrêt dès que la grille est périodique
+    bool archive = false;       // --archive : mode console dans une seule archive .gola
+    OutputPolicy outputPolicy;  // --every, --log-spaced, --final-only, --on-change
+    std::int64_t stableWindow = StabilizationDetector::DEFAULT_WINDOW;  // --stable-window
+};
+
+/**
+ * @brief Extrait les options globales des arguments
+ * @param argc Nombre d'arguments
+ * @param argv Arguments
+ * @param options Options à remplir
+ * @param args Sortie : arguments restants (sans les options reconnues)
+ * @return true si les options sont valides
+ */
+bool parseGlobalOptions(int argc, char* argv[], CommandLineOptions& options,
+                        std::vector<std::string>& args) {
+    args.clear();
+    for (int i = 0; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--until-stable") {
+            options.untilStable = true;
+            continue;
+        }
+        if (arg == "--archive") {
+            options.archive = true;
+            continue;
+        }
+        if (arg == "--log-spaced" || arg == "--final-only" || arg == "--on-change") {
+            options.outputPolicy = arg == "--log-spaced" ? OutputPolicy::logSpaced()
+                                 : arg == "--final-only" ? OutputPolicy::finalOnly() : OutputPolicy::onChange();
+            continue;
+        }
+        bool isSeed = (arg == "--seed");
+        bool isDensity = (arg == "--density");
+        bool isWindow = (arg == "--stable-window");
+        bool isEvery = (arg == "--every");
+        if (!isSeed && !isDensity && !isWindow && !isEvery) {
+            args.push_back(arg);
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Erreur: " << arg << " requiert une valeur\n";
+            return false;
+        }
+        try {
+            if (isSeed) {
+                // stoull accepterait "-1" en le ramenant modulo 2^64
+                const std::string value = argv[++i];
+                if (value.find('-') != std::string::npos) throw std::invalid_argument(value);
+                options.seed = std::stoull(value);
+                options.hasSeed = true;
+            } else if (isEvery) {
+                std::int64_t interval = std::stoll(argv[++i]);
+                if (interval < 1) {
+                    std::cerr << "Erreur: --every doit être au moins 1\n";
+                    return false;
+                }
+                options.outputPolicy = OutputPolicy::every(interval);
+            } else if (isWindow) {
+                options.stableWindow = std::stoll(argv[++i]);
+                if (options.stableWindow < 1) {
+                    std::cerr << "Erreur: --stable-window doit être au moins 1\n";
+                    return false;
+                }
+            } else {
+                options.density = std::stod(argv[++i]);
+                if (options.density < 0.0 || options.density > 1.0) {
+                    std::cerr << "Erreur: --density doit être entre 0 et 1\n";
+                    return false;
+                }
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Erreur: valeur invalide pour " << arg << " : " << argv[i] << "\n";
+            return false;
+        }
+    }
+    if (!options.hasSeed) {
+        options.seed = CounterRNG::randomSeed();
+    }
+    return true;
+}
+
+/**
+ * @brief Décode des dimensions au format <largeur>x<hauteur>
+ * @param text Texte à décoder
+ * @param width Sortie : largeur
+ * @param height Sortie : hauteur
+ * @return true si les dimensions sont valides
+ */
+bool parseDimensions(const std::string& text, std::int64_t& width, std::int64_t& height) {
+    size_t sep = text.find('x');
+    try {
+        if (sep == std::string::npos) throw std::invalid_argument(text);
+        width = std::stoll(text.substr(0, sep));
+        height = std::stoll(text.substr(sep + 1));
+    } catch (const std::exception&) {
+        std::cerr << "Erreur: dimensions attendues au format <largeur>x<hauteur>, reçu : " << text << "\n";
+        return false;
+    }
+    return true;
+}
 
 // ============================================================
 // FONCTIONS UTILITAIRES - MODES D'EXÉCUTION
@@ -32,13 +173,61 @@ void printCommandLineHelp() {
     std::cout << "  ./bin/game_of_life <fichier.txt>            Charger un fichier\n";
     std::cout << "  ./bin/game_of_life --console <f> <n>        Mode console\n";
     std::cout << "  ./bin/game_of_life --test <f1> <f2> <n>     Test comparaison\n";
+    std::cout << "  ./bin/game_of_life --mapped <f.golmap> <n>  Grille hors mémoire\n";
+    std::cout << "  ./bin/game_of_life --bench <L>x<H> <n>      Débit par nœud NUMA\n";
+    std::cout << "  ./bin/game_of_life --census <f|LxH> <n>     Recensement des objets\n";
+    std::cout << "  ./bin/game_of_life --lifespan <motif|f|d>   Durée de vie des mathusalems\n";
+    std::cout << "  ./bin/game_of_life --soup-search <LxH> <n>  Recherche de soupes aléatoires\n";
+    std::cout << "  ./bin/game_of_life --sweep <d> <r> <t> <csv> Balayage de paramètres\n";
+    std::cout << "  ./bin/game_of_life --timeseries <f|LxH> <n> <sortie>  Population par génération\n";
+    std::cout << "  ./bin/game_of_life --heatmap <f|LxH> <n> <sortie.pgm>  Carte d'activité\n";
+    std::cout << "  ./bin/game_of_life --extract <f.gola>       Fichiers d'une archive\n";
     std::cout << "  ./bin/game_of_life --unit                   Tests unitaires complets\n";
     std::cout << "  ./bin/game_of_life --help                   Afficher cette aide\n\n";
+    std::cout << "OPTIONS:\n";
+    std::cout << "  --seed <n>          Graine des soupes aléatoires (rejouables)\n";
+    std::cout << "  --density <p>       Densité des soupes aléatoires (0.0 à 1.0, défaut 0.3)\n";
+    std::cout << "  --until-stable      Mode console : s'arrêter dès que la grille est stable ou périodique\n";
+    std::cout << "  --stable-window <n> Générations de répétition avant de conclure (défaut "
+              << StabilizationDetector::DEFAULT_WINDOW << ")\n";
+    std::cout << "  --archive           Mode console : toutes les générations dans <fichier>.gola\n";
+    std::cout << "  --every <n>         Mode console : n'écrire qu'une génération sur n\n";
+    std::cout << "  --log-spaced        Mode console : écrire 0..9, 10, 20..90, 100, 200...\n";
+    std::cout << "  --final-only        Mode console : n'écrire que la dernière génération\n";
+    std::cout << "  --on-change         Mode console : n'écrire que les générations modifiées\n\n";
     std::cout << "MODES:\n";
     std::cout << "  --console <fichier> <iterations>\n";
     std::cout << "      Exécute n itérations et sauvegarde dans <fichier>_out/\n\n";
     std::cout << "  --test <fichier_initial> <fichier_attendu> <iterations>\n";
     std::cout << "      Compare la grille après n itérations avec le fichier attendu\n\n";
+    std::cout << "  --mapped <fichier.golmap> <iterations> [--size <L>x<H> | --from <fichier>]\n";
+    std::cout << "      Grille projetée sur disque (plus grande que la RAM), reprise si le\n";
+    std::cout << "      fichier existe ; sinon soupe --size ou grille chargée depuis --from\n\n";
+    std::cout << "  --bench <L>x<H> <generations>\n";
+    std::cout << "      Mesure le débit de la grille compacte, par nœud NUMA\n\n";
+    std::cout << "  --census <fichier | L>x<H> <generations>\n";
+    std::cout << "      Calcule n générations (fichier ou soupe) puis recense les objets\n";
+    std::cout << "      (stables, oscillateurs, vaisseaux)\n\n";
+    std::cout << "  --lifespan <motif | fichier | dossier> [generations_max]\n";
+    std::cout << "      Fait évoluer le motif dans un univers qui s'agrandit jusqu'à sa\n";
+    std::cout << "      stabilisation : génération, population finale et recensement.\n";
+    std::cout << "      Les fichiers d'un dossier sont mesurés en parallèle\n\n";
+    std::cout << "  --soup-search <L>x<H> <nombre> [generations_max]\n";
+    std::cout << "      Mesure n soupes (graines --seed, --seed+1...) sur tous les cœurs :\n";
+    std::cout << "      durées de vie, recensement cumulé et objets rares\n\n";
+    std::cout << "  --sweep <densites> <regles> <tailles> <fichier.csv> [repetitions] [generations_max]\n";
+    std::cout << "      Simule chaque combinaison jusqu'à stabilisation et écrit une ligne CSV\n";
+    std::cout << "      par calcul. Densités 0.1:0.5:0.1 ou 0.2,0.3 ; règles all ou\n";
+    std::cout << "      classic,highlife,B36/S23,... ; tailles 64x64,128x128 ou 64x64:1024x1024\n\n";
+    std::cout << "  --timeseries <fichier | L>x<H> <generations> <sortie.csv | sortie.bin> [tous_les_n]\n";
+    std::cout << "      Enregistre population, naissances et morts (CSV ou binaire) sans\n";
+    std::cout << "      écrire la grille ; l'écriture se fait en arrière-plan\n\n";
+    std::cout << "  --heatmap <fichier | L>x<H> <generations> <sortie.pgm> [regle] [cellule | tuile]\n";
+    std::cout << "      Compte les changements d'état de chaque cellule (ou tuile 8x8) et\n";
+    std::cout << "      écrit la carte en niveaux de gris (touche A en mode graphique)\n\n";
+    std::cout << "  --extract <archive.gola> [dossier] [generation | premiere:derniere]\n";
+    std::cout << "      Recrée les fichiers generation_XXXXXX.txt d'une archive --archive\n";
+    std::cout << "      (dans <archive>_out/ par défaut), toutes ou certaines générations\n\n";
     std::cout << "  --unit\n";
     std::cout << "      Exécute tous les tests unitaires du programme\n";
     std::cout << "      Teste chaque classe séparément : Cell, Grid, Rule, etc.\n\n";
@@ -123,9 +312,10 @@ std::string openFileDialog() {
  * @brief Exécute le mode console
  * @param inputFile Fichier d'entrée
  * @param iterations Nombre d'itérations
+ * @param options Options globales (--until-stable, --stable-window, --archive, politique d'écriture)
  * @return Code de retour (0 = succès)
  */
-int runConsoleMode(const std::string& inputFile, int iterations) {
+int runConsoleMode(const std::string& inputFile, std::int64_t iterations, const CommandLineOptions& options) {
     std::cout << "=========================================\n";
     std::cout << "MODE CONSOLE - Jeu de la Vie\n";
     std::cout << "=========================================\n";
@@ -138,8 +328,9 @@ int runConsoleMode(const std::string& inputFile, int iterations) {
         Application::DEFAULT_GRID_HEIGHT, 
         Application::DEFAULT_UPDATE_INTERVAL
     );
+    game.setStabilizationWindow(options.stableWindow);
     
-    if (game.runConsoleMode(inputFile, iterations)) {
+    if (game.runConsoleMode(inputFile, iterations, options.untilStable, options.archive, options.outputPolicy)) {
         std::cout << "=========================================\n";
         std::cout << "Mode console terminé avec SUCCÈS !\n";
         std::cout << "=========================================\n";
@@ -159,7 +350,7 @@ int runConsoleMode(const std::string& inputFile, int iterations) {
  * @param iterations Nombre d'itérations
  * @return Code de retour (0 = test réussi, 1 = échec)
  */
-int runTestMode(const std::string& inputFile, const std::string& expectedFile, int iterations) {
+int runTestMode(const std::string& inputFile, const std::string& expectedFile, std::int64_t iterations) {
     std::cout << "=========================================\n";
     std::cout << "MODE TEST UNITAIRE - Jeu de la Vie\n";
     std::cout << "=========================================\n";
@@ -187,13 +378,550 @@ int runTestMode(const std::string& inputFile, const std::string& expectedFile, i
     }
 }
 
+/**
+ * @brief Exécute le mode grille projetée (hors mémoire)
+ *
+ * Le fichier .golmap contient les deux plans de bits : s'il existe, la
+ * simulation reprend à la génération enregistrée, sinon il est créé à partir
+ * d'une soupe (--size) ou d'un fichier de grille (--from).
+ *
+ * @param mapFile Fichier projeté
+ * @param iterations Nombre de générations à calculer
+ * @param extraArgs Arguments suivants (--size, --from)
+ * @param options Options globales (paramètres des soupes)
+ * @return Code de retour (0 = succès)
+ */
+int runMappedMode(const std::string& mapFile, std::int64_t iterations,
+                  const std::vector<std::string>& extraArgs, const CommandLineOptions& options) {
+    std::string sizeArg;
+    std::string fromFile;
+    for (size_t i = 0; i + 1 < extraArgs.size(); i += 2) {
+        if (extraArgs[i] == "--size") {
+            sizeArg = extraArgs[i + 1];
+        } else if (extraArgs[i] == "--from") {
+            fromFile = extraArgs[i + 1];
+        } else {
+            std::cerr << "Erreur: option inconnue " << extraArgs[i] << "\n";
+            return 1;
+        }
+    }
+
+    std::cout << "=========================================\n";
+    std::cout << "MODE GRILLE PROJETÉE - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+
+    std::unique_ptr<BitGrid> grid;
+    if (DirectoryManager::fileExists(mapFile)) {
+        grid = BitGrid::openMapped(mapFile);
+        if (!grid) return 1;
+        std::cout << "Reprise de " << mapFile << " à la génération " << grid->getGeneration() << "\n";
+    } else if (!fromFile.empty()) {
+        // Chargement compact (un bit par cellule), puis recopie mot par mot dans le fichier
+        auto handler = FileHandlerFactory::createForFile(fromFile);
+        std::unique_ptr<BitGrid> source = handler ? handler->loadBitGrid(fromFile) : nullptr;
+        if (!source) return 1;
+        grid = BitGrid::createMapped(mapFile, source->getWidth(), source->getHeight(), source->hasObstacles());
+        if (!grid || !grid->copyCells(*source)) return 1;
+        std::cout << "Grille chargée depuis " << fromFile << "\n";
+    } else if (!sizeArg.empty()) {
+        std::int64_t width = 0;
+        std::int64_t height = 0;
+        if (!parseDimensions(sizeArg, width, height)) return 1;
+        grid = BitGrid::createMapped(mapFile, width, height);
+        if (!grid) return 1;
+        grid->randomize(options.density, options.seed);
+        std::cout << "Soupe " << width << "x" << height << " (densité " << options.density
+                  << ", graine " << options.seed << ")\n";
+    } else {
+        std::cerr << "Erreur: " << mapFile << " n'existe pas : préciser --size <L>x<H> ou --from <fichier>\n";
+        return 1;
+    }
+
+    // Chaque génération lit le plan courant et écrit le plan suivant
+    const double bytesPerGeneration = 2.0 * grid->getWordsPerRow() * grid->getHeight() * sizeof(BitGrid::Word);
+    std::cout << "Dimensions : " << grid->getWidth() << "x" << grid->getHeight() << "\n";
+    std::cout << "Itérations : " << iterations << "\n";
+    std::cout << "=========================================\n";
+
+    for (std::int64_t i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        grid->step();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Génération " << grid->getGeneration() << " : " << seconds << " s, "
+                  << (seconds > 0.0 ? bytesPerGeneration / seconds / (1024.0 * 1024.0) : 0.0)
+                  << " Mo/s\n";
+    }
+
+    if (!grid->sync()) return 1;
+    std::cout << "=========================================\n";
+    std::cout << "Cellules vivantes : " << grid->countLivingCells() << "\n";
+    std::cout << "Point de reprise écrit dans " << mapFile << "\n";
+    std::cout << "=========================================\n";
+    return 0;
+}
+
+/**
+ * @brief Mesure le débit de calcul de la grille compacte, par nœud NUMA
+ *
+ * Chaque génération lit le plan courant et écrit le plan suivant ; le débit
+ * d'un nœud est le volume traité par ses threads rapporté au temps écoulé.
+ *
+ * @param size Dimensions (<largeur>x<hauteur>)
+ * @param generations Nombre de générations mesurées
+ * @param options Options globales (paramètres des soupes)
+ * @return Code de retour (0 = succès)
+ */
+int runBenchmarkMode(const std::string& size, std::int64_t generations, const CommandLineOptions& options) {
+    std::int64_t width = 0;
+    std::int64_t height = 0;
+    if (!parseDimensions(size, width, height)) return 1;
+
+    const NumaTopology& topology = NumaTopology::get();
+    std::cout << "=========================================\n";
+    std::cout << "MODE BENCHMARK - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+    std::cout << "Nœuds NUMA : " << topology.getNodeCount() << "\n";
+    for (int node = 0; node < topology.getNodeCount(); ++node) {
+        std::cout << "  Nœud " << node << " : " << topology.getCpus(node).size() << " processeurs\n";
+    }
+
+    std::unique_ptr<BitGrid> grid;
+    try {
+        grid.reset(new BitGrid(width, height));
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur : Grille " << width << "x" << height << " impossible à allouer (" << e.what() << ")\n";
+        return 1;
+    }
+    grid->randomize(options.density, options.seed);
+    grid->step();  // Échauffement
+
+    const double rowBytes = 2.0 * grid->getWordsPerRow() * sizeof(BitGrid::Word);
+    std::cout << "Grille : " << width << "x" << height << " ("
+              << (grid->usesHugePages() ? "pages énormes" : "pages normales") << ")\n";
+    std::cout << "Générations : " << generations << "\n";
+    std::cout << "=========================================\n";
+
+    std::map<int, double> nodeBytes;
+    std::map<int, int> nodeThreads;
+    double totalSeconds = 0.0;
+    for (std::int64_t i = 0; i < generations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        grid->step();
+        totalSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::map<int, int> threads;
+        for (const WorkerTiming& timing : grid->getLastStepTimings()) {
+            nodeBytes[timing.node] += timing.rows * rowBytes;
+            threads[timing.node]++;
+        }
+        nodeThreads = threads;
+    }
+
+    const double mega = 1024.0 * 1024.0;
+    double totalBytes = 0.0;
+    for (const auto& entry : nodeBytes) {
+        totalBytes += entry.second;
+        std::cout << "Nœud " << entry.first << " (" << nodeThreads[entry.first] << " threads) : "
+                  << (totalSeconds > 0.0 ? entry.second / totalSeconds / mega : 0.0) << " Mo/s\n";
+    }
+    std::cout << "=========================================\n";
+    std::cout << "Total : " << (totalSeconds > 0.0 ? totalBytes / totalSeconds / mega : 0.0) << " Mo/s, "
+              << (totalSeconds > 0.0 ? generations / totalSeconds : 0.0) << " générations/s\n";
+    std::cout << "=========================================\n";
+    return 0;
+}
+
+/**
+ * @brief Crée la grille compacte d'un mode sans interface
+ *
+ * La grille est chargée depuis un fichier s'il existe, sinon c'est une soupe
+ * aux dimensions <largeur>x<hauteur>.
+ *
+ * @param source Fichier de grille ou dimensions de la soupe
+ * @param options Options globales (paramètres des soupes)
+ * @return Grille, nullptr en cas d'erreur
+ */
+std::unique_ptr<BitGrid> loadOrRandomize(const std::string& source, const CommandLineOptions& options) {
+    std::unique_ptr<BitGrid> grid;
+    if (DirectoryManager::fileExists(source)) {
+        auto handler = FileHandlerFactory::createForFile(source);
+        if (!handler) return nullptr;
+        grid = handler->loadBitGrid(source);
+        if (!grid) return nullptr;
+        std::cout << "Grille chargée depuis " << source << "\n";
+    } else {
+        std::int64_t width = 0;
+        std::int64_t height = 0;
+        if (!parseDimensions(source, width, height)) return nullptr;
+        try {
+            grid.reset(new BitGrid(width, height));
+        } catch (const std::exception& e) {
+            std::cerr << "Erreur : Grille " << width << "x" << height << " impossible à allouer (" << e.what() << ")\n";
+            return nullptr;
+        }
+        grid->randomize(options.density, options.seed);
+        std::cout << "Soupe " << width << "x" << height << " (densité " << options.density
+                  << ", graine " << options.seed << ")\n";
+    }
+    return grid;
+}
+
+/**
+ * @brief Calcule n générations en enregistrant population, naissances et morts
+ *
+ * Seules les statistiques sont écrites (par un thread d'arrière-plan), jamais
+ * la grille.
+ *
+ * @param source Fichier de grille ou dimensions de la soupe
+ * @param generations Nombre de générations
+ * @param output Fichier de sortie (.csv ou binaire)
+ * @param every Intervalle d'enregistrement en générations
+ * @param options Options globales (paramètres des soupes)
+ * @return Code de retour (0 = succès)
+ */
+int runTimeSeriesMode(const std::string& source, std::int64_t generations, const std::string& output,
+                      std::int64_t every, const CommandLineOptions& options) {
+    std::cout << "=========================================\n";
+    std::cout << "MODE SÉRIE TEMPORELLE - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+
+    std::unique_ptr<BitGrid> grid = loadOrRandomize(source, options);
+    if (!grid) return 1;
+    grid->setParallelMode(true);
+
+    StatisticsSink sink;
+    if (!sink.open(output, every)) return 1;
+
+    auto start = std::chrono::steady_clock::now();
+    sink.record({0, grid->countLivingCells(), 0, 0});
+    for (std::int64_t generation = 1; generation <= generations; ++generation) {
+        grid->step();
+        if (sink.wants(generation)) {
+            GenerationRecord record;
+            record.generation = generation;
+            record.population = grid->countLivingCells();
+            grid->countChanges(record.births, record.deaths);
+            sink.record(record);
+        }
+    }
+    bool written = sink.close();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Générations : " << generations << " (" << seconds << " s), une ligne toutes les "
+              << std::max<std::int64_t>(1, every) << " générations\n";
+    std::cout << "Série écrite dans " << output << "\n";
+    std::cout << "=========================================\n";
+    return written ? 0 : 1;
+}
+
+/**
+ * @brief Calcule n générations en cumulant l'activité de chaque cellule
+ *
+ * @param source Fichier de grille ou dimensions de la soupe
+ * @param generations Nombre de générations
+ * @param output Image PGM de sortie
+ * @param ruleName Règle à appliquer (vide = celle de la grille)
+ * @param resolution "cellule" (défaut) ou "tuile" (8x8, pour les grandes grilles)
+ * @param options Options globales (paramètres des soupes)
+ * @return Code de retour (0 = succès)
+ */
+int runHeatMapMode(const std::string& source, std::int64_t generations, const std::string& output,
+                   const std::string& ruleName, const std::string& resolution, const CommandLineOptions& options) {
+    std::cout << "=========================================\n";
+    std::cout << "MODE CARTE D'ACTIVITÉ - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+
+    std::vector<std::string> rules;
+    if (!ruleName.empty() && !ParameterSweep::parseRules(ruleName, rules)) return 1;
+    if (resolution != "cellule" && resolution != "tuile") {
+        std::cerr << "Erreur : Résolution inconnue : " << resolution << " (cellule ou tuile)\n";
+        return 1;
+    }
+
+    std::unique_ptr<BitGrid> grid = loadOrRandomize(source, options);
+    if (!grid) return 1;
+    grid->setParallelMode(true);
+    if (!rules.empty()) {
+        grid->setRule(*ParameterSweep::createRule(rules.front()));
+    }
+    grid->setHeatMapEnabled(true, resolution == "tuile" ? HeatMap::Resolution::TILE : HeatMap::Resolution::CELL);
+
+    auto start = std::chrono::steady_clock::now();
+    grid->step(generations);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const HeatMap& heat = *grid->getHeatMap();
+    std::cout << "Générations : " << generations << " (" << seconds << " s)\n";
+    std::cout << "Activité maximale : " << heat.getMax() << " changements\n";
+    if (!heat.savePGM(output)) return 1;
+    std::cout << "Carte écrite dans " << output << "\n";
+    std::cout << "=========================================\n";
+    return 0;
+}
+
+/**
+ * @brief Recrée les fichiers du mode console à partir d'une archive
+ * @param archiveFile Archive écrite par --console --archive
+ * @param directory Dossier de sortie (vide = <archive>_out)
+ * @param range Génération ("12") ou plage ("10:20") ; vide = toutes
+ * @return Code de retour (0 = succès)
+ */
+int runExtractMode(const std::string& archiveFile, const std::string& directory, const std::string& range) {
+    std::cout << "=========================================\n";
+    std::cout << "MODE EXTRACTION D'ARCHIVE - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+
+    GenerationArchiveReader reader;
+    if (!reader.open(archiveFile)) return 1;
+    std::int64_t first = 0;
+    std::int64_t last = reader.getGenerations().empty() ? -1 : reader.getGenerations().back();
+    if (!range.empty()) {
+        size_t sep = range.find(':');
+        try {
+            first = std::stoll(range.substr(0, sep));
+            last = sep == std::string::npos ? first : std::stoll(range.substr(sep + 1));
+        } catch (const std::exception&) {
+            std::cerr << "Erreur: génération ou plage <premiere>:<derniere> attendue, reçu : " << range << "\n";
+            return 1;
+        }
+    }
+
+    std::string outputDir = directory.empty() ? DirectoryManager::getBaseName(archiveFile) + "_out" : directory;
+    std::cout << "Archive : " << archiveFile << " (" << reader.getWidth() << "x" << reader.getHeight()
+              << ", " << reader.getGenerationCount() << " générations archivées)\n";
+    auto start = std::chrono::steady_clock::now();
+    std::int64_t written = reader.extract(outputDir, first, last);
+    if (written < 0) return 1;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << written << " fichiers écrits dans " << outputDir << " (" << seconds << " s)\n";
+    std::cout << "=========================================\n";
+    return 0;
+}
+
+/**
+ * @brief Calcule n générations puis recense les objets de la grille
+ *
+ * La grille de départ est un fichier s'il existe, sinon une soupe aux
+ * dimensions <largeur>x<hauteur>.
+ *
+ * @param source Fichier de grille ou dimensions de la soupe
+ * @param generations Nombre de générations avant le recensement
+ * @param options Options globales (paramètres des soupes)
+ * @return Code de retour (0 = succès)
+ */
+int runCensusMode(const std::string& source, std::int64_t generations, const CommandLineOptions& options) {
+    std::cout << "=========================================\n";
+    std::cout << "MODE RECENSEMENT - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+
+    std::unique_ptr<BitGrid> grid = loadOrRandomize(source, options);
+    if (!grid) return 1;
+    grid->setParallelMode(true);
+
+    auto start = std::chrono::steady_clock::now();
+    grid->step(generations);
+    double stepSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    ObjectCensus census;
+    std::vector<CensusEntry> entries = census.take(*grid);
+    double censusSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::int64_t objectCount = 0;
+    for (const CensusEntry& entry : entries) {
+        objectCount += entry.count;
+    }
+    std::cout << "Générations : " << generations << " (" << stepSeconds << " s)\n";
+    std::cout << "Cellules vivantes : " << grid->countLivingCells() << "\n";
+    std::cout << "Objets : " << objectCount << " (" << censusSeconds << " s)\n";
+    std::cout << "=========================================\n";
+    ObjectCensus::print(std::cout, entries);
+    std::cout << "=========================================\n";
+    return 0;
+}
+
+/**
+ * @brief Charge un motif à mesurer : motif enregistré ou fichier de grille
+ * @param source Nom du motif ou chemin du fichier
+ * @param pattern Sortie : motif chargé
+ * @return true si le chargement a réussi
+ */
+bool loadLifespanPattern(const std::string& source, PatternBitmap& pattern) {
+    if (!DirectoryManager::fileExists(source)) {
+        const PatternBitmap* registered = PatternRegistry::get().find(source);
+        if (!registered) {
+            std::cerr << "Erreur : Motif ou fichier inconnu : " << source << "\n";
+            return false;
+        }
+        pattern = *registered;
+        return true;
+    }
+    Grid loaded(1, 1);
+    auto handler = FileHandlerFactory::createForFile(source);
+    if (!handler || !handler->load(source, loaded)) {
+        return false;
+    }
+    pattern = PatternBitmap::fromView(DirectoryManager::getBaseName(source), GridView(loaded));
+    return true;
+}
+
+/**
+ * @brief Mesure le temps de stabilisation de mathusalems
+ *
+ * La source est un motif enregistré (r_pentomino, acorn...), un fichier de
+ * grille ou un dossier : ses fichiers sont alors mesurés en parallèle.
+ *
+ * @param source Motif, fichier ou dossier
+ * @param maxGenerations Limite de générations par motif
+ * @return Code de retour (0 = succès)
+ */
+int runLifespanMode(const std::string& source, std::int64_t maxGenerations) {
+    std::cout << "=========================================\n";
+    std::cout << "MODE DURÉE DE VIE - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+
+    std::vector<PatternBitmap> patterns;
+    if (DirectoryManager::directoryExists(source)) {
+#ifndef _WIN32
+        std::vector<std::string> files;
+        const std::vector<std::string> extensions = FileHandlerFactory::getSupportedExtensions();
+        if (DIR* dir = opendir(source.c_str())) {
+            while (dirent* entry = readdir(dir)) {
+                std::string file = entry->d_name;
+                std::string ext = DirectoryManager::getExtension(file);
+                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+                if (std::find(extensions.begin(), extensions.end(), ext) != extensions.end()) {
+                    files.push_back(source + "/" + file);
+                }
+            }
+            closedir(dir);
+        }
+        std::sort(files.begin(), files.end());
+        for (const std::string& file : files) {
+            PatternBitmap pattern;
+            if (loadLifespanPattern(file, pattern)) {
+                patterns.push_back(std::move(pattern));
+            }
+        }
+#endif
+        if (patterns.empty()) {
+            std::cerr << "Erreur : Aucun motif lisible dans " << source << "\n";
+            return 1;
+        }
+    } else {
+        PatternBitmap pattern;
+        if (!loadLifespanPattern(source, pattern)) return 1;
+        patterns.push_back(std::move(pattern));
+    }
+    std::cout << "Motifs : " << patterns.size() << ", limite " << maxGenerations << " générations\n";
+    std::cout << "=========================================\n";
+
+    auto start = std::chrono::steady_clock::now();
+    LifespanMeter meter(maxGenerations);
+    std::vector<LifespanResult> results;
+    if (patterns.size() == 1) {
+        results.push_back(meter.measure(patterns.front(), false));
+    } else {
+        results = meter.measureAll(patterns);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (const LifespanResult& result : results) {
+        LifespanMeter::print(std::cout, result);
+        std::cout << "=========================================\n";
+    }
+    std::cout << "Durée : " << seconds << " s\n";
+    return 0;
+}
+
+/**
+ * @brief Recherche de soupes aléatoires répartie sur tous les cœurs
+ * @param size Dimensions des soupes (<largeur>x<hauteur>)
+ * @param count Nombre de soupes
+ * @param maxGenerations Limite de générations par soupe
+ * @param options Options globales (graine de départ, densité)
+ * @return Code de retour (0 = succès)
+ */
+int runSoupSearchMode(const std::string& size, std::int64_t count, std::int64_t maxGenerations,
+                      const CommandLineOptions& options) {
+    std::cout << "=========================================\n";
+    std::cout << "MODE RECHERCHE DE SOUPES - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+
+    std::int64_t width = 0;
+    std::int64_t height = 0;
+    if (!parseDimensions(size, width, height)) return 1;
+    std::cout << count << " soupes " << width << "x" << height << " (densité " << options.density
+              << ", graines " << options.seed << " à " << options.seed + static_cast<std::uint64_t>(count) - 1
+              << "), limite " << maxGenerations << " générations\n";
+
+    SoupSearch search(width, height, options.density, maxGenerations);
+    auto start = std::chrono::steady_clock::now();
+    SoupStatistics stats = search.run(options.seed, count, &std::cout);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "=========================================\n";
+    SoupSearch::print(std::cout, stats, seconds);
+    std::cout << "=========================================\n";
+    return 0;
+}
+
+/**
+ * @brief Balayage densité x règle x taille vers un fichier CSV
+ * @param args Arguments du mode (densités, règles, tailles, fichier, [répétitions], [générations max])
+ * @param options Options globales (graine du premier calcul)
+ * @return Code de retour (0 = succès)
+ */
+int runSweepMode(const std::vector<std::string>& args, const CommandLineOptions& options) {
+    std::cout << "=========================================\n";
+    std::cout << "MODE BALAYAGE - Jeu de la Vie\n";
+    std::cout << "=========================================\n";
+
+    std::vector<double> densities;
+    std::vector<std::string> rules;
+    std::vector<std::pair<std::int64_t, std::int64_t>> sizes;
+    if (!ParameterSweep::parseDensities(args[0], densities) || !ParameterSweep::parseRules(args[1], rules) ||
+        !ParameterSweep::parseSizes(args[2], sizes)) {
+        return 1;
+    }
+    const std::int64_t repetitions = args.size() > 4 ? std::stoll(args[4]) : 1;
+    const std::int64_t maxGenerations = args.size() > 5 ? std::stoll(args[5]) : ParameterSweep::DEFAULT_MAX_GENERATIONS;
+
+    std::ofstream csv(args[3]);
+    if (!csv) {
+        std::cerr << "Erreur : Impossible de créer le fichier " << args[3] << "\n";
+        return 1;
+    }
+
+    ParameterSweep sweep(maxGenerations);
+    std::vector<SweepJob> jobs = sweep.plan(densities, rules, sizes, std::max<std::int64_t>(1, repetitions), options.seed);
+    std::cout << densities.size() << " densités x " << rules.size() << " règles x " << sizes.size()
+              << " tailles x " << repetitions << " = " << jobs.size() << " calculs (graines "
+              << options.seed << " à " << options.seed + jobs.size() - 1 << ")\n";
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<SweepResult> results = sweep.run(jobs, csv);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::int64_t settled = 0;
+    for (const SweepResult& result : results) {
+        if (result.settled) ++settled;
+    }
+    std::cout << "Stabilisés : " << settled << "/" << results.size() << "\n";
+    std::cout << "Durée : " << seconds << " s, résultats dans " << args[3] << "\n";
+    std::cout << "=========================================\n";
+    return 0;
+}
+
 /**
  * @brief Exécute le mode graphique avec un fichier
  * @param filename Fichier à charger
+ * @param options Options globales (paramètres des soupes)
  * @return Code de retour (0 = succès)
  */
-int runGraphicsModeWithFile(const std::string& filename) {
+int runGraphicsModeWithFile(const std::string& filename, const CommandLineOptions& options) {
     Application app;
+    app.setSoupParameters(options.density, options.seed);
     if (app.loadAndRun(filename)) {
         return 0;
     }
@@ -202,10 +930,12 @@ int runGraphicsModeWithFile(const std::string& filename) {
 
 /**
  * @brief Exécute le mode graphique par défaut
+ * @param options Options globales (paramètres des soupes)
  * @return Code de retour (0 = succès)
  */
-int runGraphicsModeDefault() {
+int runGraphicsModeDefault(const CommandLineOptions& options) {
     Application app;
+    app.setSoupParameters(options.density, options.seed);
     app.runDefault();
     return 0;
 }
@@ -215,42 +945,144 @@ int runGraphicsModeDefault() {
 // ============================================================
 
 int main(int argc, char* argv[]) {
+    CommandLineOptions options;
+    std::vector<std::string> args;
+    if (!parseGlobalOptions(argc, argv, options, args)) {
+        return 1;
+    }
+    const size_t nargs = args.size();
+
     // Mode aide
-    if (argc >= 2 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")) {
+    if (nargs >= 2 && (args[1] == "--help" || args[1] == "-h")) {
         printCommandLineHelp();
         return 0;
     }
 
     // Mode tests unitaires complets
-    if (argc >= 2 && (std::string(argv[1]) == "--unit" || std::string(argv[1]) == "-u")) {
+    if (nargs >= 2 && (args[1] == "--unit" || args[1] == "-u")) {
         return runUnitTests();
     }
 
     // Mode console
-    if (argc >= 2 && std::string(argv[1]) == "--console") {
-        if (argc < 4) {
+    if (nargs >= 2 && args[1] == "--console") {
+        if (nargs < 4) {
             std::cerr << "Erreur: Mode console requiert 2 arguments\n";
             std::cerr << "Usage: ./bin/game_of_life --console <fichier> <iterations>\n";
             return 1;
         }
-        return runConsoleMode(argv[2], std::stoi(argv[3]));
+        return runConsoleMode(args[2], std::stoll(args[3]), options);
     }
 
     // Mode test comparaison
-    if (argc >= 2 && std::string(argv[1]) == "--test") {
-        if (argc < 5) {
+    if (nargs >= 2 && args[1] == "--test") {
+        if (nargs < 5) {
             std::cerr << "Erreur: Mode test requiert 3 arguments\n";
             std::cerr << "Usage: ./bin/game_of_life --test <fichier_init> <fichier_attendu> <iterations>\n";
             return 1;
         }
-        return runTestMode(argv[2], argv[3], std::stoi(argv[4]));
+        return runTestMode(args[2], args[3], std::stoll(args[4]));
+    }
+
+    // Mode grille projetée
+    if (nargs >= 2 && args[1] == "--mapped") {
+        if (nargs < 4) {
+            std::cerr << "Erreur: Mode projeté requiert 2 arguments\n";
+            std::cerr << "Usage: ./bin/game_of_life --mapped <fichier.golmap> <iterations> [--size <L>x<H> | --from <fichier>]\n";
+            return 1;
+        }
+        std::vector<std::string> extraArgs(args.begin() + 4, args.end());
+        return runMappedMode(args[2], std::stoll(args[3]), extraArgs, options);
+    }
+
+    // Mode benchmark
+    if (nargs >= 2 && args[1] == "--bench") {
+        if (nargs < 4) {
+            std::cerr << "Erreur: Mode benchmark requiert 2 arguments\n";
+            std::cerr << "Usage: ./bin/game_of_life --bench <L>x<H> <generations>\n";
+            return 1;
+        }
+        return runBenchmarkMode(args[2], std::stoll(args[3]), options);
+    }
+
+    // Mode recensement
+    if (nargs >= 2 && args[1] == "--census") {
+        if (nargs < 4) {
+            std::cerr << "Erreur: Mode recensement requiert 2 arguments\n";
+            std::cerr << "Usage: ./bin/game_of_life --census <fichier | L>x<H> <generations>\n";
+            return 1;
+        }
+        return runCensusMode(args[2], std::stoll(args[3]), options);
+    }
+
+    // Mode durée de vie
+    if (nargs >= 2 && args[1] == "--lifespan") {
+        if (nargs < 3) {
+            std::cerr << "Erreur: Mode durée de vie requiert au moins 1 argument\n";
+            std::cerr << "Usage: ./bin/game_of_life --lifespan <motif | fichier | dossier> [generations_max]\n";
+            return 1;
+        }
+        std::int64_t maxGenerations = nargs >= 4 ? std::stoll(args[3]) : LifespanMeter::DEFAULT_MAX_GENERATIONS;
+        return runLifespanMode(args[2], maxGenerations);
+    }
+
+    // Mode recherche de soupes
+    if (nargs >= 2 && args[1] == "--soup-search") {
+        if (nargs < 4) {
+            std::cerr << "Erreur: Mode recherche de soupes requiert 2 arguments\n";
+            std::cerr << "Usage: ./bin/game_of_life --soup-search <L>x<H> <nombre> [generations_max]\n";
+            return 1;
+        }
+        std::int64_t maxGenerations = nargs >= 5 ? std::stoll(args[4]) : SoupSearch::DEFAULT_MAX_GENERATIONS;
+        return runSoupSearchMode(args[2], std::stoll(args[3]), maxGenerations, options);
+    }
+
+    // Mode série temporelle
+    if (nargs >= 2 && args[1] == "--timeseries") {
+        if (nargs < 5) {
+            std::cerr << "Erreur: Mode série temporelle requiert au moins 3 arguments\n";
+            std::cerr << "Usage: ./bin/game_of_life --timeseries <fichier | L>x<H> <generations> <sortie> [tous_les_n]\n";
+            return 1;
+        }
+        std::int64_t every = nargs >= 6 ? std::stoll(args[5]) : 1;
+        return runTimeSeriesMode(args[2], std::stoll(args[3]), args[4], every, options);
+    }
+
+    // Mode carte d'activité
+    if (nargs >= 2 && args[1] == "--heatmap") {
+        if (nargs < 5) {
+            std::cerr << "Erreur: Mode carte d'activité requiert au moins 3 arguments\n";
+            std::cerr << "Usage: ./bin/game_of_life --heatmap <fichier | L>x<H> <generations> <sortie.pgm> [regle] [cellule | tuile]\n";
+            return 1;
+        }
+        return runHeatMapMode(args[2], std::stoll(args[3]), args[4], nargs >= 6 ? args[5] : "",
+                              nargs >= 7 ? args[6] : "cellule", options);
+    }
+
+    // Mode extraction d'archive
+    if (nargs >= 2 && args[1] == "--extract") {
+        if (nargs < 3) {
+            std::cerr << "Erreur: Mode extraction requiert au moins 1 argument\n";
+            std::cerr << "Usage: ./bin/game_of_life --extract <archive.gola> [dossier] [generation | premiere:derniere]\n";
+            return 1;
+        }
+        return runExtractMode(args[2], nargs >= 4 ? args[3] : "", nargs >= 5 ? args[4] : "");
+    }
+
+    // Mode balayage de paramètres
+    if (nargs >= 2 && args[1] == "--sweep") {
+        if (nargs < 6) {
+            std::cerr << "Erreur: Mode balayage requiert au moins 4 arguments\n";
+            std::cerr << "Usage: ./bin/game_of_life --sweep <densites> <regles> <tailles> <fichier.csv> [repetitions] [generations_max]\n";
+            return 1;
+        }
+        return runSweepMode(std::vector<std::string>(args.begin() + 2, args.end()), options);
     }
 
     // Mode graphique avec fichier
-    if (argc >= 2 && argv[1][0] != '-') {
-        return runGraphicsModeWithFile(argv[1]);
+    if (nargs >= 2 && args[1][0] != '-') {
+        return runGraphicsModeWithFile(args[1], options);
     }
 
     // Mode graphique par défaut
-    return runGraphicsModeDefault();
+    return runGraphicsModeDefault(options);
 }